@@ -48,6 +48,9 @@ parser.add_argument("fmt",
         help="whether the flag is a format flag (True or False)")
 parser.add_argument("components",
         help="components of a compound flag, if applicable, joined with :")
+parser.add_argument("kept",
+        help="the base flags that are not compiled out joined with :, or "
+             "All to keep every flag")
 
 args = parser.parse_args()
 
@@ -61,6 +64,13 @@ else:
     sys.exit(1)
 components = args.components.split(':') if args.components else []
 
+# Format flags change how messages are printed rather than guard them, so
+# they are never compiled out.
+if args.kept == 'All' or fmt:
+    compiled_out = False
+else:
+    compiled_out = args.name not in args.kept.split(':')
+
 code = code_formatter()
 
 code('''
@@ -96,7 +106,8 @@ inline union ${{args.name}}
     CompoundFlag ${{args.name}} = {
         "${{args.name}}", "${{args.desc}}", {
             ${{",\\n            ".join(
-                f"(Flag *)&::gem5::debug::{flag}" for flag in components)}}
+                f"(Flag *)&::gem5::debug::unions::{flag}.{flag}"
+                for flag in components)}}
         }
     };
 } ${{args.name}};
@@ -107,16 +118,31 @@ inline union ${{args.name}}
 {
     ~${{args.name}}() {}
     SimpleFlag ${{args.name}} = {
-        "${{args.name}}", "${{args.desc}}", ${{"true" if fmt else "false"}}
+        "${{args.name}}", "${{args.desc}}", ${{"true" if fmt else "false"}},
+        ${{"true" if compiled_out else "false"}}
     };
 } ${{args.name}};
 ''')
 
-code('''
+if components:
+    kids = ", ".join(f"decltype(::gem5::debug::{flag})"
+                     for flag in components)
+    code('''
 } // namespace unions
 
-inline constexpr const auto& ${{args.name}} = 
-    ::gem5::debug::unions::${{args.name}}.${{args.name}};
+inline constexpr FlagHandle<CompoundFlag, allCompiledOut<${{kids}}>>
+    ${{args.name}} = ::gem5::debug::unions::${{args.name}}.${{args.name}};
+''')
+else:
+    out = "true" if compiled_out else "false"
+    code('''
+} // namespace unions
+
+inline constexpr FlagHandle<SimpleFlag, ${out}>
+    ${{args.name}} = ::gem5::debug::unions::${{args.name}}.${{args.name}};
+''')
+
+code('''
 
 } // namespace debug
 } // namespace gem5
@@ -454,6 +454,15 @@ def addSEOptions(parser):
                         "to/host/dir1 --redirects /dir2=/path/to/host/dir2")
     parser.add_argument("--wait-gdb", default=False, action='store_true',
                         help="Wait for remote GDB to connect.")
+    parser.add_argument("--partition-cores", action="store_true",
+                        help="Simulate each core and its private caches "
+                        "in a separate thread. The partitions are not "
+                        "coherent with each other, so this is only suitable "
+                        "for multiprogrammed workloads.")
+    parser.add_argument("--partition-quantum", action="store", type=str,
+                        default="10ns",
+                        help="Synchronisation quantum (and boundary "
+                        "latency) used with --partition-cores.")
 
 
 def addFSOptions(parser):
@@ -531,3 +540,12 @@ def addFSOptions(parser):
     # Debug option
     parser.add_argument("--wait-gdb", default=False, action='store_true',
                         help="Wait for remote GDB to connect.")
+    parser.add_argument("--partition-cores", action="store_true",
+                        help="Simulate each core and its private caches "
+                        "in a separate thread. The partitions are not "
+                        "coherent with each other, so this is only suitable "
+                        "for multiprogrammed workloads.")
+    parser.add_argument("--partition-quantum", action="store", type=str,
+                        default="10ns",
+                        help="Synchronisation quantum (and boundary "
+                        "latency) used with --partition-cores.")
@@ -0,0 +1,146 @@
+# Copyright (c) 2026 The ECE565-Project Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+""" This file runs a workload on several cores sharing an L2 cache,
+fast-forwarding it with atomic CPUs while the caches are bypassed
+(atomic_noncaching). CacheWarmupProbes replay the accesses of the CPUs to
+their L1 caches, which functionally warms the L1s, the shared L2 and the
+snoop filter of the crossbar between them. The CPUs are then switched to
+timing CPUs, which start off with warm caches.
+
+By default, every core runs its own copy of 'hello'.
+"""
+
+import argparse
+import os
+
+import m5
+from m5.objects import *
+
+m5.util.addToPath('../')
+
+from common.Caches import *
+
+isa = str(m5.defines.buildEnv['TARGET_ISA']).lower()
+
+thispath = os.path.dirname(os.path.realpath(__file__))
+default_binary = os.path.join(thispath, '../../',
+    'tests/test-progs/hello/bin/', isa, 'linux/hello')
+
+parser = argparse.ArgumentParser(description=__doc__)
+parser.add_argument("binary", nargs='?', default=default_binary,
+                    help="Binary run on every core")
+parser.add_argument("--num-cpus", type=int, default=2,
+                    help="Number of cores")
+parser.add_argument("--warmup-ticks", type=int, default=1000000,
+                    help="Ticks to fast-forward while warming the caches")
+parser.add_argument("--l1-size", default='32kB', help="L1 cache size")
+parser.add_argument("--l2-size", default='256kB', help="L2 cache size")
+
+args = parser.parse_args()
+
+system = System()
+
+system.clk_domain = SrcClockDomain()
+system.clk_domain.clock = '1GHz'
+system.clk_domain.voltage_domain = VoltageDomain()
+
+# Caches are bypassed while fast-forwarding
+system.mem_mode = 'atomic_noncaching'
+system.mem_ranges = [AddrRange('512MB')]
+
+system.cpu = [AtomicSimpleCPU(cpu_id=i) for i in range(args.num_cpus)]
+system.switch_cpus = [TimingSimpleCPU(cpu_id=i, switched_out=True)
+                      for i in range(args.num_cpus)]
+
+system.l2bus = L2XBar()
+system.l2cache = L2Cache(size=args.l2_size)
+system.l2cache.cpu_side = system.l2bus.mem_side_ports
+
+system.membus = SystemXBar()
+system.l2cache.mem_side = system.membus.cpu_side_ports
+
+system.workload = SEWorkload.init_compatible(args.binary)
+
+for i, cpu in enumerate(system.cpu):
+    cpu.icache = L1_ICache(size=args.l1_size)
+    cpu.dcache = L1_DCache(size=args.l1_size)
+
+    # The monitors let the probes observe the accesses of the CPU, which
+    # reach memory directly while the caches are bypassed
+    cpu.icache_mon = CommMonitor()
+    cpu.dcache_mon = CommMonitor()
+    cpu.icache_port = cpu.icache_mon.cpu_side_port
+    cpu.dcache_port = cpu.dcache_mon.cpu_side_port
+    cpu.icache_mon.mem_side_port = cpu.icache.cpu_side
+    cpu.dcache_mon.mem_side_port = cpu.dcache.cpu_side
+    cpu.icache_warmup = CacheWarmupProbe(manager=cpu.icache_mon,
+                                         cache=cpu.icache)
+    cpu.dcache_warmup = CacheWarmupProbe(manager=cpu.dcache_mon,
+                                         cache=cpu.dcache)
+
+    cpu.icache.mem_side = system.l2bus.cpu_side_ports
+    cpu.dcache.mem_side = system.l2bus.cpu_side_ports
+
+    cpu.createInterruptController()
+    if isa == 'x86':
+        cpu.interrupts[0].pio = system.membus.mem_side_ports
+        cpu.interrupts[0].int_requestor = system.membus.cpu_side_ports
+        cpu.interrupts[0].int_responder = system.membus.mem_side_ports
+
+    process = Process(pid=100 + i)
+    process.cmd = [args.binary]
+    cpu.workload = process
+    cpu.createThreads()
+
+    switch_cpu = system.switch_cpus[i]
+    switch_cpu.workload = cpu.workload
+    switch_cpu.clk_domain = cpu.clk_domain
+    switch_cpu.isa = cpu.isa
+    switch_cpu.createThreads()
+
+system.system_port = system.membus.cpu_side_ports
+
+system.mem_ctrl = MemCtrl()
+system.mem_ctrl.dram = DDR3_1600_8x8()
+system.mem_ctrl.dram.range = system.mem_ranges[0]
+system.mem_ctrl.port = system.membus.mem_side_ports
+
+root = Root(full_system=False, system=system)
+m5.instantiate()
+
+print("Warming up the caches")
+exit_event = m5.simulate(args.warmup_ticks)
+if exit_event.getCause() != "simulate() limit reached":
+    m5.util.fatal("Workload exited while warming up the caches: %s" %
+                  exit_event.getCause())
+
+# Draining reads the data of the warmed blocks from memory
+print("Switching to timing CPUs @ tick %i" % m5.curTick())
+m5.switchCpus(system, list(zip(system.cpu, system.switch_cpus)))
+
+exit_event = m5.simulate()
+print('Exiting @ tick %i because %s' % (m5.curTick(), exit_event.getCause()))
@@ -269,4 +269,12 @@ if args.wait_gdb:
     system.workload.wait_for_remote_gdb = True
 
 root = Root(full_system = False, system = system)
+
+if args.partition_cores:
+    if args.ruby:
+        fatal("--partition-cores is only supported with classic caches")
+    from gem5.utils.partition import partition_cores
+    partition_cores(system.cpu, root=root,
+                    sim_quantum=args.partition_quantum)
+
 Simulation.run(args, root, system, FutureClass)
@@ -94,6 +94,11 @@ def define_options(parser):
         "--recycle-latency", type=int, default=10,
         help="Recycle latency for ruby controller input buffers")
 
+    parser.add_argument(
+        "--skip-idle-wakeups", action="store_true", default=False,
+        help="Stop waking up ruby controllers and routers while they "
+        "are quiescent")
+
     protocol = buildEnv['PROTOCOL']
     exec("from . import %s" % protocol)
     eval("%s.define_options(parser)" % protocol)
@@ -249,6 +254,11 @@ def create_system(options, full_system, system, piobus = None, dma_ports = [],
         ruby.phys_mem = SimpleMemory(range=system.mem_ranges[0],
                                      in_addr_map=False)
 
+    if options.skip_idle_wakeups:
+        for obj in ruby.descendants():
+            if isinstance(obj, ClockedObject):
+                obj.skip_idle_wakeups = True
+
 def create_directories(options, bootmem, ruby_system, system):
     dir_cntrl_nodes = []
     for i in range(options.num_dirs):
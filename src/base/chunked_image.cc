@@ -0,0 +1,400 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "base/chunked_image.hh"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+#include <thread>
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+// The layout of the file is shared with util/chunked_image.py.
+static_assert(sizeof(ChunkedImage::Header) == 40);
+static_assert(sizeof(ChunkedImage::ChunkEntry) == 16);
+
+namespace
+{
+
+unsigned
+numThreads(unsigned threads)
+{
+    if (threads)
+        return threads;
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+/** Run work(i) for i in [0, count) on up to threads threads. */
+template <typename F>
+void
+parallelFor(uint64_t count, unsigned threads, F work)
+{
+    threads = std::min<uint64_t>(threads, count);
+    if (threads <= 1) {
+        for (uint64_t i = 0; i < count; ++i)
+            work(i);
+        return;
+    }
+
+    std::atomic<uint64_t> next(0);
+    auto worker = [&]() {
+        for (uint64_t i = next++; i < count; i = next++)
+            work(i);
+    };
+
+    std::vector<std::thread> pool;
+    for (unsigned t = 1; t < threads; ++t)
+        pool.emplace_back(worker);
+    worker();
+    for (auto &thread : pool)
+        thread.join();
+}
+
+void
+preadAll(int fd, void *buf, size_t len, uint64_t offset,
+         const std::string &path)
+{
+    uint8_t *p = static_cast<uint8_t *>(buf);
+    while (len) {
+        ssize_t ret = pread(fd, p, len, offset);
+        if (ret < 0 && errno == EINTR)
+            continue;
+        fatal_if(ret <= 0, "Failed to read image '%s': %s", path,
+                 ret ? strerror(errno) : "unexpected end of file");
+        p += ret;
+        offset += ret;
+        len -= ret;
+    }
+}
+
+void
+pwriteAll(int fd, const void *buf, size_t len, uint64_t offset,
+          const std::string &path)
+{
+    const uint8_t *p = static_cast<const uint8_t *>(buf);
+    while (len) {
+        ssize_t ret = pwrite(fd, p, len, offset);
+        if (ret < 0 && errno == EINTR)
+            continue;
+        fatal_if(ret < 0, "Failed to write image '%s': %s", path,
+                 strerror(errno));
+        p += ret;
+        offset += ret;
+        len -= ret;
+    }
+}
+
+bool
+allZero(const uint8_t *data, uint64_t len)
+{
+    static const uint8_t zeros[256] = {};
+    while (len >= sizeof(zeros)) {
+        if (std::memcmp(data, zeros, sizeof(zeros)))
+            return false;
+        data += sizeof(zeros);
+        len -= sizeof(zeros);
+    }
+    return !std::memcmp(data, zeros, len);
+}
+
+} // anonymous namespace
+
+void
+ChunkedImage::write(const std::string &path, const uint8_t *data,
+                    uint64_t size, const WriteOptions &options)
+{
+    fatal_if(!options.chunkSize || !isPowerOf2(options.alignment),
+             "Invalid chunk size or alignment for image '%s'", path);
+
+    int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0664);
+    fatal_if(fd < 0, "Can't open image '%s' for writing: %s", path,
+             strerror(errno));
+
+    Header header;
+    std::memcpy(header.magic, magic, sizeof(magic));
+    header.version = version;
+    header.chunkSize = options.chunkSize;
+    header.alignment = options.alignment;
+    header.reserved = 0;
+    header.size = size;
+    header.numChunks = divCeil(size, (uint64_t)options.chunkSize);
+
+    std::vector<ChunkEntry> entries(header.numChunks);
+    uint64_t offset = roundUp(sizeof(header) +
+                              entries.size() * sizeof(ChunkEntry),
+                              (uint64_t)options.alignment);
+
+    // Chunks are compressed in batches by all threads, and written in
+    // order by this one, which bounds the memory used for buffers.
+    const unsigned threads = numThreads(options.threads);
+    const uint64_t batch_size = 4 * threads;
+    const uLong bound = compressBound(options.chunkSize);
+    std::vector<std::vector<uint8_t>> buffers(
+            options.level ? batch_size : 0, std::vector<uint8_t>(bound));
+
+    for (uint64_t base = 0; base < header.numChunks; base += batch_size) {
+        const uint64_t count =
+            std::min(batch_size, header.numChunks - base);
+
+        parallelFor(count, threads, [&](uint64_t i) {
+            const uint64_t chunk = base + i;
+            const uint64_t start = chunk * options.chunkSize;
+            const uint64_t len =
+                std::min<uint64_t>(options.chunkSize, size - start);
+            ChunkEntry &entry = entries[chunk];
+            std::memset(&entry, 0, sizeof(entry));
+
+            if (options.changed && !options.changed(chunk)) {
+                entry.encoding = Encoding::Unchanged;
+                return;
+            }
+
+            if (allZero(data + start, len)) {
+                entry.encoding = Encoding::Zero;
+                return;
+            }
+
+            entry.encoding = Encoding::Raw;
+            entry.storedSize = len;
+            if (!options.level)
+                return;
+
+            uLongf stored = bound;
+            int ret = compress2(buffers[i].data(), &stored, data + start,
+                                len, options.level);
+            panic_if(ret != Z_OK, "zlib compression failed: %d", ret);
+            // Keep incompressible chunks raw.
+            if (stored < len) {
+                entry.encoding = Encoding::Deflate;
+                entry.storedSize = stored;
+            }
+        });
+
+        for (uint64_t i = 0; i < count; ++i) {
+            const uint64_t chunk = base + i;
+            ChunkEntry &entry = entries[chunk];
+            if (entry.encoding == Encoding::Zero ||
+                    entry.encoding == Encoding::Unchanged) {
+                continue;
+            }
+
+            // Padding before raw chunks is left as a hole in the file.
+            const uint8_t *src = buffers.empty() ? nullptr :
+                buffers[i].data();
+            if (entry.encoding == Encoding::Raw) {
+                offset = roundUp(offset, (uint64_t)options.alignment);
+                src = data + chunk * options.chunkSize;
+            }
+
+            entry.offset = offset;
+            pwriteAll(fd, src, entry.storedSize, offset, path);
+            offset += entry.storedSize;
+        }
+    }
+
+    // The header and the index are written last, so an image which was
+    // not written completely is never mistaken for a valid one.
+    pwriteAll(fd, entries.data(), entries.size() * sizeof(ChunkEntry),
+              sizeof(header), path);
+    pwriteAll(fd, &header, sizeof(header), 0, path);
+
+    fatal_if(close(fd), "Failed to close image '%s': %s", path,
+             strerror(errno));
+}
+
+bool
+ChunkedImage::isImage(const std::string &path)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    char buf[sizeof(magic)];
+    bool match = pread(fd, buf, sizeof(buf), 0) == sizeof(buf) &&
+        !std::memcmp(buf, magic, sizeof(magic));
+    close(fd);
+    return match;
+}
+
+ChunkedImage::ChunkedImage(const std::string &path)
+    : _path(path), _fd(open(path.c_str(), O_RDONLY))
+{
+    fatal_if(_fd < 0, "Can't open image '%s': %s", path, strerror(errno));
+
+    preadAll(_fd, &header, sizeof(header), 0, path);
+    fatal_if(std::memcmp(header.magic, magic, sizeof(magic)),
+             "'%s' is not a chunked image", path);
+    fatal_if(header.version != version,
+             "Image '%s' has version %d, expected %d", path,
+             header.version, version);
+    fatal_if(header.numChunks !=
+             divCeil(header.size, (uint64_t)header.chunkSize),
+             "Image '%s' is corrupted", path);
+
+    entries.resize(header.numChunks);
+    preadAll(_fd, entries.data(), entries.size() * sizeof(ChunkEntry),
+             sizeof(header), path);
+}
+
+ChunkedImage::~ChunkedImage()
+{
+    close(_fd);
+}
+
+uint64_t
+ChunkedImage::chunkLength(uint64_t chunk) const
+{
+    const uint64_t start = chunk * header.chunkSize;
+    return std::min<uint64_t>(header.chunkSize, header.size - start);
+}
+
+bool
+ChunkedImage::isDelta() const
+{
+    return std::any_of(entries.begin(), entries.end(),
+                       [](const ChunkEntry &entry) {
+                           return entry.encoding == Encoding::Unchanged;
+                       });
+}
+
+void
+ChunkedImage::readChunk(uint8_t *dst, uint64_t chunk, bool fill_zero) const
+{
+    const ChunkEntry &entry = entries[chunk];
+    uint8_t *start = dst + chunk * header.chunkSize;
+    const uint64_t len = chunkLength(chunk);
+
+    switch (entry.encoding) {
+      case Encoding::Unchanged:
+        break;
+
+      case Encoding::Zero:
+        if (fill_zero)
+            std::memset(start, 0, len);
+        break;
+
+      case Encoding::Raw:
+        fatal_if(entry.storedSize != len,
+                 "Image '%s' is corrupted at chunk %d", _path, chunk);
+        preadAll(_fd, start, len, entry.offset, _path);
+        break;
+
+      case Encoding::Deflate:
+        {
+            std::vector<uint8_t> buf(entry.storedSize);
+            preadAll(_fd, buf.data(), buf.size(), entry.offset, _path);
+            uLongf decoded = len;
+            int ret = uncompress(start, &decoded, buf.data(), buf.size());
+            fatal_if(ret != Z_OK || decoded != len,
+                     "Image '%s' is corrupted at chunk %d", _path, chunk);
+        }
+        break;
+
+      default:
+        fatal("Image '%s' has an unknown encoding at chunk %d", _path,
+              chunk);
+    }
+}
+
+bool
+ChunkedImage::mappable(uint64_t page_size) const
+{
+    if (header.chunkSize % page_size || header.alignment % page_size)
+        return false;
+
+    for (uint64_t chunk = 0; chunk < entries.size(); ++chunk) {
+        const ChunkEntry &entry = entries[chunk];
+        if (entry.encoding == Encoding::Deflate ||
+                entry.encoding == Encoding::Unchanged) {
+            return false;
+        }
+        // A partial last chunk would map the end of a page past the
+        // end of the image.
+        if (entry.encoding == Encoding::Raw &&
+                chunkLength(chunk) % page_size) {
+            return false;
+        }
+    }
+    return true;
+}
+
+uint64_t
+ChunkedImage::mapPrivate(uint8_t *dst, uint64_t page_size) const
+{
+    assert(mappable(page_size));
+
+    uint64_t mappings = 0;
+    uint64_t chunk = 0;
+    while (chunk < entries.size()) {
+        if (entries[chunk].encoding != Encoding::Raw) {
+            ++chunk;
+            continue;
+        }
+
+        // Extend the run while the data of the chunks is contiguous.
+        const uint64_t first = chunk;
+        uint64_t len = chunkLength(chunk);
+        while (++chunk < entries.size() &&
+               entries[chunk].encoding == Encoding::Raw &&
+               entries[chunk].offset == entries[first].offset + len) {
+            len += chunkLength(chunk);
+        }
+
+        void *addr = mmap(dst + first * header.chunkSize, len,
+                          PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED,
+                          _fd, entries[first].offset);
+        fatal_if(addr == MAP_FAILED, "Failed to map image '%s': %s", _path,
+                 strerror(errno));
+        ++mappings;
+    }
+    return mappings;
+}
+
+void
+ChunkedImage::read(uint8_t *dst, unsigned threads, uint64_t first,
+                   uint64_t count, bool fill_zero) const
+{
+    count = std::min(count, header.numChunks - first);
+    parallelFor(count, numThreads(threads), [&](uint64_t i) {
+        readChunk(dst, first + i, fill_zero);
+    });
+}
+
+} // namespace gem5
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_CHUNKED_IMAGE_HH__
+#define __BASE_CHUNKED_IMAGE_HH__
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace gem5
+{
+
+/**
+ * A large binary image, such as the contents of a memory, stored as a
+ * sequence of fixed-size chunks which are compressed independently.
+ *
+ * Since every chunk stands on its own, an image is written and read by
+ * several threads at once, and chunks which only contain zeros take no
+ * space at all. An image may also be a delta over a previous image of
+ * the same size and chunk size, in which case the chunks which did not
+ * change are not stored either. A file starts with a Header, followed by one
+ * ChunkEntry per chunk and by the chunk data. The data of chunks which
+ * are stored uncompressed starts at an offset aligned to the alignment
+ * recorded in the header, so that they can be mapped into memory
+ * directly. All fields are stored in host byte order.
+ */
+class ChunkedImage
+{
+  public:
+    static constexpr char magic[8] = {'g', 'e', 'm', '5', 'C', 'I', 'M',
+                                      'G'};
+    static constexpr uint32_t version = 1;
+
+    /** How the data of a chunk is stored. */
+    enum class Encoding : uint8_t
+    {
+        Zero,     //!< All bytes are zero, nothing is stored.
+        Raw,      //!< Stored as is, at an aligned offset.
+        Deflate,  //!< Compressed by zlib.
+        Unchanged //!< Same as in the previous image, nothing stored.
+    };
+
+    struct Header
+    {
+        char magic[8];
+        uint32_t version;
+        /** Size of every chunk but possibly the last one. */
+        uint32_t chunkSize;
+        /** Alignment of the data of raw chunks in the file. */
+        uint32_t alignment;
+        uint32_t reserved;
+        /** Size of the whole image. */
+        uint64_t size;
+        uint64_t numChunks;
+    };
+
+    struct ChunkEntry
+    {
+        /** Offset of the data of the chunk in the file. */
+        uint64_t offset;
+        /** Number of bytes stored for the chunk. */
+        uint32_t storedSize;
+        Encoding encoding;
+        uint8_t reserved[3];
+    };
+
+    struct WriteOptions
+    {
+        /** zlib compression level, 0 stores all chunks uncompressed. */
+        int level = 1;
+        /** Number of compression threads, 0 for one per host CPU. */
+        unsigned threads = 0;
+        uint32_t chunkSize = 1 << 20;
+        uint32_t alignment = 4096;
+        /**
+         * If set, chunks for which this returns false are recorded as
+         * unchanged rather than stored, making the image a delta.
+         */
+        std::function<bool(uint64_t chunk)> changed;
+    };
+
+    /**
+     * Write an image to a file, replacing its contents. Calls fatal()
+     * if the file cannot be written.
+     */
+    static void write(const std::string &path, const uint8_t *data,
+                      uint64_t size, const WriteOptions &options);
+
+    /** Check whether a file starts with the magic of an image. */
+    static bool isImage(const std::string &path);
+
+    /**
+     * Open an image for reading. Calls fatal() if the file is not an
+     * image of a supported version.
+     */
+    explicit ChunkedImage(const std::string &path);
+    ~ChunkedImage();
+
+    ChunkedImage(const ChunkedImage &) = delete;
+    ChunkedImage &operator=(const ChunkedImage &) = delete;
+
+    const std::string &path() const { return _path; }
+    uint64_t size() const { return header.size; }
+    uint32_t chunkSize() const { return header.chunkSize; }
+    uint32_t alignment() const { return header.alignment; }
+    const std::vector<ChunkEntry> &chunks() const { return entries; }
+
+    /** File descriptor of the open image. */
+    int fd() const { return _fd; }
+
+    /** Size of the data covered by a chunk once decoded. */
+    uint64_t chunkLength(uint64_t chunk) const;
+
+    /**
+     * Decode a range of chunks into memory. Unchanged chunks are
+     * skipped. Zero chunks are skipped too unless fill_zero is set,
+     * in which case the destination is cleared.
+     *
+     * @param dst Start of the whole image in memory.
+     * @param threads Number of threads, 0 for one per host CPU.
+     * @param first First chunk to decode.
+     * @param count Number of chunks to decode, all the remaining
+     *        chunks by default.
+     * @param fill_zero Clear zero chunks, to apply a delta on top of
+     *        the previous image.
+     */
+    void read(uint8_t *dst, unsigned threads = 0, uint64_t first = 0,
+              uint64_t count = UINT64_MAX, bool fill_zero = false) const;
+
+    /**
+     * Check whether the image can be mapped by mapPrivate(), that is
+     * whether it is stored uncompressed and its chunks are aligned to
+     * pages of the given size.
+     */
+    bool mappable(uint64_t page_size) const;
+
+    /**
+     * Map the stored chunks of a mappable image copy-on-write over
+     * existing memory, which must be zero-filled and page aligned.
+     * Pages are only read from the file once they are touched, and
+     * clean pages are shared with other processes mapping the same
+     * image. Runs of contiguous chunks are covered by a single
+     * mapping.
+     *
+     * @param dst Start of the whole image in memory.
+     * @return Number of mappings created.
+     */
+    uint64_t mapPrivate(uint8_t *dst, uint64_t page_size) const;
+
+    /** Decode one chunk, dst points to the start of the image. */
+    void readChunk(uint8_t *dst, uint64_t chunk,
+                   bool fill_zero = false) const;
+
+    /** Check whether the image is a delta over a previous one. */
+    bool isDelta() const;
+
+  private:
+    const std::string _path;
+    int _fd;
+    Header header;
+    std::vector<ChunkEntry> entries;
+};
+
+} // namespace gem5
+
+#endif // __BASE_CHUNKED_IMAGE_HH__
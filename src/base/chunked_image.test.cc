@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "base/chunked_image.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/** A temporary file name, removed when the test ends. */
+class TempPath
+{
+  private:
+    std::string _path;
+
+  public:
+    TempPath()
+    {
+        char buf[] = "/tmp/chunked_image.XXXXXX";
+        int fd = mkstemp(buf);
+        close(fd);
+        _path = buf;
+    }
+
+    ~TempPath() { unlink(_path.c_str()); }
+
+    const std::string &path() const { return _path; }
+};
+
+/**
+ * An image with zero chunks, compressible chunks, random chunks and a
+ * partial last chunk.
+ */
+std::vector<uint8_t>
+makeData(uint64_t size, uint32_t chunk_size)
+{
+    std::vector<uint8_t> data(size, 0);
+    std::mt19937 rng(565);
+    for (uint64_t i = 0; i < size; ++i) {
+        switch ((i / chunk_size) % 3) {
+          case 0:
+            break;
+          case 1:
+            data[i] = i % 7;
+            break;
+          case 2:
+            data[i] = rng();
+            break;
+        }
+    }
+    return data;
+}
+
+void
+roundTrip(int level, unsigned threads)
+{
+    TempPath tmp;
+    ChunkedImage::WriteOptions options;
+    options.level = level;
+    options.threads = threads;
+    options.chunkSize = 8192;
+
+    const uint64_t size = 37 * options.chunkSize + 123;
+    auto data = makeData(size, options.chunkSize);
+    ChunkedImage::write(tmp.path(), data.data(), size, options);
+
+    ASSERT_TRUE(ChunkedImage::isImage(tmp.path()));
+    ChunkedImage image(tmp.path());
+    EXPECT_EQ(image.size(), size);
+    ASSERT_EQ(image.chunks().size(), 38);
+
+    for (uint64_t i = 0; i < image.chunks().size(); ++i) {
+        const auto &entry = image.chunks()[i];
+        switch (i % 3) {
+          case 0:
+            EXPECT_EQ(entry.encoding, ChunkedImage::Encoding::Zero);
+            break;
+          case 1:
+            EXPECT_EQ(entry.encoding, level ?
+                      ChunkedImage::Encoding::Deflate :
+                      ChunkedImage::Encoding::Raw);
+            break;
+          case 2:
+            EXPECT_EQ(entry.encoding, ChunkedImage::Encoding::Raw);
+            break;
+        }
+        if (entry.encoding == ChunkedImage::Encoding::Raw) {
+            EXPECT_EQ(entry.offset % image.alignment(), 0);
+        }
+    }
+
+    std::vector<uint8_t> restored(size, 0);
+    image.read(restored.data(), threads);
+    EXPECT_EQ(restored, data);
+}
+
+} // anonymous namespace
+
+TEST(ChunkedImageTest, RoundTripDeflate)
+{
+    roundTrip(1, 1);
+}
+
+TEST(ChunkedImageTest, RoundTripRaw)
+{
+    roundTrip(0, 1);
+}
+
+TEST(ChunkedImageTest, RoundTripParallel)
+{
+    roundTrip(6, 4);
+}
+
+/** Chunks can be decoded on their own. */
+TEST(ChunkedImageTest, ReadRange)
+{
+    TempPath tmp;
+    ChunkedImage::WriteOptions options;
+    options.chunkSize = 4096;
+    const uint64_t size = 10 * options.chunkSize;
+    auto data = makeData(size, options.chunkSize);
+    ChunkedImage::write(tmp.path(), data.data(), size, options);
+
+    ChunkedImage image(tmp.path());
+    std::vector<uint8_t> restored(size, 0);
+    image.read(restored.data(), 2, 4, 2);
+    for (uint64_t i = 0; i < size; ++i) {
+        bool in_range = i >= 4 * options.chunkSize &&
+            i < 6 * options.chunkSize;
+        ASSERT_EQ(restored[i], in_range ? data[i] : 0) << "at " << i;
+    }
+}
+
+/** Uncompressed images are mapped copy-on-write. */
+TEST(ChunkedImageTest, MapPrivate)
+{
+    const uint64_t page_size = sysconf(_SC_PAGE_SIZE);
+    TempPath tmp;
+    ChunkedImage::WriteOptions options;
+    options.level = 0;
+    options.chunkSize = 2 * page_size;
+    options.alignment = page_size;
+    const uint64_t size = 12 * options.chunkSize;
+    auto data = makeData(size, options.chunkSize);
+    ChunkedImage::write(tmp.path(), data.data(), size, options);
+
+    ChunkedImage image(tmp.path());
+    ASSERT_TRUE(image.mappable(page_size));
+
+    void *mem = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ASSERT_NE(mem, MAP_FAILED);
+    uint8_t *dst = static_cast<uint8_t *>(mem);
+
+    // Every third chunk is zero, so each pair of stored chunks is
+    // mapped at once.
+    EXPECT_EQ(image.mapPrivate(dst, page_size), 4);
+    EXPECT_EQ(std::vector<uint8_t>(dst, dst + size), data);
+
+    // Writes stay private to the mapping.
+    dst[options.chunkSize] ^= 0xff;
+    std::vector<uint8_t> restored(size, 0);
+    image.read(restored.data());
+    EXPECT_EQ(restored, data);
+
+    munmap(mem, size);
+}
+
+/** Compressed images cannot be mapped. */
+TEST(ChunkedImageTest, NotMappable)
+{
+    const uint64_t page_size = sysconf(_SC_PAGE_SIZE);
+    TempPath tmp;
+    ChunkedImage::WriteOptions options;
+    options.chunkSize = page_size;
+    const uint64_t size = 6 * options.chunkSize;
+    auto data = makeData(size, options.chunkSize);
+    ChunkedImage::write(tmp.path(), data.data(), size, options);
+
+    EXPECT_FALSE(ChunkedImage(tmp.path()).mappable(page_size));
+}
+
+/** A delta only stores the changed chunks, and clears zeroed ones. */
+TEST(ChunkedImageTest, Delta)
+{
+    TempPath base_tmp, delta_tmp;
+    ChunkedImage::WriteOptions options;
+    options.chunkSize = 4096;
+    const uint64_t size = 9 * options.chunkSize;
+    auto data = makeData(size, options.chunkSize);
+    ChunkedImage::write(base_tmp.path(), data.data(), size, options);
+
+    // Change chunk 1, zero chunk 2 and modify chunk 4 without flagging
+    // it, which the delta must not pick up.
+    auto next = data;
+    next[options.chunkSize] ^= 0xff;
+    std::fill(next.begin() + 2 * options.chunkSize,
+              next.begin() + 3 * options.chunkSize, 0);
+    next[4 * options.chunkSize] ^= 0xff;
+    options.changed = [](uint64_t chunk) {
+        return chunk == 1 || chunk == 2;
+    };
+    ChunkedImage::write(delta_tmp.path(), next.data(), size, options);
+
+    ChunkedImage base(base_tmp.path());
+    ChunkedImage delta(delta_tmp.path());
+    EXPECT_FALSE(base.isDelta());
+    EXPECT_TRUE(delta.isDelta());
+    EXPECT_FALSE(delta.mappable(4096));
+    EXPECT_EQ(delta.chunks()[0].encoding,
+              ChunkedImage::Encoding::Unchanged);
+    EXPECT_EQ(delta.chunks()[2].encoding, ChunkedImage::Encoding::Zero);
+
+    std::vector<uint8_t> restored(size, 0);
+    base.read(restored.data());
+    delta.read(restored.data(), 0, 0, UINT64_MAX, true);
+
+    next[4 * options.chunkSize] ^= 0xff;
+    EXPECT_EQ(restored, next);
+}
+
+TEST(ChunkedImageTest, NotAnImage)
+{
+    TempPath tmp;
+    EXPECT_FALSE(ChunkedImage::isImage(tmp.path()));
+    EXPECT_FALSE(ChunkedImage::isImage(tmp.path() + ".missing"));
+}
@@ -130,8 +130,9 @@ Flag::globalDisable()
         i.second->sync();
 }
 
-SimpleFlag::SimpleFlag(const char *name, const char *desc, bool is_format)
-  : Flag(name, desc), _isFormat(is_format)
+SimpleFlag::SimpleFlag(const char *name, const char *desc, bool is_format,
+                       bool compiled_out)
+  : Flag(name, desc), _isFormat(is_format), _compiledOut(compiled_out)
 {
     // Add non-format flags to the special "All" compound flag.
     if (!isFormat())
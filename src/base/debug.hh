@@ -46,6 +46,7 @@
 #include <iostream>
 #include <map>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "base/compiler.hh"
@@ -95,12 +96,16 @@ class SimpleFlag : public Flag
     /** Whether this flag changes debug formatting. */
     const bool _isFormat = false;
 
+    /** Whether the code guarded by this flag was compiled out. */
+    const bool _compiledOut = false;
+
     bool _enabled = false; // flag enablement status
 
     void sync() override { _tracing = _globalEnable && _enabled; }
 
   public:
-    SimpleFlag(const char *name, const char *desc, bool is_format=false);
+    SimpleFlag(const char *name, const char *desc, bool is_format=false,
+               bool compiled_out=false);
 
     void enable() override  { _enabled = true;  sync(); }
     void disable() override { _enabled = false; sync(); }
@@ -112,6 +117,15 @@ class SimpleFlag : public Flag
      * @return True if this flag is a debug-formatting flag.
      */
     bool isFormat() const { return _isFormat; }
+
+    /**
+     * Checks whether the build was configured to remove the code that
+     * this flag guards (see the TRACING_FLAGS build option). The flag
+     * can still be enabled, but DPRINTFs that use it print nothing.
+     *
+     * @return True if this flag was compiled out.
+     */
+    bool compiledOut() const { return _compiledOut; }
 };
 
 class CompoundFlag : public Flag
@@ -148,6 +162,54 @@ class AllFlagsFlag : public CompoundFlag
     static int version() { return _version; }
 };
 
+/**
+ * Stands in for a flag that was compiled out with the TRACING_FLAGS
+ * build option. Testing it always gives a constant false, so the compiler
+ * removes the DPRINTFs and other code it guards. The flag object itself
+ * still exists and is registered, so it can be listed, enabled and
+ * passed to code that takes a Flag.
+ */
+template <class FlagType>
+class DisabledFlag
+{
+  protected:
+    FlagType &flag;
+
+  public:
+    constexpr DisabledFlag(FlagType &_flag) : flag(_flag) {}
+
+    std::string name() const { return flag.name(); }
+    std::string desc() const { return flag.desc(); }
+
+    constexpr bool tracing() const { return false; }
+    constexpr operator bool() const { return false; }
+
+    void enable() const { flag.enable(); }
+    void disable() const { flag.disable(); }
+
+    operator FlagType &() const { return flag; }
+};
+
+template <class T>
+struct IsDisabledFlag : std::false_type {};
+
+template <class FlagType>
+struct IsDisabledFlag<DisabledFlag<FlagType>> : std::true_type {};
+
+/**
+ * The type of the debug::<name> handle of a flag: a reference to the flag
+ * itself, or a DisabledFlag if it was compiled out.
+ */
+template <class FlagType, bool CompiledOut>
+using FlagHandle = std::conditional_t<CompiledOut,
+      const DisabledFlag<FlagType>, const FlagType &>;
+
+/** A compound flag is compiled out if all of its kids are. */
+template <class ...Kids>
+constexpr bool allCompiledOut =
+    (IsDisabledFlag<std::remove_cv_t<std::remove_reference_t<Kids>>>::value
+     && ...);
+
 typedef std::map<std::string, Flag *> FlagsMap;
 FlagsMap &allFlags();
 
@@ -148,6 +148,44 @@ TEST(DebugFlagTest, ConversionOperator)
     flag.disable();
 }
 
+/** Test that a compiled out flag always tests false. */
+TEST(DebugFlagTest, DisabledFlag)
+{
+    debug::Flag::globalEnable();
+    debug::SimpleFlag flag("FlagDisabledFlagTest", "Desc", false, true);
+    const debug::DisabledFlag<debug::SimpleFlag> disabled(flag);
+
+    ASSERT_TRUE(flag.compiledOut());
+    ASSERT_EQ("FlagDisabledFlagTest", disabled.name());
+    ASSERT_EQ("Desc", disabled.desc());
+
+    // The flag itself can still be enabled, and code that holds a
+    // reference to it sees that.
+    disabled.enable();
+    const debug::Flag &ref = disabled;
+    ASSERT_TRUE(flag.tracing());
+    ASSERT_TRUE(ref.tracing());
+    ASSERT_FALSE(disabled);
+    ASSERT_FALSE(disabled.tracing());
+    disabled.disable();
+    ASSERT_FALSE(flag.tracing());
+}
+
+/** Test the types of the handles of kept and compiled out flags. */
+TEST(DebugFlagTest, FlagHandle)
+{
+    using Kept = debug::FlagHandle<debug::SimpleFlag, false>;
+    using Removed = debug::FlagHandle<debug::SimpleFlag, true>;
+    static_assert(std::is_same_v<Kept, const debug::SimpleFlag &>);
+    static_assert(!debug::allCompiledOut<Kept, Removed>);
+    static_assert(debug::allCompiledOut<Removed, Removed>);
+
+    static debug::SimpleFlag flag("FlagHandleTest", "", false, true);
+    static constexpr Removed handle = flag;
+    static_assert(!handle);
+    ASSERT_FALSE(debug::SimpleFlag("FlagHandleTest2", "").compiledOut());
+}
+
 /**
  * Tests that manipulate the kids to change the enablement status of the
  * compound flag.
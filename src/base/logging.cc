@@ -40,7 +40,9 @@
 
 #include "base/logging.hh"
 
+#include <atomic>
 #include <sstream>
+#include <vector>
 
 #include "base/hostinfo.hh"
 
@@ -49,6 +51,13 @@ namespace gem5
 
 namespace {
 
+std::vector<std::function<void()>> &
+exitHooks()
+{
+    static auto *hooks = new std::vector<std::function<void()>>;
+    return *hooks;
+}
+
 class ExitLogger : public Logger
 {
   public:
@@ -62,6 +71,8 @@ class ExitLogger : public Logger
         ccprintf(ss, "Memory Usage: %ld KBytes\n", memUsage());
         Logger::log(loc, s + ss.str());
     }
+
+    void exit() override { runExitHooks(); }
 };
 
 class FatalLogger : public ExitLogger
@@ -70,11 +81,33 @@ class FatalLogger : public ExitLogger
     using ExitLogger::ExitLogger;
 
   protected:
-    void exit() override { ::exit(1); }
+    void
+    exit() override
+    {
+        ExitLogger::exit();
+        ::exit(1);
+    }
 };
 
 } // anonymous namespace
 
+void
+Logger::addExitHook(const std::function<void()> &hook)
+{
+    exitHooks().push_back(hook);
+}
+
+void
+Logger::runExitHooks()
+{
+    static std::atomic<bool> ran(false);
+    if (ran.exchange(true))
+        return;
+
+    for (auto &hook : exitHooks())
+        hook();
+}
+
 // We intentionally put all the loggers on the heap to prevent them from being
 // destructed at the end of the program. This make them safe to be used inside
 // destructor of other global objects. Also, we make them function static
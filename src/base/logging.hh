@@ -42,6 +42,7 @@
 #define __BASE_LOGGING_HH__
 
 #include <cassert>
+#include <functional>
 #include <sstream>
 #include <tuple>
 #include <utility>
@@ -117,6 +118,18 @@ class Logger
         print(loc, format.c_str(), args...);
     }
 
+    /**
+     * Register a function to call when panic() or fatal() are about to end
+     * the simulation, e.g. to write out diagnostic state.
+     */
+    static void addExitHook(const std::function<void()> &hook);
+
+    /**
+     * Call the exit hooks. Only the first call has any effect, so this is
+     * safe to use from an abort handler that may run after a panic.
+     */
+    static void runExitHooks();
+
     /**
      * This helper is necessary since noreturn isn't inherited by virtual
      * functions, and gcc will get mad if a function calls panic and then
@@ -557,3 +557,29 @@ TEST(LoggingDeathTest, gem5Assert)
     ASSERT_DEATH(gem5_assert(false), ::testing::HasSubstr(
         "panic: assert(false) failed\nMemory Usage:"));
 }
+
+/** Test that panic and fatal run the exit hooks before exiting. */
+TEST(LoggingDeathTest, ExitHooks)
+{
+    auto hook = []() { std::cerr << "exit hook\n"; };
+    ASSERT_DEATH({
+            Logger::addExitHook(hook);
+            panic("message\n");
+        }, ::testing::HasSubstr("exit hook\n"));
+    ASSERT_DEATH({
+            Logger::addExitHook(hook);
+            fatal("message\n");
+        }, ::testing::HasSubstr("exit hook\n"));
+}
+
+/** Test that the exit hooks only run once. */
+TEST(LoggingDeathTest, ExitHooksOnce)
+{
+    ASSERT_DEATH({
+            Logger::addExitHook([]() { std::cerr << "hook ran\n"; });
+            Logger::runExitHooks();
+            Logger::runExitHooks();
+            std::cerr << "done\n";
+            ::abort();
+        }, "^hook ran\ndone\n$");
+}
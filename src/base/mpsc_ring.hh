@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_MPSC_RING_HH__
+#define __BASE_MPSC_RING_HH__
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "base/intmath.hh"
+
+namespace gem5
+{
+
+/**
+ * Bounded lock-free multi-producer single-consumer ring.
+ *
+ * Any number of threads may push() concurrently, while a single thread
+ * pops. Storage is allocated once at construction, so neither end of
+ * the ring allocates memory. Each slot carries a sequence number which
+ * tells producers whether the slot is free and the consumer whether it
+ * has been filled, so producers only contend on the shared tail index.
+ * Elements pushed by one thread are popped in the order they were
+ * pushed.
+ *
+ * @tparam T Type of the elements, must be cheap to copy.
+ */
+template <typename T>
+class MPSCRing
+{
+  private:
+    struct Slot
+    {
+        std::atomic<uint64_t> sequence;
+        T value;
+    };
+
+    const uint64_t mask;
+    std::unique_ptr<Slot[]> slots;
+
+    /** Next position to be claimed by a producer. */
+    alignas(64) std::atomic<uint64_t> tail;
+
+    /** Next position to be popped, only used by the consumer. */
+    alignas(64) uint64_t head;
+
+  public:
+    /**
+     * @param capacity Number of elements the ring can hold, must be a
+     *        power of two.
+     */
+    explicit MPSCRing(size_t capacity)
+        : mask(capacity - 1), slots(new Slot[capacity]), tail(0), head(0)
+    {
+        assert(isPowerOf2(capacity));
+        for (uint64_t i = 0; i < capacity; i++)
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    MPSCRing(const MPSCRing &) = delete;
+    MPSCRing &operator=(const MPSCRing &) = delete;
+
+    size_t capacity() const { return mask + 1; }
+
+    /**
+     * Check if all elements claimed by producers have been popped. This
+     * differs from pop() failing when a producer has claimed a slot but
+     * not filled it yet. Must only be called by the consumer thread.
+     */
+    bool
+    empty() const
+    {
+        return tail.load(std::memory_order_acquire) == head;
+    }
+
+    /**
+     * Append an element to the ring. Safe to call from any thread.
+     *
+     * @return false if the ring is full.
+     */
+    bool
+    push(const T &value)
+    {
+        uint64_t pos = tail.load(std::memory_order_relaxed);
+        Slot *slot;
+        while (true) {
+            slot = &slots[pos & mask];
+            const uint64_t seq =
+                slot->sequence.load(std::memory_order_acquire);
+            const int64_t diff = (int64_t)seq - (int64_t)pos;
+            if (diff == 0) {
+                // The slot is free, try to claim it.
+                if (tail.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // The slot still holds an element from the previous lap.
+                return false;
+            } else {
+                // Another producer claimed the slot first.
+                pos = tail.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->value = value;
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Remove the oldest element from the ring. Must only be called by
+     * the consumer thread.
+     *
+     * @return false if the ring is empty.
+     */
+    bool
+    pop(T &value)
+    {
+        Slot &slot = slots[head & mask];
+        const uint64_t seq = slot.sequence.load(std::memory_order_acquire);
+        if (seq != head + 1)
+            return false;
+
+        value = slot.value;
+        slot.sequence.store(head + mask + 1, std::memory_order_release);
+        head++;
+        return true;
+    }
+};
+
+} // namespace gem5
+
+#endif // __BASE_MPSC_RING_HH__
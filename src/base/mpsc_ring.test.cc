@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include "base/mpsc_ring.hh"
+
+using namespace gem5;
+
+/** Elements come out in the order they were pushed. */
+TEST(MPSCRingTest, Fifo)
+{
+    MPSCRing<int> ring(8);
+    EXPECT_EQ(ring.capacity(), 8);
+    EXPECT_TRUE(ring.empty());
+
+    for (int i = 0; i < 5; i++)
+        EXPECT_TRUE(ring.push(i));
+    EXPECT_FALSE(ring.empty());
+
+    int value;
+    for (int i = 0; i < 5; i++) {
+        ASSERT_TRUE(ring.pop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(ring.pop(value));
+    EXPECT_TRUE(ring.empty());
+}
+
+/** Pushing to a full ring fails without losing elements. */
+TEST(MPSCRingTest, Full)
+{
+    MPSCRing<int> ring(4);
+    for (int i = 0; i < 4; i++)
+        EXPECT_TRUE(ring.push(i));
+    EXPECT_FALSE(ring.push(4));
+
+    int value;
+    ASSERT_TRUE(ring.pop(value));
+    EXPECT_EQ(value, 0);
+    EXPECT_TRUE(ring.push(4));
+    EXPECT_FALSE(ring.push(5));
+
+    for (int i = 1; i < 5; i++) {
+        ASSERT_TRUE(ring.pop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(ring.pop(value));
+}
+
+/** Indices keep working after wrapping around the ring many times. */
+TEST(MPSCRingTest, WrapAround)
+{
+    MPSCRing<int> ring(4);
+    int value;
+    for (int i = 0; i < 1000; i++) {
+        ASSERT_TRUE(ring.push(i));
+        ASSERT_TRUE(ring.push(i + 1));
+        ASSERT_TRUE(ring.pop(value));
+        EXPECT_EQ(value, i);
+        ASSERT_TRUE(ring.pop(value));
+        EXPECT_EQ(value, i + 1);
+    }
+}
+
+/**
+ * Concurrent producers never lose elements and the elements of each
+ * producer are popped in the order that producer pushed them.
+ */
+TEST(MPSCRingTest, ConcurrentProducers)
+{
+    const int num_producers = 4;
+    const int per_producer = 20000;
+    MPSCRing<uint64_t> ring(64);
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < num_producers; p++) {
+        producers.emplace_back([&ring, p]() {
+            for (uint64_t i = 0; i < per_producer; i++) {
+                while (!ring.push(((uint64_t)p << 32) | i))
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    std::vector<uint64_t> next(num_producers, 0);
+    int popped = 0;
+    uint64_t value;
+    while (popped < num_producers * per_producer) {
+        if (!ring.pop(value)) {
+            std::this_thread::yield();
+            continue;
+        }
+        const int p = value >> 32;
+        ASSERT_EQ(value & 0xffffffff, next[p]);
+        next[p]++;
+        popped++;
+    }
+
+    for (auto &t : producers)
+        t.join();
+
+    EXPECT_FALSE(ring.pop(value));
+}
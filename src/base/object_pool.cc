@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "base/object_pool.hh"
+
+#include <cxxabi.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+
+#include "base/intmath.hh"
+
+namespace gem5
+{
+
+namespace
+{
+
+std::string
+demangle(const char *name)
+{
+    int status = 0;
+    char *demangled = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+    if (status != 0)
+        return name;
+    std::string result(demangled);
+    std::free(demangled);
+    return result;
+}
+
+} // anonymous namespace
+
+ObjectPool::Cache::Cache(ObjectPool &_pool)
+    : pool(_pool)
+{
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    pool.caches.push_back(this);
+}
+
+ObjectPool::Cache::~Cache()
+{
+    if (count)
+        pool.release(*this, count);
+
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    pool.retiredAllocs += allocs;
+    pool.retiredFrees += frees;
+    pool.caches.erase(
+        std::find(pool.caches.begin(), pool.caches.end(), this));
+}
+
+ObjectPool::ObjectPool(const char *type_name, size_t size)
+    : _name(demangle(type_name)),
+      blockSize(roundUp(std::max(size, sizeof(Block)),
+                        alignof(std::max_align_t)))
+{
+    std::lock_guard<std::mutex> lock(poolsMutex());
+    pools().push_back(this);
+}
+
+void
+ObjectPool::refill(Cache &cache)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (shared) {
+        // Take up to a slab worth of blocks from the shared list.
+        Block *last = shared;
+        size_t taken = 1;
+        while (taken < blocksPerSlab && last->next) {
+            last = last->next;
+            ++taken;
+        }
+        cache.head = shared;
+        shared = last->next;
+        last->next = nullptr;
+        cache.count = taken;
+        sharedCount -= taken;
+        return;
+    }
+
+    // The slab is deliberately never freed: blocks of it may be owned
+    // by objects which outlive the pool statistics.
+    char *slab = static_cast<char *>(
+            ::operator new(blockSize * blocksPerSlab));
+    slabCount.fetch_add(1, std::memory_order_relaxed);
+
+    for (size_t i = blocksPerSlab; i-- > 0; ) {
+        Block *block = reinterpret_cast<Block *>(slab + i * blockSize);
+        block->next = cache.head;
+        cache.head = block;
+    }
+    cache.count = blocksPerSlab;
+}
+
+void
+ObjectPool::release(Cache &cache, size_t count)
+{
+    Block *first = cache.head;
+    Block *last = first;
+    for (size_t i = 1; i < count; ++i)
+        last = last->next;
+    cache.head = last->next;
+    cache.count -= count;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    last->next = shared;
+    shared = first;
+    sharedCount += count;
+}
+
+uint64_t
+ObjectPool::allocations() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    uint64_t total = retiredAllocs;
+    for (const auto *cache : caches)
+        total += cache->allocs.load(std::memory_order_relaxed);
+    return total;
+}
+
+uint64_t
+ObjectPool::deallocations() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    uint64_t total = retiredFrees;
+    for (const auto *cache : caches)
+        total += cache->frees.load(std::memory_order_relaxed);
+    return total;
+}
+
+std::vector<ObjectPool *> &
+ObjectPool::pools()
+{
+    static std::vector<ObjectPool *> thePools;
+    return thePools;
+}
+
+std::mutex &
+ObjectPool::poolsMutex()
+{
+    static std::mutex theMutex;
+    return theMutex;
+}
+
+void
+ObjectPool::dumpAll(std::ostream &os)
+{
+    std::lock_guard<std::mutex> lock(poolsMutex());
+
+    os << std::left << std::setw(48) << "# type" << std::right
+       << std::setw(14) << "allocs" << std::setw(14) << "frees"
+       << std::setw(10) << "slabs" << std::setw(12) << "fallbacks"
+       << std::setw(10) << "bytes" << "\n";
+
+    for (const auto *pool : pools()) {
+        os << std::left << std::setw(48) << pool->name() << std::right
+           << std::setw(14) << pool->allocations()
+           << std::setw(14) << pool->deallocations()
+           << std::setw(10) << pool->slabs()
+           << std::setw(12) << pool->fallbackAllocations()
+           << std::setw(10)
+           << pool->slabs() * pool->blockSize * blocksPerSlab << "\n";
+    }
+}
+
+uint64_t
+ObjectPool::totalAllocations()
+{
+    std::lock_guard<std::mutex> lock(poolsMutex());
+    uint64_t total = 0;
+    for (const auto *pool : pools())
+        total += pool->allocations();
+    return total;
+}
+
+uint64_t
+ObjectPool::totalSlabs()
+{
+    std::lock_guard<std::mutex> lock(poolsMutex());
+    uint64_t total = 0;
+    for (const auto *pool : pools())
+        total += pool->slabs();
+    return total;
+}
+
+} // namespace gem5
@@ -0,0 +1,281 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_OBJECT_POOL_HH__
+#define __BASE_OBJECT_POOL_HH__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+namespace gem5
+{
+
+/**
+ * Fixed-size block allocator backing objects which are created and
+ * destroyed at a high rate, such as events, packets and requests.
+ *
+ * Memory is carved out of slabs of blocks which are never returned to
+ * the system. Every thread allocates from and frees to its own cache
+ * of free blocks, so the common path takes no lock. Since each event
+ * queue is serviced by a single thread, the cache is effectively per
+ * event queue. A cache which grows beyond a high-water mark, for
+ * instance because objects are allocated by one thread and deleted by
+ * another, hands half of its blocks back to a list shared by all
+ * threads, from which empty caches refill before carving a new slab.
+ */
+class ObjectPool
+{
+  public:
+    /** Number of blocks in a slab, and in a refill from the shared list. */
+    static constexpr size_t blocksPerSlab = 64;
+
+    /** Size a thread cache may grow to before it is trimmed. */
+    static constexpr size_t highWater = 4 * blocksPerSlab;
+
+  private:
+    struct Block
+    {
+        Block *next;
+    };
+
+  public:
+    /** Per-thread cache of free blocks. */
+    class Cache
+    {
+      private:
+        friend class ObjectPool;
+
+        ObjectPool &pool;
+        Block *head = nullptr;
+        size_t count = 0;
+
+        /**
+         * Allocation counters. Only written by the owning thread, they
+         * are atomic so that the summary at exit may read them.
+         */
+        std::atomic<uint64_t> allocs{0};
+        std::atomic<uint64_t> frees{0};
+
+        void
+        bump(std::atomic<uint64_t> &counter)
+        {
+            counter.store(counter.load(std::memory_order_relaxed) + 1,
+                          std::memory_order_relaxed);
+        }
+
+      public:
+        explicit Cache(ObjectPool &_pool);
+        ~Cache();
+
+        Cache(const Cache &) = delete;
+        Cache &operator=(const Cache &) = delete;
+    };
+
+    /**
+     * @param type_name Mangled name of the pooled type, used to label
+     *        the statistics.
+     * @param size Size of the objects served by the pool.
+     */
+    ObjectPool(const char *type_name, size_t size);
+
+    ObjectPool(const ObjectPool &) = delete;
+    ObjectPool &operator=(const ObjectPool &) = delete;
+
+    void *
+    allocate(Cache &cache)
+    {
+        if (!cache.head)
+            refill(cache);
+
+        Block *block = cache.head;
+        cache.head = block->next;
+        --cache.count;
+        cache.bump(cache.allocs);
+        return block;
+    }
+
+    void
+    deallocate(Cache &cache, void *ptr)
+    {
+        Block *block = static_cast<Block *>(ptr);
+        block->next = cache.head;
+        cache.head = block;
+        cache.bump(cache.frees);
+        if (++cache.count > highWater)
+            release(cache, cache.count / 2);
+    }
+
+    /** Count an object of a derived type served by the global heap. */
+    void
+    countFallback()
+    {
+        fallbacks.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    const std::string &name() const { return _name; }
+
+    /** Number of objects handed out by the pool. */
+    uint64_t allocations() const;
+
+    /** Number of objects given back to the pool. */
+    uint64_t deallocations() const;
+
+    /** Number of slabs taken from the system heap. */
+    uint64_t slabs() const { return slabCount; }
+
+    /** Number of objects which bypassed the pool. */
+    uint64_t fallbackAllocations() const { return fallbacks; }
+
+    /** Print a summary of all pools in the simulator. */
+    static void dumpAll(std::ostream &os);
+
+    /** Number of objects handed out by all pools. */
+    static uint64_t totalAllocations();
+
+    /** Number of slabs taken from the system heap by all pools. */
+    static uint64_t totalSlabs();
+
+  private:
+    const std::string _name;
+
+    /** Size of a block, rounded to keep every block suitably aligned. */
+    const size_t blockSize;
+
+    /** Protects the shared list, the slab count and the caches. */
+    mutable std::mutex mutex;
+
+    /** Blocks released by thread caches. */
+    Block *shared = nullptr;
+    size_t sharedCount = 0;
+
+    std::atomic<uint64_t> slabCount{0};
+    std::atomic<uint64_t> fallbacks{0};
+
+    /** Live thread caches, plus the totals of the ones that exited. */
+    std::vector<Cache *> caches;
+    uint64_t retiredAllocs = 0;
+    uint64_t retiredFrees = 0;
+
+    /** Fill an empty cache from the shared list or from a new slab. */
+    void refill(Cache &cache);
+
+    /** Move count blocks from a cache to the shared list. */
+    void release(Cache &cache, size_t count);
+
+    static std::vector<ObjectPool *> &pools();
+    static std::mutex &poolsMutex();
+};
+
+/**
+ * Allocator handing out single objects from an ObjectPool, for use
+ * with std::allocate_shared and node-based containers. Requests for
+ * more than one object are served by the global heap.
+ *
+ * The allocator is stateless: every rebound type gets a pool of its
+ * own, labelled with the name of the Owner type in the statistics.
+ *
+ * @tparam T The type of the allocated objects.
+ * @tparam Owner The type the pool is accounted to.
+ */
+template <class T, class Owner = T>
+class PoolAllocator
+{
+  public:
+    using value_type = T;
+
+    template <class U>
+    struct rebind
+    {
+        using other = PoolAllocator<U, Owner>;
+    };
+
+    PoolAllocator() = default;
+
+    template <class U>
+    PoolAllocator(const PoolAllocator<U, Owner> &) {}
+
+    T *
+    allocate(size_t n)
+    {
+        if (n != 1)
+            return static_cast<T *>(::operator new(n * sizeof(T)));
+        return static_cast<T *>(pool().allocate(cache()));
+    }
+
+    void
+    deallocate(T *ptr, size_t n)
+    {
+        if (n != 1)
+            ::operator delete(ptr);
+        else
+            pool().deallocate(cache(), ptr);
+    }
+
+    static ObjectPool &
+    pool()
+    {
+        static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__,
+                      "Pooled objects may not be over-aligned");
+        static ObjectPool thePool(typeid(Owner).name(), sizeof(T));
+        return thePool;
+    }
+
+  private:
+    static ObjectPool::Cache &
+    cache()
+    {
+        static thread_local ObjectPool::Cache theCache(pool());
+        return theCache;
+    }
+};
+
+template <class T, class U, class Owner>
+bool
+operator==(const PoolAllocator<T, Owner> &,
+           const PoolAllocator<U, Owner> &)
+{
+    return true;
+}
+
+template <class T, class U, class Owner>
+bool
+operator!=(const PoolAllocator<T, Owner> &,
+           const PoolAllocator<U, Owner> &)
+{
+    return false;
+}
+
+} // namespace gem5
+
+#endif // __BASE_OBJECT_POOL_HH__
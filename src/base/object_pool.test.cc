@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <set>
+#include <sstream>
+#include <vector>
+
+#include "base/object_pool.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+struct Payload
+{
+    uint64_t value;
+    explicit Payload(uint64_t _value) : value(_value) {}
+};
+
+using PayloadAllocator = PoolAllocator<Payload>;
+
+std::shared_ptr<Payload>
+makePayload(uint64_t value)
+{
+    return std::allocate_shared<Payload>(PayloadAllocator(), value);
+}
+
+} // anonymous namespace
+
+/** Shared objects come from the pool, and are recycled once released. */
+TEST(ObjectPoolTest, AllocateShared)
+{
+    makePayload(0);
+    uint64_t allocs = ObjectPool::totalAllocations();
+    uint64_t slabs = ObjectPool::totalSlabs();
+
+    for (uint64_t i = 0; i < 10000; i++) {
+        auto payload = makePayload(i);
+        EXPECT_EQ(payload->value, i);
+    }
+
+    EXPECT_EQ(ObjectPool::totalAllocations() - allocs, 10000U);
+    EXPECT_EQ(ObjectPool::totalSlabs(), slabs);
+
+    std::ostringstream os;
+    ObjectPool::dumpAll(os);
+    EXPECT_NE(os.str().find("Payload"), std::string::npos);
+}
+
+/** Live objects never share a block. */
+TEST(ObjectPoolTest, DistinctBlocks)
+{
+    std::vector<std::shared_ptr<Payload>> payloads;
+    std::set<Payload *> addrs;
+    for (uint64_t i = 0; i < 3 * ObjectPool::blocksPerSlab; i++) {
+        payloads.push_back(makePayload(i));
+        EXPECT_TRUE(addrs.insert(payloads.back().get()).second);
+    }
+    for (uint64_t i = 0; i < payloads.size(); i++)
+        EXPECT_EQ(payloads[i]->value, i);
+}
+
+/** Arrays are served by the heap, leaving the pool untouched. */
+TEST(ObjectPoolTest, Arrays)
+{
+    ObjectPool &pool = PayloadAllocator::pool();
+    uint64_t allocs = pool.allocations();
+
+    std::vector<Payload, PayloadAllocator> payloads;
+    payloads.reserve(100);
+    for (uint64_t i = 0; i < 100; i++)
+        payloads.emplace_back(i);
+
+    EXPECT_EQ(pool.allocations(), allocs);
+    EXPECT_GE(ObjectPool::totalAllocations(), allocs);
+}
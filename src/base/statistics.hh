@@ -78,6 +78,7 @@
 #include "base/cprintf.hh"
 #include "base/intmath.hh"
 #include "base/logging.hh"
+#include "base/stats/arena.hh"
 #include "base/stats/group.hh"
 #include "base/stats/info.hh"
 #include "base/stats/output.hh"
@@ -113,6 +114,13 @@ class InfoProxy : public Base
         visitor.visit(*static_cast<Base *>(this));
     }
     bool zero() const { return s.zero(); }
+
+    void
+    filter()
+    {
+        Base::filter();
+        s.filter();
+    }
 };
 
 template <class Stat>
@@ -222,6 +230,12 @@ class InfoAccess
      * @return true for success
      */
     bool check() const { return true; }
+
+    /**
+     * Stop recording updates to this stat. Only implemented by stats
+     * where skipping an update saves more than it costs to check.
+     */
+    void filter() { }
 };
 
 template <class Derived, template <class> class InfoProxyType>
@@ -435,6 +449,23 @@ class DataWrapVec : public DataWrap<Derived, InfoProxyType>
         return this->self();
     }
 
+    /**
+     * Mark this stat as frequently updated. When arena-backed storage
+     * is enabled, the storage of hot stats is packed together with
+     * the other hot stats of the same group instead of sitting next
+     * to rarely touched counters. Must be called before init().
+     * @return A reference to this stat.
+     */
+    Derived &
+    hot()
+    {
+        Derived &self = this->self();
+        fatal_if(self.check(), "Stat %s has already been initialized",
+                 this->info()->name);
+        self.storage.hot(true);
+        return self;
+    }
+
     void
     prepare()
     {
@@ -932,7 +963,7 @@ class VectorBase : public DataWrapVec<Derived, VectorInfoProxy>
 
   protected:
     /** The storage of this stat. */
-    std::vector<Storage*> storage;
+    StorageArray<Storage> storage;
 
   protected:
     /**
@@ -955,9 +986,7 @@ class VectorBase : public DataWrapVec<Derived, VectorInfoProxy>
         fatal_if(s <= 0, "Storage size must be positive");
         fatal_if(check(), "Stat has already been initialized");
 
-        storage.reserve(s);
-        for (size_type i = 0; i < s; ++i)
-            storage.push_back(new Storage(this->info()->getStorageParams()));
+        storage.init(s, this->info()->getStorageParams());
 
         this->setInit();
     }
@@ -1021,16 +1050,9 @@ class VectorBase : public DataWrapVec<Derived, VectorInfoProxy>
                const units::Base *unit,
                const char *desc)
         : DataWrapVec<Derived, VectorInfoProxy>(parent, name, unit, desc),
-          storage()
+          storage(parent)
     {}
 
-    ~VectorBase()
-    {
-        for (auto& stor : storage) {
-            delete stor;
-        }
-    }
-
     /**
      * Set this vector to have the given size.
      * @param size The new size.
@@ -1149,7 +1171,7 @@ class Vector2dBase : public DataWrapVec2d<Derived, Vector2dInfoProxy>
   protected:
     size_type x;
     size_type y;
-    std::vector<Storage*> storage;
+    StorageArray<Storage> storage;
 
   protected:
     Storage *data(off_type index) { return storage[index]; }
@@ -1160,16 +1182,9 @@ class Vector2dBase : public DataWrapVec2d<Derived, Vector2dInfoProxy>
                  const units::Base *unit,
                  const char *desc)
         : DataWrapVec2d<Derived, Vector2dInfoProxy>(parent, name, unit, desc),
-          x(0), y(0), storage()
+          x(0), y(0), storage(parent)
     {}
 
-    ~Vector2dBase()
-    {
-        for (auto& stor : storage) {
-            delete stor;
-        }
-    }
-
     Derived &
     init(size_type _x, size_type _y)
     {
@@ -1184,9 +1199,7 @@ class Vector2dBase : public DataWrapVec2d<Derived, Vector2dInfoProxy>
         info->x = _x;
         info->y = _y;
 
-        storage.reserve(x * y);
-        for (size_type i = 0; i < x * y; ++i)
-            storage.push_back(new Storage(this->info()->getStorageParams()));
+        storage.init(x * y, this->info()->getStorageParams());
 
         this->setInit();
 
@@ -1282,6 +1295,9 @@ class DistBase : public DataWrap<Derived, DistInfoProxy>
     /** The storage for this stat. */
     GEM5_ALIGNED(8) char storage[sizeof(Storage)];
 
+    /** Samples are dropped, see filter(). */
+    bool disabled;
+
   protected:
     /**
      * Retrieve the storage.
@@ -1314,7 +1330,8 @@ class DistBase : public DataWrap<Derived, DistInfoProxy>
     DistBase(Group *parent, const char *name,
              const units::Base *unit,
              const char *desc)
-        : DataWrap<Derived, DistInfoProxy>(parent, name, unit, desc)
+        : DataWrap<Derived, DistInfoProxy>(parent, name, unit, desc),
+          disabled(false)
     {
     }
 
@@ -1325,7 +1342,14 @@ class DistBase : public DataWrap<Derived, DistInfoProxy>
      * @param n The number of times to add it, defaults to 1.
      */
     template <typename U>
-    void sample(const U &v, int n = 1) { data()->sample(v, n); }
+    void
+    sample(const U &v, int n = 1)
+    {
+        if (GEM5_LIKELY(!disabled))
+            data()->sample(v, n);
+    }
+
+    void filter() { disabled = true; }
 
     /**
      * Return the number of entries in this stat.
@@ -1375,7 +1399,10 @@ class VectorDistBase : public DataWrapVec<Derived, VectorDistInfoProxy>
     friend class DataWrapVec<Derived, VectorDistInfoProxy>;
 
   protected:
-    std::vector<Storage*> storage;
+    StorageArray<Storage> storage;
+
+    /** Samples are dropped, see filter(). */
+    bool disabled;
 
   protected:
     Storage *
@@ -1396,9 +1423,7 @@ class VectorDistBase : public DataWrapVec<Derived, VectorDistInfoProxy>
         fatal_if(s <= 0, "Storage size must be positive");
         fatal_if(check(), "Stat has already been initialized");
 
-        storage.reserve(s);
-        for (size_type i = 0; i < s; ++i)
-            storage.push_back(new Storage(this->info()->getStorageParams()));
+        storage.init(s, this->info()->getStorageParams());
 
         this->setInit();
     }
@@ -1408,15 +1433,10 @@ class VectorDistBase : public DataWrapVec<Derived, VectorDistInfoProxy>
                    const units::Base *unit,
                    const char *desc)
         : DataWrapVec<Derived, VectorDistInfoProxy>(parent, name, unit, desc),
-          storage()
+          storage(parent), disabled(false)
     {}
 
-    ~VectorDistBase()
-    {
-        for (auto& stor : storage) {
-            delete stor;
-        }
-    }
+    void filter() { disabled = true; }
 
     Proxy operator[](off_type index)
     {
@@ -1489,7 +1509,8 @@ class DistProxy
     void
     sample(const U &v, int n = 1)
     {
-        data()->sample(v, n);
+        if (GEM5_LIKELY(!stat.disabled))
+            data()->sample(v, n);
     }
 
     size_type
@@ -2419,6 +2440,9 @@ class SparseHistBase : public DataWrap<Derived, SparseHistInfoProxy>
     /** The storage for this stat. */
     char storage[sizeof(Storage)];
 
+    /** Samples are dropped, see filter(). */
+    bool disabled;
+
   protected:
     /**
      * Retrieve the storage.
@@ -2451,7 +2475,8 @@ class SparseHistBase : public DataWrap<Derived, SparseHistInfoProxy>
     SparseHistBase(Group *parent, const char *name,
                    const units::Base *unit,
                    const char *desc)
-        : DataWrap<Derived, SparseHistInfoProxy>(parent, name, unit, desc)
+        : DataWrap<Derived, SparseHistInfoProxy>(parent, name, unit, desc),
+          disabled(false)
     {
     }
 
@@ -2462,7 +2487,14 @@ class SparseHistBase : public DataWrap<Derived, SparseHistInfoProxy>
      * @param n The number of times to add it, defaults to 1.
      */
     template <typename U>
-    void sample(const U &v, int n = 1) { data()->sample(v, n); }
+    void
+    sample(const U &v, int n = 1)
+    {
+        if (GEM5_LIKELY(!disabled))
+            data()->sample(v, n);
+    }
+
+    void filter() { disabled = true; }
 
     /**
      * Return the number of entries in this stat.
@@ -2530,6 +2562,192 @@ class SparseHistogram : public SparseHistBase<SparseHistogram, SparseHistStor>
     }
 };
 
+/**
+ * Implementation of a quantile sketch stat. The stat is reported as a
+ * vector holding the number of samples, their mean, minimum and
+ * maximum, followed by the estimated quantiles.
+ * @sa SketchStor
+ */
+template <class Derived, class Stor>
+class QuantileSketchBase : public DataWrapVec<Derived, VectorInfoProxy>
+{
+  public:
+    typedef VectorInfoProxy<Derived> Info;
+    typedef Stor Storage;
+    typedef typename Stor::Params Params;
+
+  protected:
+    /** The storage for this stat. */
+    GEM5_ALIGNED(8) char storage[sizeof(Storage)];
+
+    /** Samples are dropped, see filter(). */
+    bool disabled;
+
+  protected:
+    /**
+     * Retrieve the storage.
+     * @return The storage object for this stat.
+     */
+    Storage *
+    data()
+    {
+        return reinterpret_cast<Storage *>(storage);
+    }
+
+    /**
+     * Retrieve a const pointer to the storage.
+     * @return A const pointer to the storage object for this stat.
+     */
+    const Storage *
+    data() const
+    {
+        return reinterpret_cast<const Storage *>(storage);
+    }
+
+    const Params *
+    params() const
+    {
+        return safe_cast<const Params *>(this->info()->getStorageParams());
+    }
+
+    void
+    doInit()
+    {
+        new (storage) Storage(this->info()->getStorageParams());
+        this->setInit();
+    }
+
+  public:
+    QuantileSketchBase(Group *parent, const char *name,
+                       const units::Base *unit,
+                       const char *desc)
+        : DataWrapVec<Derived, VectorInfoProxy>(parent, name, unit, desc),
+          disabled(false)
+    {
+    }
+
+    /**
+     * Add a value to the sketch n times. Calls sample on the storage
+     * class.
+     * @param v The value to add.
+     * @param n The number of times to add it, defaults to 1.
+     */
+    template <typename U>
+    void
+    sample(const U &v, int n = 1)
+    {
+        if (GEM5_LIKELY(!disabled))
+            data()->sample(v, n);
+    }
+
+    void filter() { disabled = true; }
+
+    /**
+     * Estimate a quantile of the sampled values.
+     * @param q The quantile, in [0, 1].
+     * @return The estimated value.
+     */
+    Counter quantile(double q) const { return data()->quantile(q); }
+
+    /**
+     * Return the number of entries in this stat.
+     * @return The number of entries.
+     */
+    size_type size() const { return 4 + params()->quantiles.size(); }
+
+    /**
+     * Return true if no samples have been added.
+     * @return True if there haven't been any samples.
+     */
+    bool zero() const { return data()->zero(); }
+
+    void value(VCounter &vec) const { data()->prepare(params(), vec); }
+    void result(VResult &vec) const { data()->prepare(params(), vec); }
+
+    /**
+     * Return the number of samples.
+     * @return The number of samples.
+     */
+    Result total() const { return data()->count(); }
+
+    void prepare() {}
+
+    /**
+     * Reset stat value to default
+     */
+    void
+    reset()
+    {
+        data()->reset(this->info()->getStorageParams());
+    }
+
+    /**
+     *  Add the samples of the argument sketch to this sketch.
+     */
+    void add(QuantileSketchBase &d) { data()->add(d.data()); }
+};
+
+class QuantileSketch : public QuantileSketchBase<QuantileSketch, SketchStor>
+{
+  public:
+    QuantileSketch(Group *parent = nullptr)
+        : QuantileSketchBase<QuantileSketch, SketchStor>(parent, nullptr,
+            units::Unspecified::get(), nullptr)
+    {
+    }
+
+    QuantileSketch(Group *parent, const char *name,
+                   const char *desc = nullptr)
+        : QuantileSketchBase<QuantileSketch, SketchStor>(parent, name,
+            units::Unspecified::get(), desc)
+    {
+    }
+
+    QuantileSketch(Group *parent, const char *name, const units::Base *unit,
+                   const char *desc = nullptr)
+        : QuantileSketchBase<QuantileSketch, SketchStor>(parent, name, unit,
+                                                         desc)
+    {
+    }
+
+    /**
+     * Set the parameters of this sketch. @sa SketchStor::Params
+     * @param quantiles The quantiles to report, each in [0, 1].
+     * @param accuracy The relative accuracy of the estimates.
+     * @param buckets The maximum number of buckets for each sign.
+     * @return A reference to this sketch.
+     */
+    QuantileSketch &
+    init(const std::vector<double> &quantiles = {0.5, 0.9, 0.99, 0.999},
+         double accuracy = 0.01, size_type buckets = 1024)
+    {
+        SketchStor::Params *params =
+            new SketchStor::Params(quantiles, accuracy, buckets);
+        this->setParams(params);
+        this->doInit();
+
+        this->subname(0, "samples");
+        this->subname(1, "mean");
+        this->subname(2, "min");
+        this->subname(3, "max");
+        for (off_type i = 0; i < quantiles.size(); ++i) {
+            // '.' separates the levels of stat names, so the 99.9th
+            // percentile is named p99_9
+            std::string name = csprintf("p%g", quantiles[i] * 100);
+            std::replace(name.begin(), name.end(), '.', '_');
+
+            const std::vector<std::string> &subnames =
+                this->info()->subnames;
+            fatal_if(std::find(subnames.begin(), subnames.end(), name) !=
+                     subnames.end(),
+                     "Quantile %.10g of stat %s is named %s, like another "
+                     "quantile", quantiles[i], this->info()->name, name);
+            this->subname(4 + i, name);
+        }
+        return this->self();
+    }
+};
+
 class Temp;
 /**
  * A formula for statistics that is calculated when printed. A formula is
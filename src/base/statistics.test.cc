@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "base/gtest/logging.hh"
+#include "base/statistics.hh"
+#include "sim/root.hh"
+
+using namespace gem5;
+
+// statistics::resolve() looks stats up from the root object, which is
+// not needed here.
+Root *Root::_root = nullptr;
+
+namespace
+{
+
+struct FormulaGroup : public statistics::Group
+{
+    FormulaGroup()
+      : statistics::Group(nullptr),
+        ADD_STAT(operand, statistics::units::Count::get(), "Operand"),
+        ADD_STAT(doubled, statistics::units::Count::get(), "Formula",
+                 operand * 2)
+    {
+    }
+
+    statistics::Scalar operand;
+    statistics::Formula doubled;
+};
+
+} // anonymous namespace
+
+/**
+ * Test that a formula over a filtered operand only covers the samples
+ * since the last reset, like the formula would without the filter.
+ */
+TEST(StatisticsTest, FormulaOverFilteredOperand)
+{
+    FormulaGroup group;
+    group.operand.flags(statistics::filtered);
+
+    group.operand += 5;
+    ASSERT_EQ(group.doubled.total(), 10);
+
+    group.resetStats();
+    group.operand += 2;
+    ASSERT_EQ(group.doubled.total(), 4);
+}
+
+/**
+ * Test that quantiles are named without the '.' that separates the
+ * levels of stat names.
+ */
+TEST(StatisticsTest, QuantileSketchSubnames)
+{
+    statistics::Group group(nullptr);
+    statistics::QuantileSketch sketch(&group, "sketch");
+    sketch.init();
+
+    const std::vector<std::string> expected =
+        {"samples", "mean", "min", "max", "p50", "p90", "p99", "p99_9"};
+    ASSERT_EQ(group.getStats().size(), 1U);
+    auto *info =
+        dynamic_cast<statistics::VectorInfo *>(group.getStats()[0]);
+    ASSERT_NE(info, nullptr);
+    ASSERT_EQ(info->subnames, expected);
+}
+
+/** Test that quantiles which would share a name are rejected. */
+TEST(StatisticsTest, QuantileSketchDuplicateSubnames)
+{
+    statistics::Group group(nullptr);
+    statistics::QuantileSketch sketch(&group, "sketch");
+
+    gtestLogOutput.str("");
+    ASSERT_ANY_THROW(sketch.init({0.9999999, 0.99999999}, 0.01, 16));
+    ASSERT_NE(gtestLogOutput.str().find("like another quantile"),
+              std::string::npos);
+}
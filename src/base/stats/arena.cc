@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "base/stats/arena.hh"
+
+#include <algorithm>
+#include <cstdint>
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+GEM5_DEPRECATED_NAMESPACE(Stats, statistics);
+namespace statistics
+{
+
+namespace
+{
+
+bool arenaStorage = false;
+
+} // anonymous namespace
+
+void
+enableArenaStorage(bool enable)
+{
+    arenaStorage = enable;
+}
+
+bool
+arenaStorageEnabled()
+{
+    return arenaStorage;
+}
+
+Arena::Arena(std::size_t first_block, std::size_t max_block)
+    : cursor(nullptr), limit(nullptr),
+      nextBlock(roundUp(std::max<std::size_t>(first_block, 1), blockAlign)),
+      maxBlock(std::max(nextBlock, max_block)), used(0), reserved(0)
+{
+}
+
+Arena::~Arena()
+{
+    for (auto *block : blocks)
+        ::operator delete(block, std::align_val_t(blockAlign));
+}
+
+void
+Arena::newBlock(std::size_t min_size)
+{
+    const std::size_t size =
+        std::max(nextBlock, roundUp(min_size, blockAlign));
+    char *block = static_cast<char *>(
+        ::operator new(size, std::align_val_t(blockAlign)));
+
+    blocks.push_back(block);
+    cursor = block;
+    limit = block + size;
+    reserved += size;
+    nextBlock = std::min(nextBlock * 2, maxBlock);
+}
+
+void *
+Arena::allocate(std::size_t size, std::size_t align)
+{
+    panic_if(!isPowerOf2(align) || align > blockAlign,
+             "Unsupported stat arena alignment: %d", align);
+
+    char *p = cursor ? reinterpret_cast<char *>(
+        roundUp(reinterpret_cast<std::uintptr_t>(cursor), align)) : nullptr;
+    if (!p || size > std::size_t(limit - p)) {
+        newBlock(size);
+        p = cursor;
+    }
+
+    cursor = p + size;
+    used += size;
+    return p;
+}
+
+} // namespace statistics
+} // namespace gem5
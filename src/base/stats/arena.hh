@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_STATS_ARENA_HH__
+#define __BASE_STATS_ARENA_HH__
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+#include "base/compiler.hh"
+#include "base/stats/group.hh"
+#include "base/stats/storage.hh"
+#include "base/stats/types.hh"
+
+namespace gem5
+{
+
+GEM5_DEPRECATED_NAMESPACE(Stats, statistics);
+namespace statistics
+{
+
+/**
+ * Enable or disable arena-backed stat storage. When enabled, the
+ * element storage of vector stats is carved out of a per-group arena
+ * so that the counters of a group end up contiguous in memory instead
+ * of being scattered across the heap. This only affects stats that
+ * are initialized after the call, so it has to be set before the
+ * SimObjects are instantiated.
+ */
+void enableArenaStorage(bool enable = true);
+
+/** Is arena-backed stat storage enabled? */
+bool arenaStorageEnabled();
+
+/**
+ * A simple bump allocator for stat storage. Memory is handed out from
+ * cache-line aligned blocks and is only returned to the system when
+ * the arena is destroyed. Blocks start small and double in size so
+ * that groups with a handful of stats do not waste much memory.
+ */
+class Arena
+{
+  public:
+    /** Alignment of every block owned by the arena. */
+    static constexpr std::size_t blockAlign = 64;
+
+    /**
+     * @param first_block Size in bytes of the first block.
+     * @param max_block Upper bound on the size of automatically grown
+     *        blocks. Larger requests get a dedicated block.
+     */
+    Arena(std::size_t first_block = 256, std::size_t max_block = 16384);
+    ~Arena();
+
+    Arena(const Arena &) = delete;
+    Arena &operator=(const Arena &) = delete;
+
+    /**
+     * Allocate memory from the arena.
+     *
+     * @param size Number of bytes to allocate.
+     * @param align Required alignment, must be a power of two no
+     *        larger than blockAlign.
+     * @return Pointer to uninitialized memory.
+     */
+    void *allocate(std::size_t size, std::size_t align);
+
+    /** Number of bytes handed out by allocate(). */
+    std::size_t bytesUsed() const { return used; }
+
+    /** Number of bytes reserved from the system. */
+    std::size_t bytesReserved() const { return reserved; }
+
+    /** Number of blocks reserved from the system. */
+    std::size_t numBlocks() const { return blocks.size(); }
+
+  private:
+    void newBlock(std::size_t min_size);
+
+    std::vector<char *> blocks;
+    /** Next free byte in the current block. */
+    char *cursor;
+    /** End of the current block. */
+    char *limit;
+    /** Size of the next block to reserve. */
+    std::size_t nextBlock;
+    const std::size_t maxBlock;
+
+    std::size_t used;
+    std::size_t reserved;
+};
+
+/**
+ * Contiguous storage for the elements of a vector stat. The elements
+ * are either allocated from the arena of the group the stat belongs
+ * to (see enableArenaStorage()) or from a single heap allocation.
+ */
+template <class Storage>
+class StorageArray
+{
+  private:
+    /** Group the owning stat was registered with. */
+    Group *group;
+    Storage *elems;
+    size_type _size;
+    /** Place the elements in the hot arena of the group. */
+    bool _hot;
+    /** The elements live in an arena and must not be freed. */
+    bool inArena;
+
+  public:
+    explicit StorageArray(Group *parent)
+        : group(parent), elems(nullptr), _size(0), _hot(false),
+          inArena(false)
+    {}
+
+    ~StorageArray()
+    {
+        for (size_type i = 0; i < _size; ++i)
+            elems[i].~Storage();
+        if (!inArena)
+            ::operator delete(elems);
+    }
+
+    StorageArray(const StorageArray &) = delete;
+    StorageArray &operator=(const StorageArray &) = delete;
+
+    /**
+     * Allocate and construct the elements. May only be called once.
+     *
+     * @param size Number of elements.
+     * @param params Storage parameters of the owning stat.
+     */
+    void
+    init(size_type size, const StorageParams *params)
+    {
+        Arena *arena = group ? group->storageArena(_hot) : nullptr;
+        const std::size_t bytes = size * sizeof(Storage);
+        void *mem = arena ? arena->allocate(bytes, alignof(Storage)) :
+            ::operator new(bytes);
+
+        elems = static_cast<Storage *>(mem);
+        inArena = arena != nullptr;
+        for (; _size < size; ++_size)
+            new (&elems[_size]) Storage(params);
+    }
+
+    void hot(bool hot) { _hot = hot; }
+    bool hot() const { return _hot; }
+
+    size_type size() const { return _size; }
+
+    Storage *operator[](off_type index) { return &elems[index]; }
+    const Storage *operator[](off_type index) const { return &elems[index]; }
+
+    Storage *begin() { return elems; }
+    Storage *end() { return elems + _size; }
+};
+
+} // namespace statistics
+} // namespace gem5
+
+#endif // __BASE_STATS_ARENA_HH__
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "base/stats/arena.hh"
+#include "base/stats/group.hh"
+#include "base/stats/storage.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/** Enable arena storage for the lifetime of a test. */
+struct ArenaStorageGuard
+{
+    ArenaStorageGuard() { statistics::enableArenaStorage(true); }
+    ~ArenaStorageGuard() { statistics::enableArenaStorage(false); }
+};
+
+bool
+aligned(const void *p, std::size_t align)
+{
+    return reinterpret_cast<std::uintptr_t>(p) % align == 0;
+}
+
+} // anonymous namespace
+
+/** Test that allocations are aligned and packed back to back. */
+TEST(StatsArenaTest, AllocateContiguous)
+{
+    statistics::Arena arena(256);
+
+    char *a = static_cast<char *>(arena.allocate(24, 8));
+    char *b = static_cast<char *>(arena.allocate(8, 8));
+    char *c = static_cast<char *>(arena.allocate(1, 1));
+    char *d = static_cast<char *>(arena.allocate(16, 16));
+
+    ASSERT_TRUE(aligned(a, statistics::Arena::blockAlign));
+    ASSERT_EQ(b, a + 24);
+    ASSERT_EQ(c, b + 8);
+    ASSERT_EQ(d, a + 48);
+    ASSERT_EQ(arena.bytesUsed(), 49);
+    ASSERT_EQ(arena.bytesReserved(), 256);
+    ASSERT_EQ(arena.numBlocks(), 1);
+}
+
+/** Test that the arena grows by doubling the block size. */
+TEST(StatsArenaTest, Grow)
+{
+    statistics::Arena arena(64, 256);
+
+    arena.allocate(64, 8);
+    ASSERT_EQ(arena.numBlocks(), 1);
+    void *p = arena.allocate(8, 8);
+    ASSERT_EQ(arena.numBlocks(), 2);
+    ASSERT_EQ(arena.bytesReserved(), 64 + 128);
+    ASSERT_TRUE(aligned(p, statistics::Arena::blockAlign));
+
+    arena.allocate(128, 8);
+    arena.allocate(256, 8);
+    arena.allocate(8, 8);
+    ASSERT_EQ(arena.numBlocks(), 5);
+    ASSERT_EQ(arena.bytesReserved(), 64 + 128 + 256 + 256 + 256);
+}
+
+/** Test that requests larger than a block get a dedicated block. */
+TEST(StatsArenaTest, LargeAllocation)
+{
+    statistics::Arena arena(64, 128);
+
+    void *p = arena.allocate(1000, 8);
+    ASSERT_TRUE(aligned(p, statistics::Arena::blockAlign));
+    ASSERT_EQ(arena.numBlocks(), 1);
+    ASSERT_EQ(arena.bytesReserved(), 1024);
+}
+
+/** Test that groups don't have an arena unless it has been enabled. */
+TEST(StatsArenaTest, DisabledByDefault)
+{
+    statistics::Group group(nullptr);
+    ASSERT_EQ(group.storageArena(), nullptr);
+
+    statistics::StorageArray<statistics::StatStor> array(&group);
+    statistics::StatStor::Params params;
+    array.init(4, &params);
+    ASSERT_EQ(array.size(), 4);
+    ASSERT_EQ(array[1], array[0] + 1);
+    ASSERT_EQ(array[3]->value(), 0);
+}
+
+/** Test that the stats of a group are packed into its arena. */
+TEST(StatsArenaTest, GroupStoragePacked)
+{
+    ArenaStorageGuard guard;
+    statistics::Group group(nullptr);
+    statistics::StatStor::Params params;
+
+    statistics::StorageArray<statistics::StatStor> a(&group);
+    statistics::StorageArray<statistics::StatStor> b(&group);
+    a.init(3, &params);
+    b.init(2, &params);
+
+    ASSERT_NE(group.storageArena(), nullptr);
+    ASSERT_EQ(b[0], a[2] + 1);
+    ASSERT_EQ(group.storageArena()->bytesUsed(),
+              5 * sizeof(statistics::StatStor));
+
+    a[2]->inc(3);
+    ASSERT_EQ(a[2]->value(), 3);
+    ASSERT_EQ(b[0]->value(), 0);
+}
+
+/** Test that hot stats are kept apart from the other stats. */
+TEST(StatsArenaTest, HotStorage)
+{
+    ArenaStorageGuard guard;
+    statistics::Group group(nullptr);
+    statistics::StatStor::Params params;
+
+    statistics::StorageArray<statistics::StatStor> cold(&group);
+    statistics::StorageArray<statistics::StatStor> hot1(&group);
+    statistics::StorageArray<statistics::StatStor> hot2(&group);
+    hot1.hot(true);
+    hot2.hot(true);
+    cold.init(2, &params);
+    hot1.init(1, &params);
+    hot2.init(1, &params);
+
+    ASSERT_NE(group.storageArena(true), group.storageArena(false));
+    ASSERT_EQ(hot2[0], hot1[0] + 1);
+    ASSERT_EQ(group.storageArena(true)->bytesUsed(),
+              2 * sizeof(statistics::StatStor));
+    ASSERT_EQ(group.storageArena(false)->bytesUsed(),
+              2 * sizeof(statistics::StatStor));
+}
+
+/** Test that merged groups share the arena of their parent. */
+TEST(StatsArenaTest, MergedGroupSharesArena)
+{
+    ArenaStorageGuard guard;
+    statistics::Group parent(nullptr);
+    statistics::Group merged(&parent);
+    statistics::Group child(&parent, "child");
+
+    ASSERT_EQ(merged.storageArena(), parent.storageArena());
+    ASSERT_EQ(merged.storageArena(true), parent.storageArena(true));
+    ASSERT_NE(child.storageArena(), parent.storageArena());
+}
@@ -0,0 +1,397 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "base/stats/columnar.hh"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <zlib.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include "base/cprintf.hh"
+#include "base/intmath.hh"
+#include "base/logging.hh"
+#include "base/output.hh"
+#include "base/stats/info.hh"
+#include "sim/cur_tick.hh"
+
+namespace gem5
+{
+
+namespace statistics
+{
+
+namespace
+{
+
+/** Make a string safe to use as a schema field. */
+std::string
+field(std::string str, bool label=false)
+{
+    for (auto &c: str) {
+        if (c == '\t' || c == '\n' || (label && c == ','))
+            c = ' ';
+    }
+    return str;
+}
+
+std::string
+joinLabels(const std::vector<std::string> &labels)
+{
+    std::string joined;
+    for (size_t i = 0; i < labels.size(); ++i) {
+        if (i)
+            joined += ",";
+        joined += field(labels[i], true);
+    }
+    return joined;
+}
+
+/** Label of the i-th element of a stat with optional subnames. */
+std::string
+subname(const std::vector<std::string> &subnames, size_t i)
+{
+    if (i < subnames.size() && !subnames[i].empty())
+        return subnames[i];
+    return std::to_string(i);
+}
+
+const char *const distFields[] = {
+    "samples", "sum", "squares", "min_val", "max_val",
+    "underflow", "overflow", "min", "bucket_size",
+};
+
+} // anonymous namespace
+
+Columnar::Columnar(const std::string &file, unsigned block_rows,
+                   int _compression, bool desc, bool formulas)
+    : fname(file), blockRows(block_rows), compression(_compression),
+      enableDescriptions(desc), enableFormula(formulas), fd(-1),
+      dumpCount(0), columns(0), blockOffset(0), blockRowCount(0)
+{
+    fatal_if(compression < 0 || compression > 9,
+             "Invalid stats compression level %d.", compression);
+    fatal_if(compression && !blockRows,
+             "Compressed stats need at least one row per block.");
+}
+
+Columnar::~Columnar()
+{
+    if (fd >= 0)
+        close(fd);
+}
+
+void
+Columnar::begin()
+{
+    if (fd < 0) {
+        fd = open(fname.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0666);
+        fatal_if(fd < 0, "Could not open stats file %s: %s", fname,
+                 strerror(errno));
+    }
+    row.clear();
+}
+
+void
+Columnar::end()
+{
+    assert(path.empty());
+
+    if (dumpCount == 0) {
+        columns = row.size();
+        writeSchema();
+    } else {
+        fatal_if(row.size() != columns, "The number of stat values "
+                 "changed from %d to %d between dumps.", columns,
+                 row.size());
+    }
+
+    writeRow();
+    dumpCount++;
+}
+
+bool
+Columnar::valid() const
+{
+    return true;
+}
+
+void
+Columnar::beginGroup(const char *name)
+{
+    if (path.empty())
+        path.push(name);
+    else
+        path.push(csprintf("%s.%s", path.top(), name));
+}
+
+void
+Columnar::endGroup()
+{
+    assert(!path.empty());
+    path.pop();
+}
+
+void
+Columnar::append(const Info &info, const char *kind,
+                 const std::string &shape,
+                 const std::vector<std::string> &labels,
+                 const double *values, size_t count)
+{
+    if (dumpCount == 0) {
+        const std::string name = path.empty() ?
+            info.name : csprintf("%s.%s", path.top(), info.name);
+        schema += csprintf("%s\t%s\t%d\t%s\t%s\t%s\n", field(name), kind,
+                           row.size(), shape, joinLabels(labels),
+                           enableDescriptions ? field(info.desc) : "");
+    }
+    row.insert(row.end(), values, values + count);
+}
+
+void
+Columnar::appendDist(const DistData &data, std::vector<double> &values,
+                     std::vector<std::string> *labels) const
+{
+    const double fields[] = {
+        data.samples, data.sum, data.squares, data.min_val, data.max_val,
+        data.underflow, data.overflow, data.min, data.bucket_size,
+    };
+    values.insert(values.end(), std::begin(fields), std::end(fields));
+    values.insert(values.end(), data.cvec.begin(), data.cvec.end());
+
+    if (labels) {
+        labels->insert(labels->end(), std::begin(distFields),
+                       std::end(distFields));
+        for (size_t i = 0; i < data.cvec.size(); ++i)
+            labels->push_back(csprintf("bucket%d", i));
+    }
+}
+
+void
+Columnar::visit(const ScalarInfo &info)
+{
+    if (!info.flags.isSet(display))
+        return;
+
+    const double value = info.result();
+    append(info, "scalar", "1", {}, &value, 1);
+}
+
+void
+Columnar::visit(const VectorInfo &info)
+{
+    if (!info.flags.isSet(display))
+        return;
+
+    const VResult &vr = info.result();
+    std::vector<std::string> labels;
+    if (dumpCount == 0) {
+        for (size_t i = 0; i < vr.size(); ++i)
+            labels.push_back(subname(info.subnames, i));
+    }
+    append(info, "vector", std::to_string(vr.size()), labels, vr.data(),
+           vr.size());
+}
+
+void
+Columnar::visit(const DistInfo &info)
+{
+    if (!info.flags.isSet(display))
+        return;
+
+    std::vector<double> values;
+    std::vector<std::string> labels;
+    appendDist(info.data, values, dumpCount == 0 ? &labels : nullptr);
+    append(info, "dist", std::to_string(values.size()), labels,
+           values.data(), values.size());
+}
+
+void
+Columnar::visit(const VectorDistInfo &info)
+{
+    if (!info.flags.isSet(display))
+        return;
+
+    std::vector<double> values;
+    std::vector<std::string> labels;
+    for (size_t i = 0; i < info.size(); ++i) {
+        std::vector<std::string> fields;
+        appendDist(info.data[i], values, dumpCount == 0 ? &fields : nullptr);
+        for (const auto &f: fields)
+            labels.push_back(subname(info.subnames, i) + "." + f);
+    }
+    const size_t per_dist = info.size() ? values.size() / info.size() : 0;
+    append(info, "vectordist", csprintf("%dx%d", info.size(), per_dist),
+           labels, values.data(), values.size());
+}
+
+void
+Columnar::visit(const Vector2dInfo &info)
+{
+    if (!info.flags.isSet(display))
+        return;
+
+    std::vector<std::string> labels;
+    if (dumpCount == 0) {
+        for (size_t x = 0; x < info.x; ++x) {
+            for (size_t y = 0; y < info.y; ++y) {
+                labels.push_back(subname(info.subnames, x) + "." +
+                                 subname(info.y_subnames, y));
+            }
+        }
+    }
+    append(info, "vector2d", csprintf("%dx%d", info.x, info.y), labels,
+           info.cvec.data(), info.cvec.size());
+}
+
+void
+Columnar::visit(const FormulaInfo &info)
+{
+    if (!enableFormula || !info.flags.isSet(display))
+        return;
+
+    const VResult &vr = info.result();
+    std::vector<std::string> labels;
+    if (dumpCount == 0) {
+        for (size_t i = 0; i < vr.size(); ++i)
+            labels.push_back(subname(info.subnames, i));
+    }
+    append(info, "formula", std::to_string(vr.size()), labels, vr.data(),
+           vr.size());
+}
+
+void
+Columnar::visit(const SparseHistInfo &info)
+{
+    warn_once("Columnar stat files don't support sparse histograms.\n");
+}
+
+void
+Columnar::writeAt(const void *data, size_t size, uint64_t offset)
+{
+    const char *ptr = static_cast<const char *>(data);
+    while (size) {
+        const ssize_t ret = pwrite(fd, ptr, size, offset);
+        if (ret < 0 && errno == EINTR)
+            continue;
+        fatal_if(ret <= 0, "Could not write stats file %s: %s", fname,
+                 strerror(errno));
+        ptr += ret;
+        size -= ret;
+        offset += ret;
+    }
+}
+
+void
+Columnar::writeSchema()
+{
+    FileHeader header;
+    std::memcpy(header.magic, magic, sizeof(magic));
+    header.version = version;
+    header.columns = columns;
+    header.schemaSize = schema.size();
+    header.dataOffset = roundUp(sizeof(header) + schema.size(), 8);
+
+    writeAt(&header, sizeof(header), 0);
+    writeAt(schema.data(), schema.size(), sizeof(header));
+
+    blockOffset = header.dataOffset;
+    blockRowCount = 0;
+
+    // The schema is only needed once.
+    schema.clear();
+    schema.shrink_to_fit();
+}
+
+void
+Columnar::writeRow()
+{
+    const size_t row_size = sizeof(uint64_t) + columns * sizeof(double);
+    const uint64_t tick = curTick();
+
+    std::vector<char> data(row_size);
+    std::memcpy(data.data(), &tick, sizeof(tick));
+    std::memcpy(data.data() + sizeof(tick), row.data(),
+                columns * sizeof(double));
+
+    writeAt(data.data(), data.size(),
+            blockOffset + sizeof(BlockHeader) + blockRowCount * row_size);
+    blockRowCount++;
+
+    // Publish the row by updating the block header.
+    const BlockHeader block{Raw, blockRowCount, blockRowCount * row_size};
+    writeAt(&block, sizeof(block), blockOffset);
+
+    if (compression) {
+        blockData.insert(blockData.end(), data.begin(), data.end());
+        if (blockRowCount == blockRows)
+            compressBlock();
+    }
+}
+
+void
+Columnar::compressBlock()
+{
+    uLongf size = compressBound(blockData.size());
+    std::vector<Bytef> compressed(size);
+    const int ret = compress2(compressed.data(), &size,
+                              (const Bytef *)blockData.data(),
+                              blockData.size(), compression);
+    panic_if(ret != Z_OK, "Failed to compress stats: %s", zError(ret));
+
+    // Keep the rows raw if they don't compress.
+    if (size < blockData.size()) {
+        const BlockHeader block{Deflate, blockRowCount, size};
+        writeAt(compressed.data(), size, blockOffset + sizeof(block));
+        writeAt(&block, sizeof(block), blockOffset);
+        blockOffset += sizeof(block) + roundUp(size, 8);
+        // Drop what is left of the raw rows.
+        fatal_if(ftruncate(fd, blockOffset) != 0,
+                 "Could not truncate stats file %s: %s", fname,
+                 strerror(errno));
+    } else {
+        blockOffset += sizeof(BlockHeader) + blockData.size();
+    }
+
+    blockRowCount = 0;
+    blockData.clear();
+}
+
+std::unique_ptr<Output>
+initColumnar(const std::string &filename, unsigned block_rows,
+             int compression, bool desc, bool formulas)
+{
+    return std::unique_ptr<Output>(new Columnar(simout.resolve(filename),
+        block_rows, compression, desc, formulas));
+}
+
+} // namespace statistics
+} // namespace gem5
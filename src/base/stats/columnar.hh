@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Columnar binary stats output.
+ *
+ * The file starts with a schema describing every stat, written at the
+ * first dump, followed by one fixed-width row of values per dump. Rows
+ * are grouped in blocks which may be compressed once they are full:
+ *
+ *   FileHeader | schema | block...
+ *   block: BlockHeader | rows (raw) or deflated rows
+ *   row: uint64_t tick | double value[columns]
+ *
+ * The schema is text, one stat per line, with tab-separated fields:
+ * name, kind, first column, shape (dimensions separated by 'x'),
+ * comma-separated column labels and description. The last block is
+ * always raw and its header is updated on every dump, so the file is
+ * readable at any time, and an uncompressed file can be memory mapped
+ * as a single array. See m5.ext.pystats.columnar for a reader.
+ */
+
+#ifndef __BASE_STATS_COLUMNAR_HH__
+#define __BASE_STATS_COLUMNAR_HH__
+
+#include <cstdint>
+#include <memory>
+#include <stack>
+#include <string>
+#include <vector>
+
+#include "base/stats/output.hh"
+#include "base/stats/types.hh"
+
+namespace gem5
+{
+
+namespace statistics
+{
+
+class Columnar : public Output
+{
+  public:
+    static constexpr char magic[8] = {'g', 'e', 'm', '5', 'S', 'T', 'A', 'T'};
+    static constexpr uint32_t version = 1;
+
+    struct FileHeader
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t columns;
+        uint64_t schemaSize;
+        /** Offset of the first block, after the padded schema. */
+        uint64_t dataOffset;
+    };
+    static_assert(sizeof(FileHeader) == 32, "Unexpected header layout");
+
+    enum Encoding : uint32_t
+    {
+        Raw = 0,
+        Deflate = 1,
+    };
+
+    struct BlockHeader
+    {
+        uint32_t encoding;
+        uint32_t rows;
+        /** Size of the block's data, following the header. */
+        uint64_t size;
+    };
+    static_assert(sizeof(BlockHeader) == 16, "Unexpected header layout");
+
+    /**
+     * @param file Path of the stats file.
+     * @param block_rows Number of rows per compressed block.
+     * @param compression zlib compression level, 0 to leave rows raw.
+     * @param desc Include stat descriptions in the schema.
+     * @param formulas Output derived stats.
+     */
+    Columnar(const std::string &file, unsigned block_rows, int compression,
+             bool desc, bool formulas);
+    ~Columnar();
+
+    Columnar(const Columnar &other) = delete;
+
+  public: // Output interface
+    void begin() override;
+    void end() override;
+    bool valid() const override;
+
+    void beginGroup(const char *name) override;
+    void endGroup() override;
+
+    void visit(const ScalarInfo &info) override;
+    void visit(const VectorInfo &info) override;
+    void visit(const DistInfo &info) override;
+    void visit(const VectorDistInfo &info) override;
+    void visit(const Vector2dInfo &info) override;
+    void visit(const FormulaInfo &info) override;
+    void visit(const SparseHistInfo &info) override;
+
+  protected:
+    /**
+     * Append the values of a stat to the current row, and describe the
+     * stat in the schema on the first dump.
+     */
+    void append(const Info &info, const char *kind, const std::string &shape,
+                const std::vector<std::string> &labels,
+                const double *values, size_t count);
+
+    /** Append the fields of a distribution to the current row. */
+    void appendDist(const DistData &data, std::vector<double> &values,
+                    std::vector<std::string> *labels) const;
+
+    /** Write the file header and the schema. */
+    void writeSchema();
+
+    /** Append the current row to the last block. */
+    void writeRow();
+
+    /** Compress the rows of the last block, which is full. */
+    void compressBlock();
+
+    void writeAt(const void *data, size_t size, uint64_t offset);
+
+  protected:
+    const std::string fname;
+    const unsigned blockRows;
+    const int compression;
+    const bool enableDescriptions;
+    const bool enableFormula;
+
+    int fd;
+    std::stack<std::string> path;
+
+    unsigned dumpCount;
+    std::vector<double> row;
+    std::string schema;
+    uint32_t columns;
+
+    /** Offset and number of rows of the last, raw, block. */
+    uint64_t blockOffset;
+    uint32_t blockRowCount;
+    /** Rows of the last block, kept for compression. */
+    std::vector<char> blockData;
+};
+
+std::unique_ptr<Output> initColumnar(const std::string &filename,
+                                     unsigned block_rows = 64,
+                                     int compression = 1, bool desc = true,
+                                     bool formulas = true);
+
+} // namespace statistics
+} // namespace gem5
+
+#endif // __BASE_STATS_COLUMNAR_HH__
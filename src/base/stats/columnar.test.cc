@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+#include <zlib.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "base/stats/columnar.hh"
+#include "base/stats/info.hh"
+#include "sim/cur_tick.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/** Minimal stat info, holding its values directly. */
+template <class Base>
+class TestInfo : public Base
+{
+  public:
+    TestInfo(const std::string &name, const std::string &desc)
+    {
+        this->name = name;
+        this->desc = desc;
+        this->flags.set(statistics::display);
+    }
+
+    bool check() const override { return true; }
+    void prepare() override {}
+    void reset() override {}
+    bool zero() const override { return false; }
+    void visit(statistics::Output &visitor) override { visitor.visit(*this); }
+};
+
+class ScalarStat : public TestInfo<statistics::ScalarInfo>
+{
+  public:
+    using TestInfo::TestInfo;
+    double v = 0;
+
+    statistics::Counter value() const override { return v; }
+    statistics::Result result() const override { return v; }
+    statistics::Result total() const override { return v; }
+};
+
+class VectorStat : public TestInfo<statistics::VectorInfo>
+{
+  public:
+    using TestInfo::TestInfo;
+    statistics::VResult v;
+
+    statistics::size_type size() const override { return v.size(); }
+    const statistics::VCounter &value() const override { return v; }
+    const statistics::VResult &result() const override { return v; }
+    statistics::Result total() const override { return 0; }
+};
+
+struct TestStats
+{
+    TestStats()
+        : scalar("scalar", "A scalar"), vector("vector", "A vector"),
+          dist("dist", "A distribution")
+    {
+        vector.v.resize(3);
+        vector.subnames = {"first", "", ""};
+        dist.data = {};
+        dist.data.cvec.resize(3);
+    }
+
+    ScalarStat scalar;
+    VectorStat vector;
+    TestInfo<statistics::DistInfo> dist;
+};
+
+/** Dump the stats to an output. */
+void
+dump(statistics::Output &output, TestStats &stats)
+{
+    output.begin();
+    output.beginGroup("test");
+    stats.scalar.visit(output);
+    stats.vector.visit(output);
+    stats.dist.visit(output);
+    output.endGroup();
+    output.end();
+}
+
+/** Rows read back from a file. */
+struct Contents
+{
+    statistics::Columnar::FileHeader header;
+    std::string schema;
+    std::vector<uint64_t> ticks;
+    std::vector<std::vector<double>> rows;
+    std::vector<uint32_t> encodings;
+};
+
+Contents
+readBack(const std::string &path)
+{
+    std::ifstream is(path, std::ios::binary);
+    std::vector<char> file((std::istreambuf_iterator<char>(is)),
+                           std::istreambuf_iterator<char>());
+
+    Contents c;
+    std::memcpy(&c.header, file.data(), sizeof(c.header));
+    c.schema.assign(file.data() + sizeof(c.header), c.header.schemaSize);
+
+    const size_t row_size = 8 + 8 * c.header.columns;
+    size_t offset = c.header.dataOffset;
+    while (offset + sizeof(statistics::Columnar::BlockHeader) <=
+            file.size()) {
+        statistics::Columnar::BlockHeader block;
+        std::memcpy(&block, file.data() + offset, sizeof(block));
+        offset += sizeof(block);
+        c.encodings.push_back(block.encoding);
+
+        std::vector<char> rows(block.rows * row_size);
+        if (block.encoding == statistics::Columnar::Deflate) {
+            uLongf size = rows.size();
+            EXPECT_EQ(uncompress((Bytef *)rows.data(), &size,
+                                 (const Bytef *)file.data() + offset,
+                                 block.size), Z_OK);
+            offset += (block.size + 7) / 8 * 8;
+        } else {
+            std::memcpy(rows.data(), file.data() + offset, block.size);
+            offset += block.size;
+        }
+
+        for (size_t r = 0; r < block.rows; ++r) {
+            const char *ptr = rows.data() + r * row_size;
+            uint64_t tick;
+            std::memcpy(&tick, ptr, 8);
+            std::vector<double> values(c.header.columns);
+            std::memcpy(values.data(), ptr + 8, 8 * values.size());
+            c.ticks.push_back(tick);
+            c.rows.push_back(values);
+        }
+    }
+    return c;
+}
+
+std::string
+tempFile()
+{
+    char path[] = "/tmp/columnar_test_XXXXXX";
+    const int fd = mkstemp(path);
+    close(fd);
+    return path;
+}
+
+} // anonymous namespace
+
+/** The schema describes every stat and each dump is a row. */
+TEST(StatsColumnarTest, SchemaAndRows)
+{
+    const std::string path = tempFile();
+    TestStats stats;
+    statistics::Columnar output(path, 64, 0, true, true);
+
+    Tick tick = 0;
+    Gem5Internal::_curTickPtr = &tick;
+    for (int i = 0; i < 5; ++i) {
+        tick = 1000 * i;
+        stats.scalar.v = i;
+        stats.vector.v[1] = 10 * i;
+        stats.dist.data.samples = i + 1;
+        dump(output, stats);
+    }
+
+    const Contents c = readBack(path);
+    EXPECT_EQ(std::string(c.header.magic, 8), "gem5STAT");
+    // 1 scalar, 3 vector elements, 9 distribution fields and 3 buckets.
+    EXPECT_EQ(c.header.columns, 16);
+    EXPECT_EQ(c.schema,
+        "test.scalar\tscalar\t0\t1\t\tA scalar\n"
+        "test.vector\tvector\t1\t3\tfirst,1,2\tA vector\n"
+        "test.dist\tdist\t4\t12\tsamples,sum,squares,min_val,max_val,"
+        "underflow,overflow,min,bucket_size,bucket0,bucket1,bucket2\t"
+        "A distribution\n");
+
+    ASSERT_EQ(c.rows.size(), 5);
+    EXPECT_EQ(c.encodings, std::vector<uint32_t>{statistics::Columnar::Raw});
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(c.ticks[i], 1000 * i);
+        EXPECT_EQ(c.rows[i][0], i);
+        EXPECT_EQ(c.rows[i][2], 10 * i);
+        EXPECT_EQ(c.rows[i][4], i + 1);
+    }
+    std::remove(path.c_str());
+}
+
+/** Full blocks are compressed, the last one stays raw. */
+TEST(StatsColumnarTest, CompressedBlocks)
+{
+    const std::string path = tempFile();
+    TestStats stats;
+    statistics::Columnar output(path, 4, 6, false, true);
+
+    Tick tick = 0;
+    Gem5Internal::_curTickPtr = &tick;
+    for (int i = 0; i < 10; ++i) {
+        stats.scalar.v = i;
+        dump(output, stats);
+    }
+
+    const Contents c = readBack(path);
+    ASSERT_EQ(c.rows.size(), 10);
+    const std::vector<uint32_t> encodings{statistics::Columnar::Deflate,
+        statistics::Columnar::Deflate, statistics::Columnar::Raw};
+    EXPECT_EQ(c.encodings, encodings);
+    for (int i = 0; i < 10; ++i)
+        EXPECT_EQ(c.rows[i][0], i);
+    // Descriptions are left out on request.
+    EXPECT_EQ(c.schema.substr(0, 25), "test.scalar\tscalar\t0\t1\t\t\n");
+    std::remove(path.c_str());
+}
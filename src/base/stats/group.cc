@@ -40,6 +40,7 @@
 #include "base/compiler.hh"
 #include "base/logging.hh"
 #include "base/named.hh"
+#include "base/stats/arena.hh"
 #include "base/stats/info.hh"
 #include "base/trace.hh"
 #include "debug/Stats.hh"
@@ -85,6 +86,8 @@ Group::regStats()
 void
 Group::resetStats()
 {
+    // Filtered stats are only left out of the output. They may still be
+    // operands of formulas which are not filtered.
     for (auto &s : stats)
         s->reset();
 
@@ -177,6 +180,21 @@ Group::mergeStatGroup(Group *block)
     block->mergedParent = this;
 }
 
+Arena *
+Group::storageArena(bool hot)
+{
+    if (!arenaStorageEnabled())
+        return nullptr;
+
+    if (mergedParent)
+        return mergedParent->storageArena(hot);
+
+    auto &arena = hot ? hotArena : coldArena;
+    if (!arena)
+        arena.reset(new Arena());
+    return arena.get();
+}
+
 const std::map<std::string, Group *> &
 Group::getStatGroups() const
 {
@@ -39,6 +39,7 @@
 #define __BASE_STATS_GROUP_HH__
 
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -78,6 +79,7 @@ GEM5_DEPRECATED_NAMESPACE(Stats, statistics);
 namespace statistics
 {
 
+class Arena;
 class Info;
 
 /**
@@ -212,10 +214,29 @@ class Group
      */
     void mergeStatGroup(Group *block);
 
+    /**
+     * Get the arena used for stat storage in this group.
+     *
+     * Merged groups share the arena of the group they have been
+     * merged into, which means that all stats of a SimObject end up
+     * in the same arena. The arena is created on first use and lives
+     * as long as the group, so stats allocated from it must not
+     * outlive the group.
+     *
+     * @param hot Return the arena for frequently updated stats.
+     * @return Pointer to the arena or nullptr if arena-backed storage
+     * is disabled.
+     */
+    Arena *storageArena(bool hot = false);
+
   private:
     /** Parent pointer if merged into parent */
     Group *mergedParent;
 
+    /** Arenas for stat storage, see storageArena() */
+    std::unique_ptr<Arena> coldArena;
+    std::unique_ptr<Arena> hotArena;
+
     std::map<std::string, Group *> statGroups;
     std::vector<Group *> mergedStatGroups;
     std::vector<Info *> stats;
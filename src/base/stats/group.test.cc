@@ -657,3 +657,26 @@ TEST(StatsGroupTest, ResolveStatMergedSubGroup)
     ASSERT_NE(info_found, nullptr);
     ASSERT_EQ(info_found->name, "InfoResolveStatMergedSubGroup");
 }
+
+/** Test that resetting a group also resets filtered stats. */
+TEST(StatsGroupTest, ResetStatsFiltered)
+{
+    statistics::Group root(nullptr);
+    statistics::Group node1(nullptr);
+    root.addStatGroup("Node1", &node1);
+
+    DummyInfo info;
+    info.setName("InfoResetStatsFiltered");
+    info.value = 1;
+    root.addStat(&info);
+
+    DummyInfo info2;
+    info2.setName("InfoResetStatsFiltered2");
+    info2.value = 1;
+    info2.filter();
+    node1.addStat(&info2);
+
+    root.resetStats();
+    ASSERT_EQ(info.value, 0);
+    ASSERT_EQ(info2.value, 0);
+}
@@ -196,6 +196,12 @@ Info::enable()
 {
 }
 
+void
+Info::filter()
+{
+    flags.set(filtered);
+}
+
 void
 VectorInfo::enable()
 {
@@ -70,9 +70,11 @@ const FlagsType nozero =        0x0100;
 const FlagsType nonan =         0x0200;
 /** Print all values on a single line. Useful only for histograms. */
 const FlagsType oneline =       0x0400;
+/** This stat has been excluded by the stats filter. */
+const FlagsType filtered =      0x0800;
 
 /** Mask of flags that can't be set directly */
-const FlagsType __reserved =    init | display;
+const FlagsType __reserved =    init | display | filtered;
 
 struct StorageParams;
 struct Output;
@@ -141,6 +143,13 @@ class Info
      */
     virtual void enable();
 
+    /**
+     * Exclude the stat from dumps. Stats that are costly to update,
+     * such as distributions, also stop recording samples. This is used
+     * by the stats filter before the stats are enabled.
+     */
+    virtual void filter();
+
     /**
      * Prepare the stat for dumping.
      */
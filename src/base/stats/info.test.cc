@@ -320,3 +320,15 @@ TEST(StatsInfoDeathTest, BaseCheckDisplayNoName)
     info.flags.set(statistics::init | statistics::display);
     ASSERT_ANY_THROW(info.baseCheck());
 }
+
+/** Test that filtering a stat flags it without touching other flags. */
+TEST(StatsInfoTest, Filter)
+{
+    TestInfo info;
+    info.flags.set(statistics::init | statistics::display);
+    ASSERT_FALSE(info.flags.isSet(statistics::filtered));
+
+    info.filter();
+    ASSERT_TRUE(info.flags.isSet(statistics::filtered));
+    ASSERT_TRUE(info.flags.isSet(statistics::init | statistics::display));
+}
@@ -70,6 +70,12 @@ struct Output
     virtual void end() = 0;
     virtual bool valid() const = 0;
 
+    /**
+     * Can the output handle dumps that only contain the stats that
+     * changed since the previous dump?
+     */
+    virtual bool partialDump() const { return false; }
+
     virtual void beginGroup(const char *name) = 0;
     virtual void endGroup() = 0;
 
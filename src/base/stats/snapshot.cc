@@ -0,0 +1,525 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "base/stats/snapshot.hh"
+
+#include <utility>
+
+#include "base/logging.hh"
+#include "base/stats/group.hh"
+#include "base/stats/info.hh"
+#include "base/stats/output.hh"
+#include "sim/cur_tick.hh"
+
+namespace gem5
+{
+
+GEM5_DEPRECATED_NAMESPACE(Stats, statistics);
+namespace statistics
+{
+
+namespace
+{
+
+/** Common part of the frozen copies of a stat. */
+template <class Base>
+class Frozen : public Base
+{
+  protected:
+    bool _zero = true;
+
+    void
+    freeze(const Base &from)
+    {
+        this->name = from.name;
+        this->unit = from.unit;
+        this->desc = from.desc;
+        this->flags = from.flags;
+        this->precision = from.precision;
+        this->prereq = from.prereq && from.prereq->zero() ?
+            &zeroPrereq() : nullptr;
+        _zero = from.zero();
+    }
+
+  public:
+    bool check() const override { return true; }
+    void prepare() override {}
+    void reset() override {}
+    bool zero() const override { return _zero; }
+    void visit(Output &visitor) override { visitor.visit(*this); }
+
+    /**
+     * Stand-in for prerequisites that were zero when the snapshot was
+     * taken, the live prerequisite may change in the meantime.
+     */
+    static const Info &zeroPrereq();
+};
+
+class FrozenScalar : public Frozen<ScalarInfo>
+{
+  private:
+    Counter _value = 0;
+    Result _result = 0;
+    Result _total = 0;
+
+  public:
+    void
+    update(const ScalarInfo &from, std::vector<Counter> &key)
+    {
+        freeze(from);
+        _value = from.value();
+        _result = from.result();
+        _total = from.total();
+        key.push_back(_value);
+        key.push_back(_result);
+    }
+
+    Counter value() const override { return _value; }
+    Result result() const override { return _result; }
+    Result total() const override { return _total; }
+};
+
+template <class Base>
+const Info &
+Frozen<Base>::zeroPrereq()
+{
+    static FrozenScalar prereq;
+    return prereq;
+}
+
+template <class Base>
+class FrozenVectorBase : public Frozen<Base>
+{
+  protected:
+    VCounter cvec;
+    VResult rvec;
+    Result _total = 0;
+
+  public:
+    void
+    update(const Base &from, std::vector<Counter> &key)
+    {
+        this->freeze(from);
+        this->subnames = from.subnames;
+        this->subdescs = from.subdescs;
+        cvec = from.value();
+        rvec = from.result();
+        _total = from.total();
+        key.insert(key.end(), cvec.begin(), cvec.end());
+        key.insert(key.end(), rvec.begin(), rvec.end());
+    }
+
+    size_type size() const override { return rvec.size(); }
+    const VCounter &value() const override { return cvec; }
+    const VResult &result() const override { return rvec; }
+    Result total() const override { return _total; }
+};
+
+typedef FrozenVectorBase<VectorInfo> FrozenVector;
+
+class FrozenFormula : public FrozenVectorBase<FormulaInfo>
+{
+  private:
+    std::string _str;
+
+  public:
+    void
+    update(const FormulaInfo &from, std::vector<Counter> &key)
+    {
+        FrozenVectorBase<FormulaInfo>::update(from, key);
+        _str = from.str();
+    }
+
+    std::string str() const override { return _str; }
+};
+
+void
+distKey(const DistData &data, std::vector<Counter> &key)
+{
+    key.push_back(data.samples);
+    key.push_back(data.sum);
+    key.push_back(data.squares);
+    key.push_back(data.underflow);
+    key.push_back(data.overflow);
+    key.insert(key.end(), data.cvec.begin(), data.cvec.end());
+}
+
+class FrozenDist : public Frozen<DistInfo>
+{
+  public:
+    void
+    update(const DistInfo &from, std::vector<Counter> &key)
+    {
+        freeze(from);
+        data = from.data;
+        distKey(data, key);
+    }
+};
+
+class FrozenVectorDist : public Frozen<VectorDistInfo>
+{
+  public:
+    void
+    update(const VectorDistInfo &from, std::vector<Counter> &key)
+    {
+        freeze(from);
+        subnames = from.subnames;
+        subdescs = from.subdescs;
+        data = from.data;
+        for (const auto &d : data)
+            distKey(d, key);
+    }
+
+    size_type size() const override { return data.size(); }
+};
+
+class FrozenVector2d : public Frozen<Vector2dInfo>
+{
+  private:
+    Result _total = 0;
+
+  public:
+    void
+    update(const Vector2dInfo &from, std::vector<Counter> &key)
+    {
+        freeze(from);
+        subnames = from.subnames;
+        subdescs = from.subdescs;
+        y_subnames = from.y_subnames;
+        x = from.x;
+        y = from.y;
+        cvec = from.cvec;
+        _total = from.total();
+        key.insert(key.end(), cvec.begin(), cvec.end());
+    }
+
+    Result total() const override { return _total; }
+};
+
+class FrozenSparseHist : public Frozen<SparseHistInfo>
+{
+  public:
+    void
+    update(const SparseHistInfo &from, std::vector<Counter> &key)
+    {
+        freeze(from);
+        data = from.data;
+        key.push_back(data.samples);
+        for (const auto &bucket : data.cmap) {
+            key.push_back(bucket.first);
+            key.push_back(bucket.second);
+        }
+    }
+};
+
+} // anonymous namespace
+
+/**
+ * Output that freezes the stats it visits into the entries of a
+ * snapshot, reusing the frozen stats already in place.
+ */
+class Snapshot::Freezer : public Output
+{
+  private:
+    std::vector<Entry> &entries;
+
+    Entry &
+    next()
+    {
+        if (pos == entries.size())
+            entries.emplace_back();
+        return entries[pos++];
+    }
+
+    void
+    mark(Entry::Kind kind, const char *name)
+    {
+        Entry &e = next();
+        if (e.kind != kind || e.group != name) {
+            e = Entry();
+            e.kind = kind;
+            e.group = name;
+        }
+    }
+
+    template <class F, class I>
+    void
+    freeze(const I &info)
+    {
+        Entry &e = next();
+        if (e.kind != Entry::Stat || e.source != &info) {
+            e = Entry();
+            e.source = &info;
+            e.frozen.reset(new F());
+        }
+        e.key.clear();
+        static_cast<F *>(e.frozen.get())->update(info, e.key);
+    }
+
+  public:
+    /** Number of entries filled in so far. */
+    std::size_t pos = 0;
+
+    Freezer(std::vector<Entry> &_entries) : entries(_entries) {}
+
+    void begin() override {}
+    void end() override {}
+    bool valid() const override { return true; }
+
+    void beginGroup(const char *name) override
+    {
+        mark(Entry::BeginGroup, name);
+    }
+
+    void endGroup() override { mark(Entry::EndGroup, ""); }
+
+    void
+    visit(const ScalarInfo &info) override
+    {
+        freeze<FrozenScalar>(info);
+    }
+
+    void
+    visit(const VectorInfo &info) override
+    {
+        freeze<FrozenVector>(info);
+    }
+
+    void
+    visit(const DistInfo &info) override
+    {
+        freeze<FrozenDist>(info);
+    }
+
+    void
+    visit(const VectorDistInfo &info) override
+    {
+        freeze<FrozenVectorDist>(info);
+    }
+
+    void
+    visit(const Vector2dInfo &info) override
+    {
+        freeze<FrozenVector2d>(info);
+    }
+
+    void
+    visit(const FormulaInfo &info) override
+    {
+        freeze<FrozenFormula>(info);
+    }
+
+    void
+    visit(const SparseHistInfo &info) override
+    {
+        freeze<FrozenSparseHist>(info);
+    }
+};
+
+Snapshot::Snapshot()
+    : tick(0)
+{
+}
+
+Snapshot::~Snapshot()
+{
+}
+
+void
+Snapshot::captureGroup(Group &group, Freezer &freezer)
+{
+    for (auto *info : group.getStats()) {
+        if (!info->flags.isSet(filtered))
+            info->visit(freezer);
+    }
+
+    for (auto &child : group.getStatGroups()) {
+        freezer.beginGroup(child.first.c_str());
+        captureGroup(*child.second, freezer);
+        freezer.endGroup();
+    }
+}
+
+void
+Snapshot::capture(Group &root, const std::vector<Info *> &legacy)
+{
+    Freezer freezer(entries);
+
+    tick = curTick();
+    captureGroup(root, freezer);
+    for (auto *info : legacy) {
+        if (!info->flags.isSet(filtered))
+            info->visit(freezer);
+    }
+
+    entries.resize(freezer.pos);
+}
+
+void
+Snapshot::write(Output &output, const Snapshot *prev) const
+{
+    if (!output.valid())
+        return;
+
+    // The hierarchy is fixed once the stats have been enabled, so the
+    // entries of both snapshots line up unless one of them is stale.
+    const bool incremental = prev && output.partialDump() &&
+        prev->entries.size() == entries.size();
+
+    // Outputs may be written from a thread that isn't running an event
+    // queue, let them see the time of the capture instead.
+    Tick now = tick;
+    Tick *saved_tick = Gem5Internal::_curTickPtr;
+    Gem5Internal::_curTickPtr = &now;
+
+    output.begin();
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+        const Entry &e = entries[i];
+        switch (e.kind) {
+          case Entry::BeginGroup:
+            output.beginGroup(e.group.c_str());
+            break;
+          case Entry::EndGroup:
+            output.endGroup();
+            break;
+          case Entry::Stat:
+            if (incremental && prev->entries[i].source == e.source &&
+                prev->entries[i].key == e.key) {
+                break;
+            }
+            e.frozen->visit(output);
+            break;
+        }
+    }
+    output.end();
+
+    Gem5Internal::_curTickPtr = saved_tick;
+}
+
+size_type
+Snapshot::size() const
+{
+    size_type count = 0;
+    for (const auto &e : entries)
+        count += e.kind == Entry::Stat;
+    return count;
+}
+
+AsyncDump::AsyncDump(size_type max_pending)
+    : maxPending(max_pending), busy(false), stopping(false)
+{
+    fatal_if(maxPending == 0, "At least one stats dump must be queueable");
+}
+
+AsyncDump::~AsyncDump()
+{
+    drain();
+}
+
+void
+AsyncDump::dump(Group &root, const std::vector<Output *> &outputs,
+                const std::vector<Info *> &legacy, bool incremental)
+{
+    std::unique_ptr<Snapshot> snapshot;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [this]{ return jobs.size() < maxPending; });
+        if (!pool.empty()) {
+            snapshot = std::move(pool.back());
+            pool.pop_back();
+        }
+        if (!worker.joinable()) {
+            stopping = false;
+            worker = std::thread(&AsyncDump::run, this);
+        }
+    }
+
+    // Only the simulation thread captures, so the live stats can be
+    // read without holding the lock.
+    if (!snapshot)
+        snapshot.reset(new Snapshot());
+    snapshot->capture(root, legacy);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        jobs.push_back(Job{std::move(snapshot), outputs, incremental});
+    }
+    work.notify_one();
+}
+
+void
+AsyncDump::drain()
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (!worker.joinable())
+            return;
+        done.wait(lock, [this]{ return jobs.empty() && !busy; });
+        stopping = true;
+    }
+    work.notify_one();
+    worker.join();
+}
+
+void
+AsyncDump::run()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        work.wait(lock, [this]{ return stopping || !jobs.empty(); });
+        if (jobs.empty())
+            return;
+
+        Job job = std::move(jobs.front());
+        jobs.pop_front();
+        busy = true;
+        done.notify_all();
+        lock.unlock();
+
+        const Snapshot *prev = job.incremental ? last.get() : nullptr;
+        for (auto *output : job.outputs)
+            job.snapshot->write(*output, prev);
+
+        lock.lock();
+        if (last)
+            pool.push_back(std::move(last));
+        last = std::move(job.snapshot);
+        busy = false;
+        done.notify_all();
+    }
+}
+
+AsyncDump &
+asyncDump()
+{
+    static AsyncDump dumper;
+    return dumper;
+}
+
+} // namespace statistics
+} // namespace gem5
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_STATS_SNAPSHOT_HH__
+#define __BASE_STATS_SNAPSHOT_HH__
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "base/compiler.hh"
+#include "base/stats/types.hh"
+#include "base/types.hh"
+
+namespace gem5
+{
+
+GEM5_DEPRECATED_NAMESPACE(Stats, statistics);
+namespace statistics
+{
+
+class Group;
+class Info;
+struct Output;
+
+/**
+ * A frozen copy of the stats of a group hierarchy. Once captured, the
+ * snapshot can be written to an output without touching the live
+ * stats, which allows it to be formatted on a different thread than
+ * the one running the simulation.
+ *
+ * The frozen stats are kept when the snapshot is captured again, so
+ * reusing a snapshot for the same hierarchy only copies values.
+ */
+class Snapshot
+{
+  public:
+    Snapshot();
+    ~Snapshot();
+
+    Snapshot(const Snapshot &) = delete;
+    Snapshot &operator=(const Snapshot &) = delete;
+
+    /**
+     * Freeze the stats below a group. The stats must have been
+     * prepared for dumping. Filtered stats are left out.
+     *
+     * @param root Root of the hierarchy to capture.
+     * @param legacy Stats without a group, appended after the
+     *        hierarchy.
+     */
+    void capture(Group &root, const std::vector<Info *> &legacy = {});
+
+    /**
+     * Write the snapshot to an output. The output sees the simulated
+     * time at which the snapshot was captured as the current tick.
+     *
+     * @param output Output to write to.
+     * @param prev Earlier snapshot of the same hierarchy. If not null
+     *        and the output supports partial dumps, stats that have
+     *        not changed since prev are left out.
+     */
+    void write(Output &output, const Snapshot *prev = nullptr) const;
+
+    /** Number of stats in the snapshot. */
+    size_type size() const;
+
+    /** Tick at which the snapshot was captured. */
+    Tick when() const { return tick; }
+
+  private:
+    class Freezer;
+
+    struct Entry
+    {
+        enum Kind { BeginGroup, EndGroup, Stat };
+
+        Kind kind = Stat;
+        /** Name of the group for BeginGroup entries. */
+        std::string group;
+        /** Stat this entry was frozen from. */
+        const Info *source = nullptr;
+        std::unique_ptr<Info> frozen;
+        /** Values of the stat, used to detect changes. */
+        std::vector<Counter> key;
+    };
+
+    void captureGroup(Group &group, Freezer &freezer);
+
+    std::vector<Entry> entries;
+    Tick tick;
+};
+
+/**
+ * Write stats dumps to a set of outputs from a helper thread. The
+ * simulation thread only freezes the stats into a snapshot and then
+ * continues while the snapshot is formatted in the background.
+ */
+class AsyncDump
+{
+  public:
+    /**
+     * @param max_pending Number of dumps that can be queued before
+     *        the simulation thread waits for the helper thread.
+     */
+    AsyncDump(size_type max_pending = 2);
+    ~AsyncDump();
+
+    AsyncDump(const AsyncDump &) = delete;
+    AsyncDump &operator=(const AsyncDump &) = delete;
+
+    /**
+     * Capture the stats below a group and queue them for output. The
+     * stats must have been prepared for dumping.
+     *
+     * @param root Root of the hierarchy to dump.
+     * @param outputs Outputs to write the dump to. They must not be
+     *        used by anyone else until drain() has been called.
+     * @param legacy Stats without a group, see Snapshot::capture().
+     * @param incremental Leave out stats that haven't changed since
+     *        the previous dump.
+     */
+    void dump(Group &root, const std::vector<Output *> &outputs,
+              const std::vector<Info *> &legacy, bool incremental);
+
+    /**
+     * Wait for all queued dumps to be written and stop the helper
+     * thread. It is restarted by the next dump.
+     */
+    void drain();
+
+  private:
+    struct Job
+    {
+        std::unique_ptr<Snapshot> snapshot;
+        std::vector<Output *> outputs;
+        bool incremental;
+    };
+
+    void run();
+
+    const size_type maxPending;
+
+    std::mutex mutex;
+    /** Signalled when a job is queued or the thread should stop. */
+    std::condition_variable work;
+    /** Signalled when a job has been written. */
+    std::condition_variable done;
+
+    std::deque<Job> jobs;
+    bool busy;
+    bool stopping;
+
+    /** Snapshots that are not in use, recycled by dump(). */
+    std::vector<std::unique_ptr<Snapshot>> pool;
+    /** The most recently written snapshot. */
+    std::unique_ptr<Snapshot> last;
+
+    std::thread worker;
+};
+
+/** The AsyncDump used by the Python stats package. */
+AsyncDump &asyncDump();
+
+} // namespace statistics
+} // namespace gem5
+
+#endif // __BASE_STATS_SNAPSHOT_HH__
@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "base/cprintf.hh"
+#include "base/stats/group.hh"
+#include "base/stats/info.hh"
+#include "base/stats/output.hh"
+#include "base/stats/snapshot.hh"
+#include "sim/cur_tick.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/** Minimal stat info, holding its values directly. */
+template <class Base>
+class TestInfo : public Base
+{
+  public:
+    explicit TestInfo(const std::string &name)
+    {
+        this->name = name;
+        this->flags.set(statistics::init | statistics::display);
+    }
+
+    bool check() const override { return true; }
+    void prepare() override {}
+    void reset() override {}
+    bool zero() const override { return isZero(); }
+    void visit(statistics::Output &visitor) override { visitor.visit(*this); }
+
+    virtual bool isZero() const { return false; }
+};
+
+class ScalarStat : public TestInfo<statistics::ScalarInfo>
+{
+  public:
+    using TestInfo::TestInfo;
+    double v = 0;
+
+    statistics::Counter value() const override { return v; }
+    statistics::Result result() const override { return v; }
+    statistics::Result total() const override { return v; }
+    bool isZero() const override { return v == 0; }
+};
+
+class VectorStat : public TestInfo<statistics::VectorInfo>
+{
+  public:
+    using TestInfo::TestInfo;
+    statistics::VResult v;
+
+    statistics::size_type size() const override { return v.size(); }
+    const statistics::VCounter &value() const override { return v; }
+    const statistics::VResult &result() const override { return v; }
+    statistics::Result total() const override { return 0; }
+};
+
+/** Output recording everything it is shown. */
+class Recorder : public statistics::Output
+{
+  public:
+    std::vector<std::string> lines;
+    bool partial = false;
+
+    void begin() override { lines.push_back(csprintf("begin@%d", curTick())); }
+    void end() override { lines.push_back("end"); }
+    bool valid() const override { return true; }
+    bool partialDump() const override { return partial; }
+
+    void
+    beginGroup(const char *name) override
+    {
+        lines.push_back(csprintf("group %s", name));
+    }
+
+    void endGroup() override { lines.push_back("endgroup"); }
+
+    void
+    visit(const statistics::ScalarInfo &info) override
+    {
+        lines.push_back(csprintf("%s=%g%s", info.name, info.result(),
+                                 info.prereq ? " (prereq)" : ""));
+    }
+
+    void
+    visit(const statistics::VectorInfo &info) override
+    {
+        std::string line = info.name + "=";
+        for (auto r : info.result())
+            line += csprintf("%g,", r);
+        lines.push_back(line);
+    }
+
+    void visit(const statistics::DistInfo &info) override {}
+    void visit(const statistics::VectorDistInfo &info) override {}
+    void visit(const statistics::Vector2dInfo &info) override {}
+    void visit(const statistics::FormulaInfo &info) override {}
+    void visit(const statistics::SparseHistInfo &info) override {}
+};
+
+class StatsSnapshotTest : public testing::Test
+{
+  protected:
+    Tick tick = 0;
+    statistics::Group root;
+    statistics::Group child;
+    ScalarStat scalar;
+    VectorStat vector;
+    ScalarStat nested;
+
+    StatsSnapshotTest()
+        : root(nullptr), child(nullptr), scalar("scalar"),
+          vector("vector"), nested("nested")
+    {
+        Gem5Internal::_curTickPtr = &tick;
+        root.addStat(&scalar);
+        root.addStat(&vector);
+        root.addStatGroup("child", &child);
+        child.addStat(&nested);
+        vector.v = {1, 2};
+    }
+};
+
+} // anonymous namespace
+
+/** Test that a snapshot is not affected by later stat updates. */
+TEST_F(StatsSnapshotTest, CaptureFreezesValues)
+{
+    statistics::Snapshot snapshot;
+    scalar.v = 1;
+    nested.v = 2;
+    tick = 100;
+    snapshot.capture(root);
+    ASSERT_EQ(snapshot.size(), 3);
+    ASSERT_EQ(snapshot.when(), 100);
+
+    scalar.v = 5;
+    vector.v = {3, 4};
+    tick = 200;
+
+    Recorder out;
+    snapshot.write(out);
+    std::vector<std::string> expected = {
+        "begin@100", "scalar=1", "vector=1,2,", "group child", "nested=2",
+        "endgroup", "end" };
+    ASSERT_EQ(out.lines, expected);
+    ASSERT_EQ(curTick(), 200);
+}
+
+/** Test that capturing again updates the frozen values. */
+TEST_F(StatsSnapshotTest, Recapture)
+{
+    statistics::Snapshot snapshot;
+    snapshot.capture(root);
+    scalar.v = 7;
+    snapshot.capture(root);
+
+    Recorder out;
+    snapshot.write(out);
+    ASSERT_EQ(out.lines[1], "scalar=7");
+    ASSERT_EQ(snapshot.size(), 3);
+}
+
+/** Test that legacy stats are appended and filtered stats left out. */
+TEST_F(StatsSnapshotTest, LegacyAndFiltered)
+{
+    ScalarStat legacy("legacy");
+    legacy.v = 3;
+    vector.filter();
+
+    statistics::Snapshot snapshot;
+    snapshot.capture(root, {&legacy});
+    ASSERT_EQ(snapshot.size(), 3);
+
+    Recorder out;
+    snapshot.write(out);
+    std::vector<std::string> expected = {
+        "begin@0", "scalar=0", "group child", "nested=0", "endgroup",
+        "legacy=3", "end" };
+    ASSERT_EQ(out.lines, expected);
+}
+
+/** Test that a prerequisite is resolved when the snapshot is taken. */
+TEST_F(StatsSnapshotTest, Prereq)
+{
+    scalar.prereq = &nested;
+    statistics::Snapshot snapshot;
+    snapshot.capture(root);
+    nested.v = 1;
+
+    Recorder out;
+    snapshot.write(out);
+    ASSERT_EQ(out.lines[1], "scalar=0 (prereq)");
+
+    snapshot.capture(root);
+    out.lines.clear();
+    snapshot.write(out);
+    ASSERT_EQ(out.lines[1], "scalar=0");
+}
+
+/** Test that only changed stats are written to partial outputs. */
+TEST_F(StatsSnapshotTest, Incremental)
+{
+    statistics::Snapshot first, second;
+    first.capture(root);
+    nested.v = 4;
+    second.capture(root);
+
+    Recorder partial;
+    partial.partial = true;
+    second.write(partial, &first);
+    std::vector<std::string> expected = {
+        "begin@0", "group child", "nested=4", "endgroup", "end" };
+    ASSERT_EQ(partial.lines, expected);
+
+    Recorder full;
+    second.write(full, &first);
+    ASSERT_EQ(full.lines.size(), 7);
+}
+
+/** Test that queued dumps are written once drained. */
+TEST_F(StatsSnapshotTest, AsyncDump)
+{
+    statistics::AsyncDump dumper(1);
+    Recorder out;
+    out.partial = true;
+
+    for (int i = 0; i < 3; ++i) {
+        tick = i * 10;
+        scalar.v = i;
+        dumper.dump(root, {&out}, {}, true);
+    }
+    dumper.drain();
+
+    std::vector<std::string> expected = {
+        "begin@0", "scalar=0", "vector=1,2,", "group child", "nested=0",
+        "endgroup", "end",
+        "begin@10", "scalar=1", "group child", "endgroup", "end",
+        "begin@20", "scalar=2", "group child", "endgroup", "end" };
+    ASSERT_EQ(out.lines, expected);
+
+    // The helper thread is restarted by the next dump.
+    tick = 30;
+    dumper.dump(root, {&out}, {}, false);
+    dumper.drain();
+    ASSERT_EQ(out.lines.size(), expected.size() + 7);
+    ASSERT_EQ(out.lines[expected.size()], "begin@30");
+}
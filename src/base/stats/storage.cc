@@ -41,6 +41,7 @@
 
 #include "base/stats/storage.hh"
 
+#include <algorithm>
 #include <cmath>
 
 namespace gem5
@@ -227,5 +228,205 @@ HistStor::add(HistStor *hs)
         cvec[i] += hs->cvec[i];
 }
 
+SketchStor::Params::Params(const std::vector<double> &_quantiles,
+                           double _accuracy, size_type _buckets)
+    : quantiles(_quantiles), accuracy(_accuracy), buckets(_buckets)
+{
+    fatal_if(accuracy <= 0 || accuracy >= 1,
+        "Sketch accuracy (%f) must be between 0 and 1", accuracy);
+    fatal_if(buckets < 2, "A sketch needs at least two buckets");
+    for (auto q : quantiles)
+        fatal_if(q < 0 || q > 1, "Quantile (%f) must be in [0, 1]", q);
+
+    gamma = (1 + accuracy) / (1 - accuracy);
+    logGamma = std::log(gamma);
+}
+
+SketchStor::Store::Store(size_type _capacity)
+    : capacity(_capacity), low(0), minIndex(0), maxIndex(0), total(0)
+{
+}
+
+void
+SketchStor::Store::shift(int new_low)
+{
+    const int size = capacity;
+    if (new_low > low) {
+        // Merge the buckets that fall off the bottom of the window
+        // into the new lowest bucket.
+        const int d = std::min(new_low - low, size);
+        Counter collapsed = 0;
+        for (int i = 0; i < d; ++i)
+            collapsed += counts[i];
+        std::move(counts.begin() + d, counts.end(), counts.begin());
+        std::fill(counts.end() - d, counts.end(), 0);
+        counts[0] += collapsed;
+
+        minIndex = std::max(minIndex, new_low);
+        maxIndex = std::max(maxIndex, new_low);
+    } else if (new_low < low) {
+        // Only called when the highest bucket stays in the window.
+        const int d = low - new_low;
+        assert(d < size);
+        std::move_backward(counts.begin(), counts.end() - d, counts.end());
+        std::fill(counts.begin(), counts.begin() + d, 0);
+    }
+    low = new_low;
+}
+
+void
+SketchStor::Store::add(int index, Counter count)
+{
+    const int size = capacity;
+    if (counts.empty())
+        counts.resize(capacity);
+
+    if (total == 0) {
+        low = index - size / 2;
+        minIndex = index;
+        maxIndex = index;
+    } else if (index < low) {
+        shift(std::max(index, maxIndex - size + 1));
+        index = std::max(index, low);
+    } else if (index >= low + size) {
+        shift(index - size + 1);
+    }
+
+    counts[index - low] += count;
+    total += count;
+    minIndex = std::min(minIndex, index);
+    maxIndex = std::max(maxIndex, index);
+}
+
+int
+SketchStor::Store::find(Counter rank, bool ascending) const
+{
+    assert(rank < total);
+    Counter seen = 0;
+    if (ascending) {
+        for (int i = minIndex; i < maxIndex; ++i) {
+            seen += counts[i - low];
+            if (seen > rank)
+                return i;
+        }
+        return maxIndex;
+    } else {
+        for (int i = maxIndex; i > minIndex; --i) {
+            seen += counts[i - low];
+            if (seen > rank)
+                return i;
+        }
+        return minIndex;
+    }
+}
+
+void
+SketchStor::Store::clear()
+{
+    std::fill(counts.begin(), counts.end(), 0);
+    total = 0;
+}
+
+SketchStor::SketchStor(const StorageParams* const storage_params)
+    : gamma(safe_cast<const Params *>(storage_params)->gamma),
+      logGamma(safe_cast<const Params *>(storage_params)->logGamma),
+      positive(safe_cast<const Params *>(storage_params)->buckets),
+      negative(safe_cast<const Params *>(storage_params)->buckets)
+{
+    reset(storage_params);
+}
+
+void
+SketchStor::sample(Counter val, int number)
+{
+    if (val > 0)
+        positive.add(index(val), number);
+    else if (val < 0)
+        negative.add(index(-val), number);
+    else
+        zeros += number;
+
+    if (val < min_val)
+        min_val = val;
+
+    if (val > max_val)
+        max_val = val;
+
+    sum += val * number;
+    samples += number;
+}
+
+Counter
+SketchStor::quantile(double q) const
+{
+    if (samples <= 0)
+        return 0;
+
+    // The extremes are known exactly.
+    Counter rank = std::floor(q * (samples - 1));
+    if (rank <= 0)
+        return min_val;
+    if (rank >= samples - 1)
+        return max_val;
+
+    Counter val;
+    if (rank < negative.total) {
+        val = -value(negative.find(rank, false));
+    } else if (rank < negative.total + zeros) {
+        val = 0;
+    } else {
+        rank -= negative.total + zeros;
+        val = value(positive.find(rank, true));
+    }
+
+    return std::min(std::max(val, min_val), max_val);
+}
+
+void
+SketchStor::prepare(const StorageParams* const storage_params,
+                    VCounter &vec) const
+{
+    const Params *params = safe_cast<const Params *>(storage_params);
+
+    vec.resize(4 + params->quantiles.size());
+    vec[0] = samples;
+    vec[1] = samples ? sum / samples : 0;
+    vec[2] = samples ? min_val : 0;
+    vec[3] = samples ? max_val : 0;
+    for (off_type i = 0; i < params->quantiles.size(); ++i)
+        vec[4 + i] = quantile(params->quantiles[i]);
+}
+
+void
+SketchStor::add(const SketchStor *other)
+{
+    fatal_if(gamma != other->gamma,
+             "Can't merge sketches with different accuracies");
+
+    other->positive.forEach(
+        [this](int i, Counter count) { positive.add(i, count); });
+    other->negative.forEach(
+        [this](int i, Counter count) { negative.add(i, count); });
+    zeros += other->zeros;
+
+    min_val = std::min(min_val, other->min_val);
+    max_val = std::max(max_val, other->max_val);
+    sum += other->sum;
+    samples += other->samples;
+}
+
+void
+SketchStor::reset(const StorageParams* const storage_params)
+{
+    positive.clear();
+    negative.clear();
+    zeros = Counter();
+
+    min_val = CounterLimits::max();
+    max_val = CounterLimits::lowest();
+    sum = Counter();
+    samples = Counter();
+}
+
 } // namespace statistics
 } // namespace gem5
@@ -32,6 +32,7 @@
 
 #include <cassert>
 #include <cmath>
+#include <vector>
 
 #include "base/cast.hh"
 #include "base/compiler.hh"
@@ -782,6 +783,172 @@ class SparseHistStor
     }
 };
 
+/**
+ * Storage for a quantile sketch, following the DDSketch algorithm.
+ * Samples are counted in buckets whose bounds grow geometrically, so
+ * that any estimated quantile is within a fixed relative error of the
+ * exact value. The number of buckets is fixed when the stat is
+ * initialized. If the sampled range needs more buckets, the lowest
+ * buckets are merged, which only degrades the lowest quantiles.
+ * Sketches with the same parameters can be merged.
+ */
+class SketchStor
+{
+  public:
+    /** The parameters for a quantile sketch stat. */
+    struct Params : public StorageParams
+    {
+        /** The quantiles to report, each in [0, 1]. */
+        std::vector<double> quantiles;
+        /** The relative accuracy of the estimated quantiles. */
+        double accuracy;
+        /** The maximum number of buckets for each sign. */
+        size_type buckets;
+        /** The ratio between the bounds of adjacent buckets. */
+        double gamma;
+        /** The natural logarithm of gamma. */
+        double logGamma;
+
+        Params(const std::vector<double> &_quantiles, double _accuracy,
+               size_type _buckets);
+    };
+
+  private:
+    /**
+     * Buckets for the samples of one sign. A sample of magnitude v is
+     * counted in the bucket with index ceil(log_gamma(v)). The buckets
+     * cover a window of consecutive indices that moves with the
+     * samples; they are allocated on the first sample.
+     */
+    class Store
+    {
+      private:
+        VCounter counts;
+        /** The maximum number of buckets. */
+        size_type capacity;
+        /** The index of the first bucket. */
+        int low;
+        /** The lowest and highest index with samples. */
+        int minIndex;
+        int maxIndex;
+
+        /** Move the window of buckets to start at a new index. */
+        void shift(int new_low);
+
+      public:
+        /** The number of samples in the store. */
+        Counter total;
+
+        Store(size_type _capacity);
+
+        void add(int index, Counter count);
+
+        /**
+         * Find the bucket of the sample with the given rank.
+         * @param rank The rank of the sample, starting from zero.
+         * @param ascending Count from the lowest index.
+         * @return The index of the bucket.
+         */
+        int find(Counter rank, bool ascending) const;
+
+        /** Call f(index, count) for each bucket with samples. */
+        template <class F>
+        void
+        forEach(F f) const
+        {
+            if (total == 0)
+                return;
+            for (int i = minIndex; i <= maxIndex; ++i) {
+                if (counts[i - low] != 0)
+                    f(i, counts[i - low]);
+            }
+        }
+
+        void clear();
+    };
+
+    /** Copied from the parameters to avoid looking them up. */
+    double gamma;
+    double logGamma;
+
+    /** The samples with a positive value. */
+    Store positive;
+    /** The samples with a negative value, indexed by magnitude. */
+    Store negative;
+    /** The number of samples equal to zero. */
+    Counter zeros;
+
+    /** The smallest value sampled. */
+    Counter min_val;
+    /** The largest value sampled. */
+    Counter max_val;
+    /** The current sum. */
+    Counter sum;
+    /** The number of samples. */
+    Counter samples;
+
+    /** The bucket index of a positive value. */
+    int
+    index(Counter val) const
+    {
+        return (int)std::ceil(std::log(val) / logGamma);
+    }
+
+    /** The value representing the bucket with the given index. */
+    Counter
+    value(int index) const
+    {
+        return 2.0 * std::exp(index * logGamma) / (gamma + 1.0);
+    }
+
+  public:
+    SketchStor(const StorageParams* const storage_params);
+
+    /**
+     * Add a value to the sketch for the given number of times.
+     * @param val The value to add.
+     * @param number The number of times to add the value.
+     */
+    void sample(Counter val, int number);
+
+    /**
+     * Estimate a quantile of the sampled values.
+     * @param q The quantile, in [0, 1].
+     * @return The estimated value, or zero if there are no samples.
+     */
+    Counter quantile(double q) const;
+
+    /**
+     * Returns true if any calls to sample have been made.
+     * @return True if any values have been sampled.
+     */
+    bool
+    zero() const
+    {
+        return samples == Counter();
+    }
+
+    /** The number of samples. */
+    Counter count() const { return samples; }
+
+    /**
+     * Fill in the values reported by the stat: the number of samples,
+     * their mean, minimum and maximum, followed by the quantiles.
+     */
+    void prepare(const StorageParams* const storage_params,
+                 VCounter &vec) const;
+
+    /**
+     * Merge the samples of another sketch with the same parameters.
+     */
+    void add(const SketchStor *other);
+
+    /**
+     * Reset stat value to default
+     */
+    void reset(const StorageParams* const storage_params);
+};
+
 } // namespace statistics
 } // namespace gem5
 
@@ -1214,3 +1214,146 @@ TEST(StatsSparseHistStorTest, SamplePrepare)
     }
     ASSERT_EQ(data.samples, total_samples);
 }
+
+/**
+ * Test whether zero is correctly set as the reset value. The test order is
+ * to check if it is initially zero on creation, then it is made non zero,
+ * and finally reset to zero.
+ */
+TEST(StatsSketchStorTest, ZeroReset)
+{
+    statistics::SketchStor::Params params({0.5}, 0.01, 64);
+    statistics::SketchStor stor(&params);
+
+    ASSERT_TRUE(stor.zero());
+    ASSERT_EQ(stor.quantile(0.5), 0);
+
+    stor.sample(10, 5);
+    ASSERT_FALSE(stor.zero());
+    ASSERT_EQ(stor.count(), 5);
+
+    stor.reset(&params);
+    ASSERT_TRUE(stor.zero());
+    ASSERT_EQ(stor.quantile(0.5), 0);
+}
+
+/** Test that invalid parameters are rejected. */
+TEST(StatsSketchStorDeathTest, BadParams)
+{
+    gtestLogOutput.str("");
+    ASSERT_ANY_THROW(statistics::SketchStor::Params({0.5}, 0, 64));
+    ASSERT_ANY_THROW(statistics::SketchStor::Params({0.5}, 1, 64));
+    ASSERT_ANY_THROW(statistics::SketchStor::Params({1.5}, 0.01, 64));
+    ASSERT_ANY_THROW(statistics::SketchStor::Params({0.5}, 0.01, 1));
+}
+
+/** Test that the quantiles are within the requested relative error. */
+TEST(StatsSketchStorTest, Accuracy)
+{
+    const double accuracy = 0.01;
+    statistics::SketchStor::Params params({}, accuracy, 1024);
+    statistics::SketchStor stor(&params);
+
+    const int n = 100000;
+    for (int i = 1; i <= n; i++)
+        stor.sample(i, 1);
+
+    for (double q : {0.0, 0.1, 0.5, 0.9, 0.99, 0.999, 1.0}) {
+        const double exact = 1 + std::floor(q * (n - 1));
+        ASSERT_NEAR(stor.quantile(q), exact, exact * accuracy) << q;
+    }
+    ASSERT_EQ(stor.quantile(0), 1);
+    ASSERT_EQ(stor.quantile(1), n);
+}
+
+/** Test that negative and zero values are ordered correctly. */
+TEST(StatsSketchStorTest, NegativeAndZero)
+{
+    statistics::SketchStor::Params params({}, 0.01, 512);
+    statistics::SketchStor stor(&params);
+
+    stor.sample(-100, 2);
+    stor.sample(-1, 2);
+    stor.sample(0, 2);
+    stor.sample(50, 4);
+
+    ASSERT_EQ(stor.quantile(0), -100);
+    ASSERT_NEAR(stor.quantile(0.1), -100, 1);
+    ASSERT_NEAR(stor.quantile(0.3), -1, 0.01);
+    ASSERT_EQ(stor.quantile(0.5), 0);
+    ASSERT_NEAR(stor.quantile(0.7), 50, 0.5);
+    ASSERT_EQ(stor.quantile(1), 50);
+}
+
+/**
+ * Test that running out of buckets merges the lowest buckets and keeps
+ * the high quantiles accurate.
+ */
+TEST(StatsSketchStorTest, Collapse)
+{
+    const double accuracy = 0.01;
+    statistics::SketchStor::Params params({}, accuracy, 32);
+    statistics::SketchStor stor(&params);
+
+    // Samples spanning six orders of magnitude, far more than 32
+    // buckets can cover.
+    for (double v = 1; v < 1e6; v *= 1.5)
+        stor.sample(v, 1);
+    stor.sample(1e6, 1);
+
+    ASSERT_EQ(stor.quantile(0), 1);
+    ASSERT_EQ(stor.quantile(1), 1e6);
+    const double p98 = std::pow(1.5, 34);
+    ASSERT_NEAR(stor.quantile(0.98), p98, p98 * accuracy);
+
+    // Sampling below the window moves the lowest bucket, not the
+    // highest one.
+    stor.sample(0.5, 100);
+    ASSERT_EQ(stor.quantile(1), 1e6);
+    ASSERT_EQ(stor.quantile(0), 0.5);
+}
+
+/** Test that merging sketches is the same as sampling into one. */
+TEST(StatsSketchStorTest, Add)
+{
+    statistics::SketchStor::Params params({}, 0.02, 128);
+    statistics::SketchStor a(&params), b(&params), all(&params);
+
+    for (int i = 0; i < 1000; i++) {
+        statistics::SketchStor &half = i % 2 ? a : b;
+        half.sample(i * 7 % 1013, 1);
+        all.sample(i * 7 % 1013, 1);
+    }
+    a.add(&b);
+
+    ASSERT_EQ(a.count(), all.count());
+    for (double q : {0.0, 0.25, 0.5, 0.75, 0.99, 1.0})
+        ASSERT_EQ(a.quantile(q), all.quantile(q)) << q;
+
+    statistics::SketchStor::Params other({}, 0.01, 128);
+    statistics::SketchStor c(&other);
+    gtestLogOutput.str("");
+    ASSERT_ANY_THROW(a.add(&c));
+}
+
+/** Test the values reported by prepare. */
+TEST(StatsSketchStorTest, Prepare)
+{
+    statistics::SketchStor::Params params({0.5, 1.0}, 0.01, 64);
+    statistics::SketchStor stor(&params);
+    statistics::VCounter vec;
+
+    stor.prepare(&params, vec);
+    ASSERT_EQ(vec, statistics::VCounter({0, 0, 0, 0, 0, 0}));
+
+    stor.sample(10, 3);
+    stor.sample(20, 1);
+    stor.prepare(&params, vec);
+    ASSERT_EQ(vec.size(), 6);
+    ASSERT_EQ(vec[0], 4);
+    ASSERT_EQ(vec[1], 12.5);
+    ASSERT_EQ(vec[2], 10);
+    ASSERT_EQ(vec[3], 20);
+    ASSERT_NEAR(vec[4], 10, 0.1);
+    ASSERT_EQ(vec[5], 20);
+}
@@ -99,6 +99,7 @@ class Text : public Output
 
     // Implement Output
     bool valid() const override;
+    bool partialDump() const override { return true; }
     void begin() override;
     void end() override;
 };
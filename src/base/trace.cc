@@ -145,6 +145,17 @@ Logger::dump(Tick when, const std::string &name,
     }
 }
 
+uint8_t
+Logger::binaryFormat()
+{
+    uint8_t format = 0;
+    if (debug::FmtTicksOff)
+        format |= binary_trace::TicksOff;
+    if (debug::FmtFlag)
+        format |= binary_trace::ShowFlag;
+    return format;
+}
+
 void
 OstreamLogger::logMessage(Tick when, const std::string &name,
         const std::string &flag, const std::string &message)
@@ -170,5 +181,104 @@ OstreamLogger::logMessage(Tick when, const std::string &name,
     }
 }
 
+BinaryTextBuf::int_type
+BinaryTextBuf::overflow(int_type c)
+{
+    if (traits_type::eq_int_type(c, traits_type::eof()))
+        return traits_type::not_eof(c);
+
+    line.push_back(traits_type::to_char_type(c));
+    if (c == '\n')
+        sync();
+    return c;
+}
+
+std::streamsize
+BinaryTextBuf::xsputn(const char *s, std::streamsize n)
+{
+    line.append(s, n);
+    if (line.find('\n') != std::string::npos)
+        sync();
+    return n;
+}
+
+int
+BinaryTextBuf::sync()
+{
+    // Text written straight to the stream carries its own prefix, so it
+    // is recorded without a tick or name.
+    if (!line.empty()) {
+        encoder.text(MaxTick, "", "", 0, line);
+        line.clear();
+    }
+    return 0;
+}
+
+BinaryLogger::BinaryLogger(std::ostream &stream)
+    : writer(stream), textBuf(writer), textStream(&textBuf)
+{
+    binaryEncoder = &writer;
+}
+
+BinaryLogger::~BinaryLogger()
+{
+    textStream.flush();
+}
+
+void
+BinaryLogger::logMessage(Tick when, const std::string &name,
+        const std::string &flag, const std::string &message)
+{
+    if (!name.empty() && ignore.match(name))
+        return;
+
+    writer.text(when, name, flag, binaryFormat(), message);
+}
+
+void
+BinaryLogger::flush()
+{
+    textStream.flush();
+    writer.flush();
+}
+
+void
+BinaryLogger::prepareFork()
+{
+    flush();
+}
+
+FlightRecorder::FlightRecorder(std::ostream &stream_, std::size_t capacity)
+    : stream(stream_), ring(trace, capacity), textBuf(ring),
+      textStream(&textBuf)
+{
+    binaryEncoder = &ring;
+}
+
+void
+FlightRecorder::logMessage(Tick when, const std::string &name,
+        const std::string &flag, const std::string &message)
+{
+    if (!name.empty() && ignore.match(name))
+        return;
+
+    ring.text(when, name, flag, binaryFormat(), message);
+}
+
+void
+FlightRecorder::flush()
+{
+    textStream.flush();
+
+    trace.str("");
+    trace.clear();
+    ring.flush();
+
+    BinaryReader reader(trace);
+    while (reader.next(stream))
+        ;
+    stream.flush();
+}
+
 } // namespace Trace
 } // namespace gem5
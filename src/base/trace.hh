@@ -33,6 +33,7 @@
 #define __BASE_TRACE_HH__
 
 #include <ostream>
+#include <streambuf>
 #include <string>
 #include <sstream>
 
@@ -40,6 +41,7 @@
 #include "base/cprintf.hh"
 #include "base/debug.hh"
 #include "base/match.hh"
+#include "base/trace_binary.hh"
 #include "base/types.hh"
 #include "sim/cur_tick.hh"
 
@@ -61,6 +63,15 @@ class Logger
     /** Name match for objects to ignore */
     ObjectMatch ignore;
 
+    /**
+     * Set by loggers that record the raw message arguments instead of
+     * formatted text.
+     */
+    BinaryEncoder *binaryEncoder = nullptr;
+
+    /** @return The binary_trace::FormatBits currently in effect. */
+    static uint8_t binaryFormat();
+
   public:
     /** Log a single message */
     template <typename ...Args>
@@ -78,6 +89,13 @@ class Logger
     {
         if (!name.empty() && ignore.match(name))
             return;
+        if constexpr (binary_trace::encodable<Args...>) {
+            if (binaryEncoder) {
+                binaryEncoder->message(when, name, flag, binaryFormat(), fmt,
+                                       args...);
+                return;
+            }
+        }
         std::ostringstream line;
         ccprintf(line, fmt, args...);
         logMessage(when, name, flag, line.str());
@@ -98,6 +116,16 @@ class Logger
      *  way, or just set to one of std::cout, std::cerr */
     virtual std::ostream &getOstream() = 0;
 
+    /** Write out any messages the logger has buffered. */
+    virtual void flush() {}
+
+    /**
+     * Stop any helper thread before the simulator forks. Messages that
+     * are only written out on demand, like those of a FlightRecorder,
+     * are kept.
+     */
+    virtual void prepareFork() {}
+
     /** Set objects to ignore */
     void setIgnore(ObjectMatch &ignore_) { ignore = ignore_; }
 
@@ -124,6 +152,87 @@ class OstreamLogger : public Logger
     std::ostream &getOstream() override { return stream; }
 };
 
+/**
+ * Stream buffer that records the text written to a binary logger's
+ * getOstream() as Text records, one per line.
+ */
+class BinaryTextBuf : public std::streambuf
+{
+  protected:
+    BinaryEncoder &encoder;
+    std::string line;
+
+    int_type overflow(int_type c) override;
+    std::streamsize xsputn(const char *s, std::streamsize n) override;
+    int sync() override;
+
+  public:
+    BinaryTextBuf(BinaryEncoder &encoder_) : encoder(encoder_) {}
+};
+
+/**
+ * Logger that records messages in the binary format described in
+ * base/trace_binary.hh. Formatting is deferred to an offline decoder
+ * (util/decode_debug_trace), which produces the same text as
+ * OstreamLogger. Messages are buffered per thread and written by a
+ * helper thread, so flush() must be called before the output is read.
+ * FmtStackTrace is not supported.
+ */
+class BinaryLogger : public Logger
+{
+  protected:
+    BinaryWriter writer;
+    BinaryTextBuf textBuf;
+    std::ostream textStream;
+
+  public:
+    BinaryLogger(std::ostream &stream);
+    ~BinaryLogger();
+
+    void logMessage(Tick when, const std::string &name,
+            const std::string &flag, const std::string &message) override;
+
+    std::ostream &getOstream() override { return textStream; }
+
+    void flush() override;
+
+    /** Write out the buffered messages, which stops the helper thread. */
+    void prepareFork() override;
+};
+
+/**
+ * Flight recorder that keeps the most recent messages in memory, using
+ * the same binary records as BinaryLogger. Nothing is formatted until
+ * flush() is called, at which point the recorded messages are written to
+ * the stream as OstreamLogger would have written them and discarded.
+ * This is meant to be flushed when the simulator panics, so debug flags
+ * can be left on for long runs at a fraction of the cost of tracing.
+ */
+class FlightRecorder : public Logger
+{
+  protected:
+    std::ostream &stream;
+    /** Binary trace of the ring buffers' contents, built by flush(). */
+    std::stringstream trace;
+    BinaryRing ring;
+    BinaryTextBuf textBuf;
+    std::ostream textStream;
+
+  public:
+    /**
+     * @param stream Stream to write the recorded messages to.
+     * @param capacity Size of the ring buffer of each thread in bytes.
+     */
+    FlightRecorder(std::ostream &stream, std::size_t capacity);
+
+    void logMessage(Tick when, const std::string &name,
+            const std::string &flag, const std::string &message) override;
+
+    std::ostream &getOstream() override { return textStream; }
+
+    void flush() override;
+};
+
 /** Get the current global debug logger.  This takes ownership of the given
  *  logger which should be allocated using 'new' */
 Logger *getDebugLogger();
@@ -0,0 +1,489 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "base/trace_binary.hh"
+
+#include <sstream>
+
+namespace gem5
+{
+
+namespace Trace {
+
+using namespace binary_trace;
+
+std::atomic<uint64_t> BinaryEncoder::nextSerial(1);
+
+BinaryEncoder::BinaryEncoder()
+    : serial(nextSerial++)
+{
+}
+
+BinaryEncoder::~BinaryEncoder()
+{
+}
+
+void
+BinaryEncoder::writeHeader(std::ostream &os)
+{
+    os.write(magic, sizeof(magic));
+    os.write(reinterpret_cast<const char *>(&version), sizeof(version));
+}
+
+void
+BinaryEncoder::text(Tick when, const std::string &name,
+                    const std::string &flag, uint8_t format,
+                    const std::string &message)
+{
+    Buffer &buf = buffer();
+    const uint32_t name_id = buf.intern(*this, name);
+    const uint32_t flag_id = buf.intern(*this, flag);
+    const std::size_t start = buf.data.size();
+
+    buf.put(Text);
+    buf.put(format);
+    buf.put(uint64_t(when));
+    buf.put(name_id);
+    buf.put(flag_id);
+    buf.putString(message.data(), message.size());
+    commit(buf, start);
+}
+
+BinaryEncoder::Buffer &
+BinaryEncoder::threadBuffer()
+{
+    std::lock_guard<std::mutex> guard(lock);
+    auto &buf = buffers[std::this_thread::get_id()];
+    if (!buf)
+        buf.reset(newBuffer());
+    return *buf;
+}
+
+uint32_t
+BinaryEncoder::define(const std::string &str)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    auto [it, inserted] = ids.emplace(str, uint32_t(ids.size()));
+    if (inserted) {
+        definitions.push_back(StringDef);
+        const char *id = reinterpret_cast<const char *>(&it->second);
+        definitions.insert(definitions.end(), id, id + sizeof(uint32_t));
+        const uint32_t len = str.size();
+        const char *l = reinterpret_cast<const char *>(&len);
+        definitions.insert(definitions.end(), l, l + sizeof(len));
+        definitions.insert(definitions.end(), str.begin(), str.end());
+    }
+    return it->second;
+}
+
+BinaryWriter::BinaryWriter(std::ostream &_os, std::size_t chunk_size,
+                           std::size_t max_pending)
+    : os(_os), chunkSize(chunk_size),
+      maxPending(max_pending ? max_pending : 1)
+{
+    writeHeader(os);
+}
+
+BinaryWriter::~BinaryWriter()
+{
+    flush();
+}
+
+void
+BinaryWriter::submit(Buffer &buf)
+{
+    std::unique_lock<std::mutex> guard(lock);
+
+    // The helper thread is started on demand so that flush() can stop it,
+    // e.g. before the simulator forks.
+    if (!thread.joinable()) {
+        stop = false;
+        thread = std::thread([this]() { drain(); });
+    }
+
+    wakeProducer.wait(guard, [this]() {
+        return pending.size() < maxPending;
+    });
+    pending.emplace_back();
+    pending.back().swap(buf.data);
+    wakeWriter.notify_one();
+    guard.unlock();
+
+    buf.data.reserve(chunkSize);
+}
+
+void
+BinaryWriter::drain()
+{
+    std::unique_lock<std::mutex> guard(lock);
+    while (true) {
+        wakeWriter.wait(guard, [this]() {
+            return stop || !pending.empty();
+        });
+        if (pending.empty())
+            break;
+
+        std::vector<char> chunk(std::move(pending.front()));
+        pending.pop_front();
+        // Every id used by the chunk was defined before it was queued.
+        std::vector<char> defs;
+        defs.swap(definitions);
+        wakeProducer.notify_all();
+        guard.unlock();
+
+        os.write(defs.data(), defs.size());
+        os.write(chunk.data(), chunk.size());
+
+        guard.lock();
+    }
+    os.flush();
+}
+
+void
+BinaryWriter::flush()
+{
+    std::vector<Buffer *> bufs;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        for (auto &b : buffers)
+            bufs.push_back(b.second.get());
+    }
+    for (auto *buf : bufs) {
+        if (!buf->data.empty())
+            submit(*buf);
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stop = true;
+        wakeWriter.notify_one();
+    }
+    if (thread.joinable())
+        thread.join();
+    os.flush();
+}
+
+BinaryRing::BinaryRing(std::ostream &_os, std::size_t _capacity)
+    : os(_os), capacity(_capacity)
+{
+}
+
+BinaryEncoder::Buffer *
+BinaryRing::newBuffer()
+{
+    Ring *ring = new Ring;
+    ring->ring.resize(capacity);
+    return ring;
+}
+
+void
+BinaryRing::Ring::pop()
+{
+    uint32_t len;
+    std::memcpy(&len, &ring[head], sizeof(len));
+    head += sizeof(len) + len;
+
+    if (--count == 0) {
+        head = tail = 0;
+        wrapped = false;
+    } else if (wrapped && head == wrapEnd) {
+        head = 0;
+        wrapped = false;
+    }
+}
+
+void
+BinaryRing::Ring::push(const char *rec, uint32_t len)
+{
+    const std::size_t size = sizeof(len) + len;
+    if (size > ring.size()) {
+        dropped++;
+        return;
+    }
+
+    // Records are never split, so when one does not fit at the end of the
+    // ring it is written at the start and the space after the last record
+    // is left unused.
+    while (true) {
+        if (!wrapped) {
+            if (tail + size <= ring.size())
+                break;
+            wrapEnd = tail;
+            tail = 0;
+            wrapped = true;
+        }
+        if (tail + size <= head)
+            break;
+        pop();
+        dropped++;
+    }
+
+    std::memcpy(&ring[tail], &len, sizeof(len));
+    std::memcpy(&ring[tail + sizeof(len)], rec, len);
+    tail += size;
+    count++;
+}
+
+template <typename Func>
+void
+BinaryRing::Ring::forEach(Func func) const
+{
+    auto visit = [this, &func](std::size_t from, std::size_t to) {
+        while (from < to) {
+            uint32_t len;
+            std::memcpy(&len, &ring[from], sizeof(len));
+            func(&ring[from + sizeof(len)], len);
+            from += sizeof(len) + len;
+        }
+    };
+
+    if (count == 0)
+        return;
+    if (wrapped) {
+        visit(head, wrapEnd);
+        visit(0, tail);
+    } else {
+        visit(head, tail);
+    }
+}
+
+void
+BinaryRing::flush()
+{
+    struct Record
+    {
+        uint64_t when;
+        const char *data;
+        uint32_t len;
+    };
+
+    std::lock_guard<std::mutex> guard(lock);
+
+    std::vector<std::vector<Record>> rings;
+    for (auto &b : buffers) {
+        // Text written to the logger's ostream has no tick of its own, so
+        // keep it next to the record before it.
+        auto &records = rings.emplace_back();
+        uint64_t last = 0;
+        static_cast<const Ring &>(*b.second).forEach(
+            [&records, &last](const char *data, uint32_t len) {
+                uint64_t when;
+                std::memcpy(&when, data + 2, sizeof(when));
+                if (when == MaxTick)
+                    when = last;
+                last = when;
+                records.push_back({ when, data, len });
+            });
+    }
+
+    // Merge the threads' records by tick, keeping each thread's records
+    // in the order they were logged.
+    std::vector<Record> records;
+    std::vector<std::size_t> next(rings.size(), 0);
+    while (true) {
+        std::size_t best = rings.size();
+        for (std::size_t i = 0; i < rings.size(); i++) {
+            if (next[i] < rings[i].size() &&
+                (best == rings.size() ||
+                 rings[i][next[i]].when < rings[best][next[best]].when)) {
+                best = i;
+            }
+        }
+        if (best == rings.size())
+            break;
+        records.push_back(rings[best][next[best]++]);
+    }
+
+    writeHeader(os);
+    os.write(definitions.data(), definitions.size());
+    for (const auto &rec : records)
+        os.write(rec.data, rec.len);
+    os.flush();
+
+    for (auto &b : buffers) {
+        Ring &ring = static_cast<Ring &>(*b.second);
+        ring.head = ring.tail = ring.count = 0;
+        ring.wrapped = false;
+    }
+}
+
+uint64_t
+BinaryRing::dropped()
+{
+    std::lock_guard<std::mutex> guard(lock);
+    uint64_t total = 0;
+    for (auto &b : buffers)
+        total += static_cast<const Ring &>(*b.second).dropped;
+    return total;
+}
+
+BinaryReader::BinaryReader(std::istream &_is)
+    : is(_is)
+{
+    char m[sizeof(magic)];
+    uint32_t v;
+    if (!is.read(m, sizeof(m)) || std::memcmp(m, magic, sizeof(m)) != 0)
+        fail("Not a binary debug trace");
+    else if (!get(v) || v != version)
+        fail(csprintf("Unsupported binary debug trace version %d", v));
+}
+
+bool
+BinaryReader::fail(const std::string &msg)
+{
+    error_ = msg;
+    return false;
+}
+
+bool
+BinaryReader::getString(std::string &str)
+{
+    uint32_t len;
+    if (!get(len))
+        return false;
+    str.resize(len);
+    return len == 0 || bool(is.read(&str[0], len));
+}
+
+bool
+BinaryReader::lookup(uint32_t id, const std::string *&str)
+{
+    if (id >= strings.size())
+        return fail(csprintf("Undefined string id %d", id));
+    str = &strings[id];
+    return true;
+}
+
+bool
+BinaryReader::replayArg(cp::Print &print)
+{
+    uint8_t type;
+    if (!get(type))
+        return false;
+
+    switch (type) {
+      case Bool: return replay<bool>(print);
+      case Char: return replay<char>(print);
+      case SignedChar: return replay<signed char>(print);
+      case UnsignedChar: return replay<unsigned char>(print);
+      case Short: return replay<short>(print);
+      case UnsignedShort: return replay<unsigned short>(print);
+      case Int: return replay<int>(print);
+      case UnsignedInt: return replay<unsigned int>(print);
+      case Long: return replay<long>(print);
+      case UnsignedLong: return replay<unsigned long>(print);
+      case LongLong: return replay<long long>(print);
+      case UnsignedLongLong: return replay<unsigned long long>(print);
+      case Float: return replay<float>(print);
+      case Double: return replay<double>(print);
+      case String:
+        {
+            std::string str;
+            if (!getString(str))
+                return false;
+            print.addArg(str);
+            return true;
+        }
+      default:
+        return fail(csprintf("Unknown argument type %d", type));
+    }
+}
+
+bool
+BinaryReader::next(std::ostream &os)
+{
+    if (!valid())
+        return false;
+
+    uint8_t type;
+    while (get(type)) {
+        if (type == StringDef) {
+            uint32_t id;
+            std::string str;
+            if (!get(id) || !getString(str))
+                return fail("Truncated string record");
+            if (id != strings.size())
+                return fail(csprintf("Unexpected string id %d", id));
+            strings.push_back(std::move(str));
+            continue;
+        }
+
+        if (type != Message && type != Text)
+            return fail(csprintf("Unknown record type %d", type));
+
+        uint8_t format;
+        uint64_t when;
+        uint32_t name_id, flag_id;
+        const std::string *name, *flag;
+        if (!get(format) || !get(when) || !get(name_id) || !get(flag_id))
+            return fail("Truncated record");
+        if (!lookup(name_id, name) || !lookup(flag_id, flag))
+            return false;
+
+        std::ostringstream line;
+        if (type == Text) {
+            std::string message;
+            if (!getString(message))
+                return fail("Truncated text record");
+            line << message;
+        } else {
+            uint32_t fmt_id;
+            uint8_t nargs;
+            const std::string *fmt;
+            if (!get(fmt_id) || !get(nargs))
+                return fail("Truncated message record");
+            if (!lookup(fmt_id, fmt))
+                return false;
+
+            cp::Print print(line, fmt->c_str());
+            for (int i = 0; i < nargs; i++) {
+                if (!replayArg(print))
+                    return error_.empty() ?
+                        fail("Truncated message arguments") : false;
+            }
+            print.endArgs();
+        }
+
+        // This must match OstreamLogger::logMessage().
+        if (!(format & TicksOff) && (Tick(when) != MaxTick))
+            ccprintf(os, "%7d: ", Tick(when));
+
+        if ((format & ShowFlag) && !flag->empty())
+            os << *flag << ": ";
+
+        if (!name->empty())
+            os << *name << ": ";
+
+        os << line.str();
+        return true;
+    }
+    return false;
+}
+
+} // namespace Trace
+} // namespace gem5
@@ -0,0 +1,496 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_TRACE_BINARY_HH__
+#define __BASE_TRACE_BINARY_HH__
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "base/compiler.hh"
+#include "base/cprintf.hh"
+#include "base/types.hh"
+
+namespace gem5
+{
+
+namespace Trace {
+
+/**
+ * Binary debug trace format.
+ *
+ * A trace starts with an 8 byte magic string and a 32 bit version,
+ * followed by a sequence of records. Each record starts with a one byte
+ * RecordType. Object names, flag names and format strings are interned:
+ * a StringDef record assigns them an id, and it always precedes the first
+ * record that refers to that id.
+ *
+ * Message records hold the tick, the interned ids and the raw printf
+ * arguments. Each argument is tagged with its C++ type so that a reader
+ * can replay it through cprintf and get exactly the text that
+ * OstreamLogger would have printed. Messages with arguments that have no
+ * binary encoding are formatted when they are logged and stored as Text
+ * records instead. All values are stored in host byte order.
+ */
+namespace binary_trace
+{
+
+constexpr char magic[8] = { 'g', 'e', 'm', '5', 'd', 'b', 'g', '\0' };
+constexpr uint32_t version = 1;
+
+enum RecordType : uint8_t
+{
+    StringDef = 1,
+    Message = 2,
+    Text = 3,
+};
+
+/** Formatting options in effect when a record was logged. */
+enum FormatBits : uint8_t
+{
+    TicksOff = 0x1,
+    ShowFlag = 0x2,
+};
+
+enum ArgType : uint8_t
+{
+    Bool = 1,
+    Char,
+    SignedChar,
+    UnsignedChar,
+    Short,
+    UnsignedShort,
+    Int,
+    UnsignedInt,
+    Long,
+    UnsignedLong,
+    LongLong,
+    UnsignedLongLong,
+    Float,
+    Double,
+    String,
+};
+
+/** Maps an argument type to its ArgType tag, if it has one. */
+template <typename T> struct ArgTraits {};
+
+#define GEM5_TRACE_ARG_TYPE(T, tag) \
+    template <> struct ArgTraits<T> { static constexpr ArgType type = tag; }
+
+GEM5_TRACE_ARG_TYPE(bool, Bool);
+GEM5_TRACE_ARG_TYPE(char, Char);
+GEM5_TRACE_ARG_TYPE(signed char, SignedChar);
+GEM5_TRACE_ARG_TYPE(unsigned char, UnsignedChar);
+GEM5_TRACE_ARG_TYPE(short, Short);
+GEM5_TRACE_ARG_TYPE(unsigned short, UnsignedShort);
+GEM5_TRACE_ARG_TYPE(int, Int);
+GEM5_TRACE_ARG_TYPE(unsigned int, UnsignedInt);
+GEM5_TRACE_ARG_TYPE(long, Long);
+GEM5_TRACE_ARG_TYPE(unsigned long, UnsignedLong);
+GEM5_TRACE_ARG_TYPE(long long, LongLong);
+GEM5_TRACE_ARG_TYPE(unsigned long long, UnsignedLongLong);
+GEM5_TRACE_ARG_TYPE(float, Float);
+GEM5_TRACE_ARG_TYPE(double, Double);
+GEM5_TRACE_ARG_TYPE(std::string, String);
+GEM5_TRACE_ARG_TYPE(const char *, String);
+GEM5_TRACE_ARG_TYPE(char *, String);
+
+#undef GEM5_TRACE_ARG_TYPE
+
+template <std::size_t N>
+struct ArgTraits<char[N]> { static constexpr ArgType type = String; };
+
+template <typename T, typename = void>
+struct IsEncodable : std::false_type {};
+
+template <typename T>
+struct IsEncodable<T, std::void_t<decltype(ArgTraits<T>::type)>>
+    : std::true_type {};
+
+/** True if all of the argument types have a binary encoding. */
+template <typename ...Args>
+constexpr bool encodable = (IsEncodable<Args>::value && ...);
+
+} // namespace binary_trace
+
+/**
+ * Producer side of the binary trace format. Each thread encodes records
+ * into its own buffer without taking any locks. What happens to a
+ * record once it is complete is up to the subclass.
+ */
+class BinaryEncoder
+{
+  public:
+    BinaryEncoder();
+    virtual ~BinaryEncoder();
+
+    BinaryEncoder(const BinaryEncoder &) = delete;
+    BinaryEncoder &operator=(const BinaryEncoder &) = delete;
+
+    template <typename ...Args>
+    void
+    message(Tick when, const std::string &name, const std::string &flag,
+            uint8_t format, const char *fmt, const Args &...args)
+    {
+        static_assert(binary_trace::encodable<Args...>,
+                      "Argument type has no binary trace encoding");
+
+        Buffer &buf = buffer();
+        const uint32_t name_id = buf.intern(*this, name);
+        const uint32_t flag_id = buf.intern(*this, flag);
+        const uint32_t fmt_id = buf.intern(*this, fmt);
+        const std::size_t start = buf.data.size();
+
+        buf.put(binary_trace::Message);
+        buf.put(format);
+        buf.put(uint64_t(when));
+        buf.put(name_id);
+        buf.put(flag_id);
+        buf.put(fmt_id);
+        buf.put(uint8_t(sizeof...(Args)));
+        (buf.putArg(args), ...);
+        commit(buf, start);
+    }
+
+    /** Record an already formatted message. */
+    void text(Tick when, const std::string &name, const std::string &flag,
+              uint8_t format, const std::string &message);
+
+    /**
+     * Write out everything recorded so far. The logging threads must be
+     * idle.
+     */
+    virtual void flush() = 0;
+
+  protected:
+    struct Buffer
+    {
+        virtual ~Buffer() {}
+
+        std::vector<char> data;
+
+        /** Interned format strings, keyed by the caller's pointer. */
+        std::unordered_map<const char *,
+                           std::pair<uint32_t, const char *>> formats;
+        std::unordered_map<std::string, uint32_t> strings;
+
+        template <typename T>
+        void
+        put(const T &value)
+        {
+            const char *p = reinterpret_cast<const char *>(&value);
+            data.insert(data.end(), p, p + sizeof(T));
+        }
+
+        void
+        putString(const char *str, std::size_t len)
+        {
+            put(uint32_t(len));
+            data.insert(data.end(), str, str + len);
+        }
+
+        template <typename T>
+        void
+        putArg(const T &value)
+        {
+            put(binary_trace::ArgTraits<T>::type);
+            if constexpr (binary_trace::ArgTraits<T>::type ==
+                          binary_trace::String) {
+                putArgString(value);
+            } else {
+                put(value);
+            }
+        }
+
+        void
+        putArgString(const std::string &s)
+        {
+            putString(s.data(), s.size());
+        }
+
+        void
+        putArgString(const char *s)
+        {
+            putString(s, s ? std::strlen(s) : 0);
+        }
+
+        uint32_t
+        intern(BinaryEncoder &encoder, const std::string &str)
+        {
+            auto it = strings.find(str);
+            if (it != strings.end())
+                return it->second;
+            const uint32_t id = encoder.define(str);
+            strings.emplace(str, id);
+            return id;
+        }
+
+        uint32_t
+        intern(BinaryEncoder &encoder, const char *fmt)
+        {
+            // Format strings are nearly always literals, so look them up
+            // by address and only check that the text has not changed.
+            auto it = formats.find(fmt);
+            if (it != formats.end() &&
+                std::strcmp(it->second.second, fmt) == 0) {
+                return it->second.first;
+            }
+            const uint32_t id = intern(encoder, std::string(fmt));
+            formats[fmt] = { id, strings.find(fmt)->first.c_str() };
+            return id;
+        }
+    };
+
+    /** Return the calling thread's buffer. */
+    Buffer &
+    buffer()
+    {
+        struct Cache
+        {
+            uint64_t owner = 0;
+            Buffer *buf = nullptr;
+        };
+        static thread_local Cache cache;
+
+        if (GEM5_UNLIKELY(cache.owner != serial)) {
+            cache.buf = &threadBuffer();
+            cache.owner = serial;
+        }
+        return *cache.buf;
+    }
+
+    /**
+     * Called after a record has been appended to a thread's buffer.
+     *
+     * @param buf The calling thread's buffer.
+     * @param start Offset of the new record in buf.data.
+     */
+    virtual void commit(Buffer &buf, std::size_t start) = 0;
+
+    /** Create the buffer for a new thread. */
+    virtual Buffer *newBuffer() { return new Buffer; }
+
+    /** Write the header that starts every binary trace. */
+    static void writeHeader(std::ostream &os);
+
+    Buffer &threadBuffer();
+    uint32_t define(const std::string &str);
+
+    /** Unique id used to tell encoders apart in the thread local cache. */
+    const uint64_t serial;
+    static std::atomic<uint64_t> nextSerial;
+
+    std::mutex lock;
+    std::unordered_map<std::thread::id, std::unique_ptr<Buffer>> buffers;
+    std::unordered_map<std::string, uint32_t> ids;
+    /** StringDef records for ids handed out by define(). */
+    std::vector<char> definitions;
+};
+
+/**
+ * Streams binary trace records to an ostream. Full buffers are handed to
+ * a helper thread that writes them out.
+ */
+class BinaryWriter : public BinaryEncoder
+{
+  public:
+    /**
+     * @param os Stream to write the trace to.
+     * @param chunk_size Size at which a thread's buffer is handed off.
+     * @param max_pending Number of buffers that may be queued for the
+     *     helper thread before logging threads block.
+     */
+    BinaryWriter(std::ostream &os, std::size_t chunk_size = 64 * 1024,
+                 std::size_t max_pending = 16);
+
+    /** Flushes all buffers; the logging threads must be idle. */
+    ~BinaryWriter();
+
+    /**
+     * Hand every thread's buffer to the helper thread and wait until it
+     * has written them out. The logging threads must be idle.
+     */
+    void flush() override;
+
+  protected:
+    void
+    commit(Buffer &buf, std::size_t start) override
+    {
+        if (GEM5_UNLIKELY(buf.data.size() >= chunkSize))
+            submit(buf);
+    }
+
+    void submit(Buffer &buf);
+    void drain();
+
+    std::ostream &os;
+    const std::size_t chunkSize;
+    const std::size_t maxPending;
+
+    std::condition_variable wakeWriter;
+    std::condition_variable wakeProducer;
+
+    std::deque<std::vector<char>> pending;
+    bool stop = false;
+
+    std::thread thread;
+};
+
+/**
+ * Keeps only the most recent records. Each thread has a ring buffer of a
+ * fixed size and the oldest records are dropped to make room for new
+ * ones. Nothing is written until flush() is called, which makes this
+ * suitable for a flight recorder that is only read out when the
+ * simulator dies.
+ */
+class BinaryRing : public BinaryEncoder
+{
+  public:
+    /**
+     * @param os Stream that flush() writes the trace to.
+     * @param capacity Size of each thread's ring buffer in bytes.
+     */
+    BinaryRing(std::ostream &os, std::size_t capacity);
+
+    /**
+     * Write the contents of the ring buffers as a binary trace and empty
+     * them. Records from different threads are merged by tick. The
+     * logging threads must be idle.
+     */
+    void flush() override;
+
+    /**
+     * @return Number of records dropped to make room for newer ones. The
+     *     logging threads must be idle.
+     */
+    uint64_t dropped();
+
+  protected:
+    struct Ring : public Buffer
+    {
+        std::vector<char> ring;
+        /** Offset of the oldest record. */
+        std::size_t head = 0;
+        /** Offset at which the next record is written. */
+        std::size_t tail = 0;
+        /** End of the records between head and the end of the ring. */
+        std::size_t wrapEnd = 0;
+        /** True if the records continue at the start of the ring. */
+        bool wrapped = false;
+        std::size_t count = 0;
+        uint64_t dropped = 0;
+
+        /** Drop the oldest record. */
+        void pop();
+        /** Copy a record into the ring, dropping old ones as needed. */
+        void push(const char *rec, uint32_t len);
+        /** Call func(record, length) from the oldest to the newest. */
+        template <typename Func> void forEach(Func func) const;
+    };
+
+    void
+    commit(Buffer &buf, std::size_t start) override
+    {
+        static_cast<Ring &>(buf).push(buf.data.data() + start,
+                                      buf.data.size() - start);
+        buf.data.clear();
+    }
+
+    Buffer *newBuffer() override;
+
+    std::ostream &os;
+    const std::size_t capacity;
+};
+
+/**
+ * Decodes a binary trace back into the text OstreamLogger would have
+ * produced for the same messages.
+ */
+class BinaryReader
+{
+  public:
+    explicit BinaryReader(std::istream &is);
+
+    /** @return False if the stream does not start with a valid header. */
+    bool valid() const { return error_.empty(); }
+
+    /** @return Description of the last error, empty if none. */
+    const std::string &error() const { return error_; }
+
+    /**
+     * Decode the next message and append its text to os.
+     *
+     * @return False at the end of the trace or on a malformed record.
+     */
+    bool next(std::ostream &os);
+
+  protected:
+    template <typename T>
+    bool
+    get(T &value)
+    {
+        return bool(is.read(reinterpret_cast<char *>(&value), sizeof(T)));
+    }
+
+    template <typename T>
+    bool
+    replay(cp::Print &print)
+    {
+        T value;
+        if (!get(value))
+            return false;
+        print.addArg(value);
+        return true;
+    }
+
+    bool replayArg(cp::Print &print);
+    bool getString(std::string &str);
+    bool lookup(uint32_t id, const std::string *&str);
+    bool fail(const std::string &msg);
+
+    std::istream &is;
+    std::vector<std::string> strings;
+    std::string error_;
+};
+
+} // namespace Trace
+} // namespace gem5
+
+#endif // __BASE_TRACE_BINARY_HH__
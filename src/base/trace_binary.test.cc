@@ -0,0 +1,367 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "base/trace.hh"
+#include "base/trace_binary.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/** A type that can only be printed through operator<<. */
+struct Opaque
+{
+    int value;
+};
+
+std::ostream &
+operator<<(std::ostream &os, const Opaque &o)
+{
+    return os << "<opaque " << o.value << ">";
+}
+
+/** Log the same messages that the binary round trip test decodes. */
+void
+logMessages(Trace::Logger &logger)
+{
+    const std::string str("string");
+    char buf[] = "buffer";
+    const uint8_t byte = 0xab;
+    const Addr addr = 0x80001000;
+
+    logger.dprintf_flag(Tick(1), "system.cpu", "Exec", "No arguments\n");
+    logger.dprintf_flag(Tick(22), "system.cpu", "Exec",
+            "%d %u %#x %o %c\n", -5, 7u, addr, 8, 'z');
+    logger.dprintf_flag(Tick(333), "system.l2", "Cache",
+            "%s %s %s %-8s|\n", str, "literal", buf, "left");
+    logger.dprintf_flag(Tick(4444), "system.l2", "Cache",
+            "%#04x %d %c %d\n", byte, byte, (signed char)'q', true);
+    logger.dprintf_flag(Tick(55555), "", "Cache",
+            "%.3f %e %g %*d\n", 3.14159, 1e-9, 2.5f, 6, 42);
+    logger.dprintf_flag(Tick(666666), "system.l2", "",
+            "%lld %llu %hd %hu %ld\n", -1ll, 2ull, short(-3),
+            (unsigned short)4, 5l);
+    logger.dprintf_flag(MaxTick, "system", "Exec", "Max tick\n");
+    logger.dprintf_flag(Tick(7), "system.cpu", "Exec",
+            "Opaque %s and %d\n", Opaque{ 3 }, 4);
+    logger.dprintf_flag(Tick(8), "system.cpu", "Exec",
+            "Missing %d %d\n", 1);
+    logger.dprintf_flag(Tick(9), "system.cpu", "Exec",
+            "Extra %d\n", 1, 2);
+    logger.logMessage(Tick(10), "system.mem", "DRAM", "Preformatted\n");
+    logger.getOstream() << "Raw text " << 11 << std::endl;
+    logger.dump(Tick(12), "system.mem", "0123456789abcdefXYZ", 19, "DRAM");
+}
+
+/** @return The text decoded from a binary trace. */
+std::string
+decode(const std::string &trace)
+{
+    std::istringstream is(trace);
+    Trace::BinaryReader reader(is);
+    std::ostringstream os;
+    while (reader.next(os))
+        ;
+    EXPECT_EQ(reader.error(), "");
+    return os.str();
+}
+
+/** @return The output of a BinaryLogger after running func on it. */
+template <typename Func>
+std::string
+binaryTrace(Func func)
+{
+    std::ostringstream os;
+    {
+        Trace::BinaryLogger logger(os);
+        func(logger);
+        logger.flush();
+    }
+    return os.str();
+}
+
+} // anonymous namespace
+
+/** Decoding a binary trace gives the text OstreamLogger would print. */
+TEST(TraceBinaryTest, RoundTrip)
+{
+    std::ostringstream text;
+    Trace::OstreamLogger text_logger(text);
+    logMessages(text_logger);
+
+    const std::string trace = binaryTrace(logMessages);
+    ASSERT_EQ(decode(trace), text.str());
+    // Messages with plain arguments are not formatted when logged.
+    ASSERT_NE(text.str().find("-5 7 0x80001000"), std::string::npos);
+    ASSERT_EQ(trace.find("-5 7 0x80001000"), std::string::npos);
+}
+
+/** The format flags in effect when a message was logged are kept. */
+TEST(TraceBinaryTest, FormatFlags)
+{
+    auto log = [](Trace::Logger &logger) {
+        logger.dprintf_flag(Tick(1), "a", "Flag", "before %d\n", 1);
+        Trace::enable();
+        debug::changeFlag("FmtFlag", true);
+        debug::changeFlag("FmtTicksOff", true);
+        logger.dprintf_flag(Tick(2), "a", "Flag", "during %d\n", 2);
+        logger.logMessage(Tick(3), "a", "Flag", "during text\n");
+        debug::changeFlag("FmtFlag", false);
+        debug::changeFlag("FmtTicksOff", false);
+        Trace::disable();
+        logger.dprintf_flag(Tick(4), "a", "Flag", "after %d\n", 4);
+    };
+
+    std::ostringstream text;
+    Trace::OstreamLogger text_logger(text);
+    log(text_logger);
+
+    ASSERT_EQ(decode(binaryTrace(log)), text.str());
+#if TRACING_ON
+    ASSERT_NE(text.str().find("Flag: a: during 2"), std::string::npos);
+#endif
+}
+
+/** Ignored objects are dropped before anything is recorded. */
+TEST(TraceBinaryTest, Ignore)
+{
+    const std::string trace = binaryTrace([](Trace::Logger &logger) {
+        ObjectMatch ignore("Foo");
+        logger.setIgnore(ignore);
+        logger.dprintf_flag(Tick(1), "Foo", "", "ignored %d\n", 1);
+        logger.logMessage(Tick(2), "Foo", "", "ignored\n");
+        logger.dprintf_flag(Tick(3), "Bar", "", "kept %d\n", 3);
+    });
+    ASSERT_EQ(decode(trace), "      3: Bar: kept 3\n");
+}
+
+/** Messages larger than a buffer and many buffers in flight. */
+TEST(TraceBinaryTest, ManyChunks)
+{
+    std::ostringstream os;
+    std::ostringstream expected;
+    {
+        Trace::BinaryWriter writer(os, 64, 1);
+        const std::string big(200, 'x');
+        for (int i = 0; i < 1000; i++) {
+            writer.message(Tick(i), "obj", "", 0, "%d %s\n", i,
+                           i % 100 ? std::string("y") : big);
+            ccprintf(expected, "%7d: obj: %d %s\n", i, i,
+                     i % 100 ? std::string("y") : big);
+        }
+    }
+    ASSERT_EQ(decode(os.str()), expected.str());
+}
+
+/** Each thread's messages appear in order and none are lost. */
+TEST(TraceBinaryTest, Threads)
+{
+    const int num_threads = 4;
+    const int num_messages = 2000;
+
+    std::ostringstream os;
+    {
+        Trace::BinaryWriter writer(os, 256, 2);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < num_threads; t++) {
+            threads.emplace_back([&writer, t]() {
+                const std::string name = csprintf("thread%d", t);
+                for (int i = 0; i < num_messages; i++) {
+                    writer.message(Tick(i), name, "", 0, "%d %d\n", t, i);
+                }
+            });
+        }
+        for (auto &thread : threads)
+            thread.join();
+    }
+
+    std::istringstream is(os.str());
+    Trace::BinaryReader reader(is);
+    std::vector<int> next(num_threads, 0);
+    std::ostringstream line;
+    while (reader.next(line)) {
+        int t, i;
+        ASSERT_EQ(sscanf(line.str().c_str(), "%*d: thread%*d: %d %d", &t,
+                         &i), 2);
+        ASSERT_EQ(i, next[t]++);
+        line.str("");
+    }
+    ASSERT_EQ(reader.error(), "");
+    for (int t = 0; t < num_threads; t++)
+        ASSERT_EQ(next[t], num_messages);
+}
+
+/** Streams without the binary trace header are rejected. */
+TEST(TraceBinaryTest, BadHeader)
+{
+    std::istringstream is("    100: Foo: Test message\n");
+    Trace::BinaryReader reader(is);
+    ASSERT_FALSE(reader.valid());
+
+    std::ostringstream os;
+    ASSERT_FALSE(reader.next(os));
+    ASSERT_EQ(os.str(), "");
+}
+
+/** A truncated trace decodes up to the last complete record. */
+TEST(TraceBinaryTest, Truncated)
+{
+    const std::string trace = binaryTrace([](Trace::Logger &logger) {
+        logger.dprintf_flag(Tick(1), "a", "", "first %d\n", 1);
+        logger.dprintf_flag(Tick(2), "a", "", "second %d\n", 2);
+    });
+
+    std::istringstream is(trace.substr(0, trace.size() - 2));
+    Trace::BinaryReader reader(is);
+    std::ostringstream os;
+    ASSERT_TRUE(reader.next(os));
+    ASSERT_FALSE(reader.next(os));
+    ASSERT_EQ(os.str(), "      1: a: first 1\n");
+    ASSERT_NE(reader.error(), "");
+}
+
+/** A ring keeps only the most recent records. */
+TEST(TraceBinaryTest, RingKeepsNewest)
+{
+    std::ostringstream os;
+    Trace::BinaryRing ring(os, 1024);
+
+    std::vector<std::string> lines;
+    for (int i = 0; i < 1000; i++) {
+        ring.message(Tick(i), "obj", "", 0, "message %d\n", i);
+        lines.push_back(csprintf("%7d: obj: message %d\n", i, i));
+    }
+    ASSERT_EQ(os.str(), "");
+
+    ring.flush();
+    const std::string text = decode(os.str());
+
+    // Every record that was not dropped must be in the output, in order.
+    const uint64_t dropped = ring.dropped();
+    ASSERT_GT(dropped, 0);
+    ASSERT_LT(dropped, lines.size());
+    std::string expected;
+    for (auto i = dropped; i < lines.size(); i++)
+        expected += lines[i];
+    ASSERT_EQ(text, expected);
+
+    // Flushing empties the ring.
+    os.str("");
+    ring.flush();
+    ASSERT_EQ(decode(os.str()), "");
+}
+
+/** Records that do not fit in the ring at all are dropped. */
+TEST(TraceBinaryTest, RingRecordTooLarge)
+{
+    std::ostringstream os;
+    Trace::BinaryRing ring(os, 128);
+
+    ring.message(Tick(1), "obj", "", 0, "%s\n", std::string(200, 'x'));
+    ring.message(Tick(2), "obj", "", 0, "%s\n", "small");
+    ring.flush();
+    ASSERT_EQ(decode(os.str()), "      2: obj: small\n");
+    ASSERT_EQ(ring.dropped(), 1);
+}
+
+/** Records of different threads are merged by tick. */
+TEST(TraceBinaryTest, RingThreads)
+{
+    std::ostringstream os;
+    Trace::BinaryRing ring(os, 1 << 16);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 2; t++) {
+        threads.emplace_back([&ring, t]() {
+            for (int i = t; i < 100; i += 2)
+                ring.message(Tick(i), "obj", "", 0, "%d\n", i);
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+    ring.flush();
+
+    std::string expected;
+    for (int i = 0; i < 100; i++)
+        expected += csprintf("%7d: obj: %d\n", i, i);
+    ASSERT_EQ(decode(os.str()), expected);
+}
+
+/** The flight recorder writes nothing until it is flushed. */
+TEST(TraceBinaryTest, FlightRecorder)
+{
+    std::ostringstream text;
+    Trace::OstreamLogger text_logger(text);
+    logMessages(text_logger);
+
+    std::ostringstream os;
+    Trace::FlightRecorder recorder(os, 1 << 16);
+    logMessages(recorder);
+    ASSERT_EQ(os.str(), "");
+
+    recorder.flush();
+    ASSERT_EQ(os.str(), text.str());
+
+    recorder.dprintf_flag(Tick(100), "obj", "", "after %d\n", 1);
+    recorder.flush();
+    ASSERT_EQ(os.str(), text.str() + "    100: obj: after 1\n");
+}
+
+/**
+ * Preparing to fork writes out what a BinaryLogger buffered, but not
+ * what the flight recorder holds.
+ */
+TEST(TraceBinaryTest, PrepareFork)
+{
+    std::ostringstream text;
+    Trace::OstreamLogger text_logger(text);
+    logMessages(text_logger);
+
+    std::ostringstream binary;
+    Trace::BinaryLogger logger(binary);
+    logMessages(logger);
+    logger.prepareFork();
+    ASSERT_EQ(decode(binary.str()), text.str());
+
+    std::ostringstream os;
+    Trace::FlightRecorder recorder(os, 1 << 16);
+    logMessages(recorder);
+    recorder.prepareFork();
+    ASSERT_EQ(os.str(), "");
+
+    recorder.flush();
+    ASSERT_EQ(os.str(), text.str());
+}
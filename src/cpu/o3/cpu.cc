@@ -1537,8 +1537,7 @@ CPU::htmSendAbortSignal(ThreadID tid, uint64_t htm_uid,
     commit.resetHtmStartsStops(tid);
 
     // notify l1 d-cache (ruby) that core has aborted transaction
-    RequestPtr req =
-        std::make_shared<Request>(addr, size, flags, _dataRequestorId);
+    RequestPtr req = Request::create(addr, size, flags, _dataRequestorId);
 
     req->taskId(taskId());
     req->setContext(thread[tid]->contextId());
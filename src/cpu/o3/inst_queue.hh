@@ -60,6 +60,7 @@
 #include "cpu/timebuf.hh"
 #include "enums/SMTQueuePolicy.hh"
 #include "sim/eventq.hh"
+#include "sim/pooled_event.hh"
 
 namespace gem5
 {
@@ -102,7 +103,7 @@ class InstructionQueue
     typedef typename std::list<DynInstPtr>::iterator ListIt;
 
     /** FU completion event class. */
-    class FUCompletion : public Event
+    class FUCompletion : public PooledEvent<FUCompletion>
     {
       private:
         /** Executing instruction. */
@@ -113,7 +113,7 @@ DmaPort::handleResp(DmaReqState *state, Addr addr, Addr size, Tick delay)
 PacketPtr
 DmaPort::DmaReqState::createPacket()
 {
-    RequestPtr req = std::make_shared<Request>(
+    RequestPtr req = Request::create(
             gen.addr(), gen.size(), flags, id);
     req->setStreamId(sid);
     req->setSubstreamId(ssid);
@@ -260,6 +260,13 @@ DmaPort::sendAtomicBdReq(DmaReqState *state)
     bool done = false;
 
     auto bd_it = memBackdoors.contains(state->gen.addr());
+    // Writes can't go through a read only backdoor, for instance one
+    // of a memory which tracks the pages written to it.
+    if (bd_it != memBackdoors.end() && !MemCmd(state->cmd).isRead() &&
+            !bd_it->second->writeable()) {
+        bd_it = memBackdoors.end();
+    }
+
     if (bd_it == memBackdoors.end()) {
         // We don't have a backdoor for this address, so use a packet.
 
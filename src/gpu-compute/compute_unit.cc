@@ -725,6 +725,9 @@ ComputeUnit::releaseWFsFromBarrier(int bar_id)
 void
 ComputeUnit::exec()
 {
+    if (skipIdleWakeups() && quiescent())
+        countWastedWakeup();
+
     // process reads and writes in the RFs
     for (auto &vecRegFile : vrf) {
         vecRegFile->exec();
@@ -747,9 +750,10 @@ ComputeUnit::exec()
     stats.totalCycles++;
 
     // Put this CU to sleep if there is no more work to be done.
-    if (!isDone()) {
+    if (!quiescent()) {
         schedule(tickEvent, nextCycle());
     } else {
+        countIdleSleep();
         shader->notifyCuSleep();
         DPRINTF(GPUDisp, "CU%d: Going to sleep\n", cu_id);
     }
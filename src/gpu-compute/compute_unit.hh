@@ -463,6 +463,14 @@ class ComputeUnit : public ClockedObject
     bool isDone() const;
     bool isVectorAluIdle(uint32_t simdId) const;
 
+    /**
+     * The CU has nothing to do until a work group is dispatched to it,
+     * which restarts its tick event. A CU always stops ticking when
+     * quiescent; with skip_idle_wakeups set this is also accounted in
+     * the wakeups stats.
+     */
+    bool quiescent() const { return isDone(); }
+
     void handleSQCReturn(PacketPtr pkt);
 
   protected:
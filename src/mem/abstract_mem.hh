@@ -47,6 +47,7 @@
 #define __MEM_ABSTRACT_MEMORY_HH__
 
 #include "mem/backdoor.hh"
+#include "mem/dirty_bitmap.hh"
 #include "mem/port.hh"
 #include "params/AbstractMemory.hh"
 #include "sim/clocked_object.hh"
@@ -120,6 +121,10 @@ class AbstractMemory : public ClockedObject
     // Backdoor to access this memory.
     MemBackdoor backdoor;
 
+    // Pages of the backing store written since the last checkpoint,
+    // if they are tracked
+    DirtyBitmap *dirtyPages;
+
     // Enable specific memories to be reported to the configuration table
     const bool confTableReported;
 
@@ -131,6 +136,13 @@ class AbstractMemory : public ClockedObject
 
     std::list<LockedAddr> lockedAddrList;
 
+    void
+    markDirty(Addr addr, Addr size)
+    {
+        if (dirtyPages)
+            dirtyPages->mark(addr - range.start(), size);
+    }
+
     // helper function for checkLockedAddrs(): we really want to
     // inline a quick check for an empty locked addr list (hopefully
     // the common case), and do the full list search (if necessary) in
@@ -234,6 +246,16 @@ class AbstractMemory : public ClockedObject
      */
     void setBackingStore(uint8_t* pmem_addr);
 
+    /**
+     * Track the pages written in the backing store, for incremental
+     * checkpoints. All the memories sharing a backing store share the
+     * bitmap. Writes through a backdoor cannot be tracked, so the
+     * backdoor of the memory becomes read only.
+     *
+     * @param dirty_pages Bitmap covering the backing store
+     */
+    void trackDirtyPages(DirtyBitmap *dirty_pages);
+
     void
     getBackdoor(MemBackdoorPtr &bd_ptr)
     {
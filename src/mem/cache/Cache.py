@@ -134,6 +134,13 @@ class BaseCache(ClockedObject):
     # cache.
     writeback_clean = Param.Bool(False, "Writeback clean lines")
 
+    # Save the tags, coherence state, replacement data and contents of
+    # the cache in checkpoints, so that restored simulations start with
+    # warm caches. Dirty lines are written back before a checkpoint is
+    # taken, hence they are restored as clean lines.
+    checkpoint_contents = Param.Bool(False,
+        "Save and restore the cache contents in checkpoints")
+
     # Control whether this cache should be mostly inclusive or mostly
     # exclusive with respect to upstream caches. The behaviour on a
     # fill is determined accordingly. For a mostly inclusive cache,
@@ -45,6 +45,8 @@
 
 #include "mem/cache/base.hh"
 
+#include <zlib.h>
+
 #include "base/compiler.hh"
 #include "base/logging.hh"
 #include "debug/Cache.hh"
@@ -59,6 +61,7 @@
 #include "mem/cache/queue_entry.hh"
 #include "mem/cache/tags/compressed_tags.hh"
 #include "mem/cache/tags/super_blk.hh"
+#include "mem/physical.hh"
 #include "params/BaseCache.hh"
 #include "params/WriteAllocator.hh"
 #include "sim/cur_tick.hh"
@@ -87,6 +90,7 @@ BaseCache::BaseCache(const BaseCacheParams &p, unsigned blk_size)
       prefetcher(p.prefetcher),
       writeAllocator(p.write_allocator),
       writebackClean(p.writeback_clean),
+      checkpointContents(p.checkpoint_contents),
       tempBlockWriteback(nullptr),
       writebackTempBlockAtomicEvent([this]{ writebackTempBlockAtomic(); },
                                     name(), false,
@@ -134,6 +138,10 @@ BaseCache::BaseCache(const BaseCacheParams &p, unsigned blk_size)
         "Compressed cache %s does not have a compression algorithm", name());
     if (compressor)
         compressor->setCache(this);
+
+    fatal_if(checkpointContents && compressor,
+        "Checkpointing the contents of compressed cache %s is not "
+        "supported", name());
 }
 
 BaseCache::~BaseCache()
@@ -245,7 +253,7 @@ BaseCache::handleTimingReqHit(PacketPtr pkt, CacheBlk *blk, Tick request_time)
             // Basically we need to get the MSHR in the same state as if
             // we had missed and just received the response.
             // Request *req2 = new Request(*(pkt->req));
-            RequestPtr req2 = std::make_shared<Request>(*(pkt->req));
+            RequestPtr req2 = Request::create(*(pkt->req));
             PacketPtr pkt2 = new Packet(req2, pkt->cmd);
             MSHR *mshr = allocateMissBuffer(pkt2, curTick(), true);
             // Mark the MSHR "in service" (even though it's not) to prevent
@@ -765,6 +773,190 @@ BaseCache::functionalAccess(PacketPtr pkt, bool from_cpu_side)
     }
 }
 
+bool
+BaseCache::handleWarmAccess(Addr addr, bool is_secure, bool needs_writable,
+                            bool first_level)
+{
+    CacheBlk *blk = tags->warmAccessBlock(addr, is_secure);
+
+    DPRINTF(Cache, "%s: addr %#x (%s) writable %d %s\n", __func__, addr,
+            is_secure ? "s" : "ns", needs_writable, blk ? "hit" : "miss");
+
+    if (blk) {
+        stats.warmupHits++;
+
+        // An upgrade invalidates the other copies through the levels
+        // below, as an UpgradeReq would
+        if (needs_writable && !blk->isSet(CacheBlk::WritableBit)) {
+            memSidePort.sendWarmAccess(addr, is_secure, true);
+            blk->setCoherenceBits(CacheBlk::WritableBit);
+        }
+
+        if (first_level) {
+            if (needs_writable)
+                blk->setCoherenceBits(CacheBlk::DirtyBit);
+        } else if (needs_writable) {
+            // Dirty data moves up along with ownership
+            blk->clearCoherenceBits(CacheBlk::DirtyBit);
+        }
+
+        // A mostly exclusive cache hands clean blocks over to the cache
+        // above, as maintainClusivity() does
+        if (!first_level && clusivity == enums::mostly_excl &&
+            !blk->isSet(CacheBlk::DirtyBit)) {
+            invalidateBlock(blk);
+        }
+
+        return true;
+    }
+
+    stats.warmupMisses++;
+    memSidePort.sendWarmAccess(addr, is_secure, needs_writable);
+
+    // Allocate under the same conditions as allocOnFill()
+    if (first_level || clusivity == enums::mostly_incl) {
+        blk = warmAllocate(addr, is_secure);
+        if (blk) {
+            blk->setCoherenceBits(CacheBlk::ReadableBit);
+            if (needs_writable)
+                blk->setCoherenceBits(CacheBlk::WritableBit);
+            if (needs_writable && first_level)
+                blk->setCoherenceBits(CacheBlk::DirtyBit);
+        }
+    }
+
+    return false;
+}
+
+void
+BaseCache::recvWarmEvict(Addr addr, bool is_secure, bool is_dirty)
+{
+    CacheBlk *blk = tags->warmAccessBlock(addr, is_secure);
+
+    // Dirty evictions allocate like a WritebackDirty. A mostly exclusive
+    // cache relies on clean writebacks, so it also takes clean blocks
+    if (!blk && (is_dirty || clusivity == enums::mostly_excl)) {
+        blk = warmAllocate(addr, is_secure);
+        if (blk)
+            blk->setCoherenceBits(CacheBlk::ReadableBit);
+    }
+
+    if (blk) {
+        if (is_dirty) {
+            blk->setCoherenceBits(CacheBlk::WritableBit |
+                                  CacheBlk::DirtyBit);
+        }
+        return;
+    }
+
+    // Nothing here takes the block, so pass the eviction on; the caches
+    // below keep tracking it if another cache above still holds it
+    memSidePort.sendWarmEvict(addr, is_secure, is_dirty,
+                              cpuSidePort.sendWarmIsCached(addr, is_secure));
+}
+
+void
+BaseCache::recvWarmInvalidate(Addr addr, bool is_secure)
+{
+    CacheBlk *blk = tags->findBlock(addr, is_secure);
+    if (blk)
+        invalidateBlock(blk);
+
+    cpuSidePort.sendWarmInvalidate(addr, is_secure);
+}
+
+void
+BaseCache::recvWarmDowngrade(Addr addr, bool is_secure)
+{
+    CacheBlk *blk = tags->findBlock(addr, is_secure);
+    if (blk)
+        blk->clearCoherenceBits(CacheBlk::WritableBit);
+
+    cpuSidePort.sendWarmDowngrade(addr, is_secure);
+}
+
+CacheBlk*
+BaseCache::warmAllocate(Addr addr, bool is_secure)
+{
+    // Warmed blocks are never compressed
+    std::vector<CacheBlk*> evict_blks;
+    CacheBlk *victim = tags->findVictim(addr, is_secure, blkSize*8,
+                                        evict_blks);
+    if (!victim)
+        return nullptr;
+
+    // Leave blocks with outstanding requests alone
+    for (const auto& blk : evict_blks) {
+        if (blk->isValid() &&
+            mshrQueue.findMatch(regenerateBlkAddr(blk), blk->isSecure())) {
+            return nullptr;
+        }
+    }
+
+    for (const auto& blk : evict_blks) {
+        if (blk->isValid()) {
+            const Addr blk_addr = regenerateBlkAddr(blk);
+            const bool blk_secure = blk->isSecure();
+            memSidePort.sendWarmEvict(blk_addr, blk_secure,
+                blk->isSet(CacheBlk::DirtyBit),
+                cpuSidePort.sendWarmIsCached(blk_addr, blk_secure));
+            invalidateBlock(blk);
+        }
+    }
+
+    tags->warmInsertBlock(addr, is_secure, victim);
+    victim->setWhenReady(curTick());
+    if (compressor)
+        compressor->setSizeBits(victim, blkSize*8);
+    warmBlks.insert(victim);
+
+    return victim;
+}
+
+void
+BaseCache::fillWarmBlocks()
+{
+    if (warmBlks.empty())
+        return;
+
+    DPRINTF(Cache, "%s: reading %d warmed blocks\n", __func__,
+            warmBlks.size());
+
+    // Invalidating erases from warmBlks, so work on a copy
+    const std::vector<CacheBlk*> blks(warmBlks.begin(), warmBlks.end());
+    warmBlks.clear();
+
+    memory::PhysicalMemory &physmem = system->getPhysMem();
+    for (const auto& blk : blks) {
+        const Addr addr = regenerateBlkAddr(blk);
+        if (!physmem.isMemAddr(addr)) {
+            warn_once("%s: warmed block %#x is not backed by memory, "
+                      "dropping it\n", name(), addr);
+            invalidateBlock(blk);
+            continue;
+        }
+
+        RequestPtr req = Request::create(
+            addr, blkSize, 0, Request::funcRequestorId);
+        if (blk->isSecure())
+            req->setFlags(Request::SECURE);
+
+        Packet pkt(req, MemCmd::ReadReq);
+        pkt.allocate();
+        physmem.functionalAccess(&pkt);
+        updateBlockData(blk, &pkt, false);
+    }
+}
+
+DrainState
+BaseCache::drain()
+{
+    // Timing accesses may follow, so the warmed blocks need their data
+    fillWarmBlocks();
+
+    return DrainState::Drained;
+}
+
 void
 BaseCache::updateBlockData(CacheBlk *blk, const PacketPtr cpkt,
     bool has_old_data)
@@ -1672,6 +1864,7 @@ BaseCache::invalidateBlock(CacheBlk *blk)
     // If handling a block present in the Tags, let it do its invalidation
     // process, which will update stats and invalidate the block itself
     if (blk != tempBlock) {
+        warmBlks.erase(blk);
         tags->invalidate(blk);
     } else {
         tempBlock->invalidate();
@@ -1697,7 +1890,7 @@ BaseCache::writebackBlk(CacheBlk *blk)
 
     stats.writebacks[Request::wbRequestorId]++;
 
-    RequestPtr req = std::make_shared<Request>(
+    RequestPtr req = Request::create(
         regenerateBlkAddr(blk), blkSize, 0, Request::wbRequestorId);
 
     if (blk->isSecure())
@@ -1740,7 +1933,7 @@ BaseCache::writebackBlk(CacheBlk *blk)
 PacketPtr
 BaseCache::writecleanBlk(CacheBlk *blk, Request::Flags dest, PacketId id)
 {
-    RequestPtr req = std::make_shared<Request>(
+    RequestPtr req = Request::create(
         regenerateBlkAddr(blk), blkSize, 0, Request::wbRequestorId);
 
     if (blk->isSecure()) {
@@ -1786,6 +1979,9 @@ BaseCache::writecleanBlk(CacheBlk *blk, Request::Flags dest, PacketId id)
 void
 BaseCache::memWriteback()
 {
+    // Warmed blocks must hold their data before it is written back
+    fillWarmBlocks();
+
     tags->forEachBlk([this](CacheBlk &blk) { writebackVisitor(blk); });
 }
 
@@ -1814,7 +2010,7 @@ BaseCache::writebackVisitor(CacheBlk &blk)
     if (blk.isSet(CacheBlk::DirtyBit)) {
         assert(blk.isValid());
 
-        RequestPtr request = std::make_shared<Request>(
+        RequestPtr request = Request::create(
             regenerateBlkAddr(&blk), blkSize, 0, Request::funcRequestorId);
 
         request->taskId(blk.getTaskId());
@@ -1993,19 +2189,24 @@ BaseCache::serialize(CheckpointOut &cp) const
 {
     bool dirty(isDirty());
 
-    if (dirty) {
+    if (dirty && !checkpointContents) {
         warn("*** The cache still contains dirty data. ***\n");
         warn("    Make sure to drain the system using the correct flags.\n");
         warn("    This checkpoint will not restore correctly " \
              "and dirty data in the cache will be lost!\n");
     }
 
-    // Since we don't checkpoint the data in the cache, any dirty data
-    // will be lost when restoring from a checkpoint of a system that
-    // wasn't drained properly. Flag the checkpoint as invalid if the
-    // cache contains dirty data.
+    // Unless the cache contents are checkpointed, any dirty data will
+    // be lost when restoring from a checkpoint of a system that wasn't
+    // drained properly. Flag the checkpoint so that such a restore
+    // fails if the cache contains dirty data.
     bool bad_checkpoint(dirty);
     SERIALIZE_SCALAR(bad_checkpoint);
+
+    bool contents(checkpointContents);
+    SERIALIZE_SCALAR(contents);
+    if (contents)
+        serializeContents(cp);
 }
 
 void
@@ -2013,13 +2214,181 @@ BaseCache::unserialize(CheckpointIn &cp)
 {
     bool bad_checkpoint;
     UNSERIALIZE_SCALAR(bad_checkpoint);
-    if (bad_checkpoint) {
+
+    // Checkpoints predating content checkpointing only have the flag
+    bool contents = false;
+    UNSERIALIZE_OPT_SCALAR(contents);
+    const bool restore = contents && checkpointContents;
+
+    if (bad_checkpoint && !restore) {
         fatal("Restoring from checkpoints with dirty caches is not "
               "supported in the classic memory system. Please remove any "
               "caches or drain them properly before taking checkpoints.\n");
     }
+
+    if (restore)
+        unserializeContents(cp);
 }
 
+namespace
+{
+
+/** Flags saved along with the coherence bits of checkpointed blocks. */
+enum CheckpointBlkState : unsigned
+{
+    SecureBlkState = 0x10,
+    PrefetchedBlkState = 0x20,
+};
+
+} // anonymous namespace
+
+void
+BaseCache::serializeContents(CheckpointOut &cp) const
+{
+    std::string filename = name() + ".blocks";
+    std::string filepath = CheckpointIn::dir() + "/" + filename;
+
+    gzFile data_file = gzopen(filepath.c_str(), "wb");
+    if (data_file == NULL)
+        fatal("Can't open cache checkpoint file '%s'\n", filename);
+
+    // Blocks are identified by their position in the tags, so they
+    // are restored to the same set and way
+    uint64_t num_blks = 0;
+    std::vector<uint64_t> blk_index;
+    std::vector<Addr> blk_addr;
+    std::vector<unsigned> blk_state;
+    std::vector<uint64_t> repl_state;
+    unsigned repl_width = 0;
+
+    tags->forEachBlk([&](CacheBlk &blk) {
+        if (blk.isValid()) {
+            blk_index.push_back(num_blks);
+            blk_addr.push_back(tags->regenerateBlkAddr(&blk));
+
+            unsigned state = 0;
+            for (unsigned bit : {CacheBlk::WritableBit, CacheBlk::ReadableBit,
+                                 CacheBlk::DirtyBit}) {
+                if (blk.isSet(bit))
+                    state |= bit;
+            }
+            if (blk.isSecure())
+                state |= SecureBlkState;
+            if (blk.wasPrefetched())
+                state |= PrefetchedBlkState;
+            blk_state.push_back(state);
+
+            const std::vector<uint64_t> repl = tags->getReplacementState(&blk);
+            repl_width = repl.size();
+            repl_state.insert(repl_state.end(), repl.begin(), repl.end());
+
+            if (gzwrite(data_file, blk.data, blkSize) != (int)blkSize) {
+                fatal("Write failed on cache checkpoint file '%s'\n",
+                      filename);
+            }
+        }
+        num_blks++;
+    });
+
+    if (gzclose(data_file))
+        fatal("Close failed on cache checkpoint file '%s'\n", filename);
+
+    SERIALIZE_SCALAR(filename);
+    SERIALIZE_SCALAR(num_blks);
+    std::string repl_policy = tags->getReplacementPolicyType();
+    SERIALIZE_SCALAR(repl_policy);
+    SERIALIZE_SCALAR(repl_width);
+    SERIALIZE_CONTAINER(blk_index);
+    SERIALIZE_CONTAINER(blk_addr);
+    SERIALIZE_CONTAINER(blk_state);
+    SERIALIZE_CONTAINER(repl_state);
+}
+
+void
+BaseCache::unserializeContents(CheckpointIn &cp)
+{
+    std::string filename;
+    uint64_t num_blks;
+    std::string repl_policy;
+    unsigned repl_width;
+    std::vector<uint64_t> blk_index;
+    std::vector<Addr> blk_addr;
+    std::vector<unsigned> blk_state;
+    std::vector<uint64_t> repl_state;
+
+    UNSERIALIZE_SCALAR(filename);
+    UNSERIALIZE_SCALAR(num_blks);
+    UNSERIALIZE_SCALAR(repl_policy);
+    UNSERIALIZE_SCALAR(repl_width);
+    UNSERIALIZE_CONTAINER(blk_index);
+    UNSERIALIZE_CONTAINER(blk_addr);
+    UNSERIALIZE_CONTAINER(blk_state);
+    UNSERIALIZE_CONTAINER(repl_state);
+
+    std::vector<CacheBlk*> blks;
+    tags->forEachBlk([&blks](CacheBlk &blk) { blks.push_back(&blk); });
+    fatal_if(blks.size() != num_blks, "%s: Checkpoint has %d blocks, but "
+             "the cache has %d\n", name(), num_blks, blks.size());
+    fatal_if(blk_addr.size() != blk_index.size() ||
+             blk_state.size() != blk_index.size() ||
+             repl_state.size() != blk_index.size() * repl_width,
+             "%s: Malformed cache checkpoint\n", name());
+
+    // The replacement state is only meaningful to the policy that saved
+    // it; otherwise keep the reset state the insertion leaves
+    const bool restore_repl =
+        repl_width && repl_policy == tags->getReplacementPolicyType();
+    if (repl_width && !restore_repl) {
+        warn("%s: Checkpoint was taken with a different replacement "
+             "policy, its replacement state is not restored\n", name());
+    }
+
+    std::string filepath = cp.getCptDir() + "/" + filename;
+    gzFile data_file = gzopen(filepath.c_str(), "rb");
+    if (data_file == NULL)
+        fatal("Can't open cache checkpoint file '%s'\n", filename);
+
+    for (size_t i = 0; i < blk_index.size(); i++) {
+        fatal_if(blk_index[i] >= blks.size(),
+                 "%s: Malformed cache checkpoint\n", name());
+        CacheBlk *blk = blks[blk_index[i]];
+        const Addr addr = blk_addr[i];
+        const bool is_secure = blk_state[i] & SecureBlkState;
+
+        assert(!blk->isValid());
+        tags->warmInsertBlock(addr, is_secure, blk);
+        fatal_if(tags->findBlock(addr, is_secure) != blk,
+                 "%s: Checkpointed block %#x does not map to the same "
+                 "location, was the cache organization changed?\n",
+                 name(), addr);
+
+        blk->setWhenReady(curTick());
+        blk->setCoherenceBits(blk_state[i] & CacheBlk::AllBits);
+        if (blk_state[i] & PrefetchedBlkState)
+            blk->setPrefetched();
+
+        if (gzread(data_file, blk->data, blkSize) != (int)blkSize) {
+            fatal("Read failed on cache checkpoint file '%s'\n",
+                  filename);
+        }
+
+        if (restore_repl) {
+            fatal_if(tags->getReplacementState(blk).size() != repl_width,
+                     "%s: Malformed cache checkpoint\n", name());
+            const auto first = repl_state.begin() + i * repl_width;
+            tags->setReplacementState(blk,
+                std::vector<uint64_t>(first, first + repl_width));
+        }
+
+        // Restored blocks never went through the crossbars below
+        memSidePort.sendWarmHold(addr, is_secure);
+    }
+
+    if (gzclose(data_file))
+        fatal("Close failed on cache checkpoint file '%s'\n", filename);
+
+    DPRINTF(Cache, "%s: restored %d blocks\n", __func__, blk_index.size());
+}
 
 BaseCache::CacheCmdStats::CacheCmdStats(BaseCache &c,
                                         const std::string &name)
@@ -2271,6 +2640,10 @@ BaseCache::CacheStats::CacheStats(BaseCache &c)
              "number of data expansions"),
     ADD_STAT(dataContractions, statistics::units::Count::get(),
              "number of data contractions"),
+    ADD_STAT(warmupHits, statistics::units::Count::get(),
+             "number of functional warmup hits"),
+    ADD_STAT(warmupMisses, statistics::units::Count::get(),
+             "number of functional warmup misses"),
     cmd(MemCmd::NUM_MEM_CMDS)
 {
     for (int idx = 0; idx < MemCmd::NUM_MEM_CMDS; ++idx)
@@ -2500,6 +2873,8 @@ BaseCache::CacheStats::regStats()
 
     dataExpansions.flags(nozero | nonan);
     dataContractions.flags(nozero | nonan);
+    warmupHits.flags(nozero | nonan);
+    warmupMisses.flags(nozero | nonan);
 }
 
 void
@@ -2589,6 +2964,26 @@ BaseCache::CpuSidePort::recvFunctional(PacketPtr pkt)
     cache->functionalAccess(pkt, true);
 }
 
+void
+BaseCache::CpuSidePort::recvWarmAccess(Addr addr, bool is_secure,
+                                       bool needs_writable)
+{
+    cache->handleWarmAccess(addr, is_secure, needs_writable, false);
+}
+
+void
+BaseCache::CpuSidePort::recvWarmEvict(Addr addr, bool is_secure,
+                                      bool is_dirty, bool is_cached)
+{
+    cache->recvWarmEvict(addr, is_secure, is_dirty);
+}
+
+void
+BaseCache::CpuSidePort::recvWarmHold(Addr addr, bool is_secure)
+{
+    cache->memSidePort.sendWarmHold(addr, is_secure);
+}
+
 AddrRangeList
 BaseCache::CpuSidePort::getAddrRanges() const
 {
@@ -2647,6 +3042,26 @@ BaseCache::MemSidePort::recvFunctionalSnoop(PacketPtr pkt)
     cache->functionalAccess(pkt, false);
 }
 
+void
+BaseCache::MemSidePort::recvWarmInvalidate(Addr addr, bool is_secure)
+{
+    cache->recvWarmInvalidate(addr, is_secure);
+}
+
+void
+BaseCache::MemSidePort::recvWarmDowngrade(Addr addr, bool is_secure)
+{
+    cache->recvWarmDowngrade(addr, is_secure);
+}
+
+bool
+BaseCache::MemSidePort::recvWarmIsCached(Addr addr, bool is_secure)
+{
+    CacheBlk *blk = cache->tags->findBlock(addr, is_secure);
+    return (blk && blk->isValid()) ||
+        cache->cpuSidePort.sendWarmIsCached(addr, is_secure);
+}
+
 void
 BaseCache::CacheReqPacketQueue::sendDeferredPacket()
 {
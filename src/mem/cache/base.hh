@@ -49,6 +49,7 @@
 #include <cassert>
 #include <cstdint>
 #include <string>
+#include <unordered_set>
 
 #include "base/addr_range.hh"
 #include "base/compiler.hh"
@@ -257,6 +258,12 @@ class BaseCache : public ClockedObject
 
         virtual void recvFunctionalSnoop(PacketPtr pkt);
 
+        void recvWarmInvalidate(Addr addr, bool is_secure) override;
+
+        void recvWarmDowngrade(Addr addr, bool is_secure) override;
+
+        bool recvWarmIsCached(Addr addr, bool is_secure) override;
+
       public:
 
         MemSidePort(const std::string &_name, BaseCache *_cache,
@@ -326,6 +333,14 @@ class BaseCache : public ClockedObject
 
         virtual void recvFunctional(PacketPtr pkt) override;
 
+        void recvWarmAccess(Addr addr, bool is_secure,
+                            bool needs_writable) override;
+
+        void recvWarmEvict(Addr addr, bool is_secure, bool is_dirty,
+                           bool is_cached) override;
+
+        void recvWarmHold(Addr addr, bool is_secure) override;
+
         virtual AddrRangeList getAddrRanges() const override;
 
       public:
@@ -611,6 +626,67 @@ class BaseCache : public ClockedObject
      */
     virtual void functionalAccess(PacketPtr pkt, bool from_cpu_side);
 
+    /**
+     * Perform a functional warmup access. Only tags, coherence state and
+     * replacement data are updated; the data of blocks allocated this
+     * way is read from memory when the cache drains.
+     *
+     * @param addr Block address.
+     * @param is_secure Whether the address is in the secure space.
+     * @param needs_writable Whether the requester needs the block
+     *                       writable.
+     * @param first_level Whether this cache is the one the access
+     *                    originated at, rather than one below it.
+     * @return True if the access hit in this cache.
+     */
+    bool handleWarmAccess(Addr addr, bool is_secure, bool needs_writable,
+                          bool first_level);
+
+    /**
+     * Handle a block evicted by a cache above during functional warmup.
+     *
+     * @param addr Block address.
+     * @param is_secure Whether the address is in the secure space.
+     * @param is_dirty Whether the evicted block was dirty.
+     */
+    void recvWarmEvict(Addr addr, bool is_secure, bool is_dirty);
+
+    /**
+     * Invalidate a block on behalf of a cache below taking ownership of
+     * it during functional warmup, along with any copies above.
+     *
+     * @param addr Block address.
+     * @param is_secure Whether the address is in the secure space.
+     */
+    void recvWarmInvalidate(Addr addr, bool is_secure);
+
+    /**
+     * Take write permission away from a block, and from any copies
+     * above, on behalf of another cache reading it during functional
+     * warmup. An owner keeps its dirty block, as on a snooped read.
+     *
+     * @param addr Block address.
+     * @param is_secure Whether the address is in the secure space.
+     */
+    void recvWarmDowngrade(Addr addr, bool is_secure);
+
+    /**
+     * Allocate a block for a functional warmup access, evicting the
+     * victims functionally.
+     *
+     * @param addr Block address.
+     * @param is_secure Whether the address is in the secure space.
+     * @return The allocated block, or nullptr if nothing can be evicted.
+     */
+    CacheBlk *warmAllocate(Addr addr, bool is_secure);
+
+    /**
+     * Read the data of all blocks allocated by functional warmup from
+     * memory. Memory holds the up-to-date contents as long as the
+     * warmed caches were bypassed while warming.
+     */
+    void fillWarmBlocks();
+
     /**
      * Update the data contents of a block. When no packet is provided no
      * data will be written to the block, which means that this was likely
@@ -674,6 +750,9 @@ class BaseCache : public ClockedObject
      */
     const bool writebackClean;
 
+    /** Whether the cache contents are saved in checkpoints. */
+    const bool checkpointContents;
+
     /**
      * Writebacks from the tempBlock, resulting on the response path
      * in atomic mode, must happen after the call to recvAtomic has
@@ -853,6 +932,12 @@ class BaseCache : public ClockedObject
      */
     virtual void memWriteback() override;
 
+    /**
+     * Blocks allocated by functional warmup whose data has not been
+     * read from memory yet.
+     */
+    std::unordered_set<CacheBlk*> warmBlks;
+
     /**
      * Invalidates all blocks in the cache.
      *
@@ -1142,6 +1227,12 @@ class BaseCache : public ClockedObject
          */
         statistics::Scalar dataContractions;
 
+        /** Number of functional warmup accesses that hit. */
+        statistics::Scalar warmupHits;
+
+        /** Number of functional warmup accesses that missed. */
+        statistics::Scalar warmupMisses;
+
         /** Per-command statistics */
         std::vector<std::unique_ptr<CacheCmdStats>> cmd;
     } stats;
@@ -1170,6 +1261,28 @@ class BaseCache : public ClockedObject
 
     const AddrRangeList &getAddrRanges() const { return addrRanges; }
 
+    /**
+     * Warm the cache hierarchy below the caller with an access, without
+     * timing and without moving any data. This is meant to be fed from
+     * a probe on the CPU side while the caches are bypassed, e.g. in
+     * atomic_noncaching mode, and brings tags, coherence state and
+     * replacement data of this cache and the caches below it to where
+     * the same accesses in timing mode would have left them.
+     *
+     * @param addr Address of the access.
+     * @param is_secure Whether the address is in the secure space.
+     * @param is_write Whether the access is a write.
+     * @return True if the access hit in this cache.
+     */
+    bool
+    warmAccess(Addr addr, bool is_secure, bool is_write)
+    {
+        return handleWarmAccess(addr & ~Addr(blkSize - 1), is_secure,
+                                is_write, true);
+    }
+
+    DrainState drain() override;
+
     MSHR *allocateMissBuffer(PacketPtr pkt, Tick time, bool sched_send = true)
     {
         MSHR *mshr = mshrQueue.allocate(pkt->getBlockAddr(blkSize), blkSize,
@@ -1354,10 +1467,24 @@ class BaseCache : public ClockedObject
     /**
      * Serialize the state of the caches
      *
-     * We currently don't support checkpointing cache state, so this panics.
+     * Unless checkpointContents is set, only a flag telling whether the
+     * cache held dirty data is saved, and such checkpoints cannot be
+     * restored.
      */
     void serialize(CheckpointOut &cp) const override;
     void unserialize(CheckpointIn &cp) override;
+
+    /**
+     * Save the valid blocks of the cache. Metadata goes in the
+     * checkpoint section and block data in a separate compressed file.
+     */
+    void serializeContents(CheckpointOut &cp) const;
+
+    /**
+     * Restore the valid blocks of the cache, and make the snoop filters
+     * below aware of them.
+     */
+    void unserializeContents(CheckpointIn &cp);
 };
 
 /**
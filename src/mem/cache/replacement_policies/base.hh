@@ -110,6 +110,40 @@ class Base : public SimObject
      * @return A shared pointer to the new replacement data.
      */
     virtual std::shared_ptr<ReplacementData> instantiateEntry() = 0;
+
+    /**
+     * Get the name of the policy, which identifies the format of the
+     * state returned by getState() in checkpoints.
+     *
+     * @return The name of the policy's class.
+     */
+    virtual const char *typeName() const = 0;
+
+    /**
+     * Get the contents of a replacement data entry, so that it can be
+     * saved in a checkpoint. Policies without a saveable state return no
+     * values, and their entries are just reset on restore.
+     *
+     * @param replacement_data Replacement data to be saved.
+     * @return The entry's state.
+     */
+    virtual std::vector<uint64_t>
+    getState(const std::shared_ptr<ReplacementData>& replacement_data) const
+    {
+        return {};
+    }
+
+    /**
+     * Restore the contents of a replacement data entry.
+     *
+     * @param replacement_data Replacement data to be restored.
+     * @param state State as returned by getState().
+     */
+    virtual void
+    setState(const std::shared_ptr<ReplacementData>& replacement_data,
+             const std::vector<uint64_t> &state) const
+    {
+    }
 };
 
 } // namespace replacement_policy
@@ -76,6 +76,8 @@ class BIP : public LRU
      */
     void reset(const std::shared_ptr<ReplacementData>& replacement_data) const
                                                                      override;
+
+    const char *typeName() const override { return "BIP"; }
 };
 
 } // namespace replacement_policy
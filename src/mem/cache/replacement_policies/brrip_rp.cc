@@ -148,5 +148,23 @@ BRRIP::instantiateEntry()
     return std::shared_ptr<ReplacementData>(new BRRIPReplData(numRRPVBits));
 }
 
+std::vector<uint64_t>
+BRRIP::getState(const std::shared_ptr<ReplacementData>& replacement_data) const
+{
+    const auto data =
+        std::static_pointer_cast<BRRIPReplData>(replacement_data);
+    return {uint8_t(data->rrpv), data->valid};
+}
+
+void
+BRRIP::setState(const std::shared_ptr<ReplacementData>& replacement_data,
+    const std::vector<uint64_t> &state) const
+{
+    const auto data =
+        std::static_pointer_cast<BRRIPReplData>(replacement_data);
+    data->rrpv = SatCounter8(numRRPVBits, state.at(0));
+    data->valid = state.at(1);
+}
+
 } // namespace replacement_policy
 } // namespace gem5
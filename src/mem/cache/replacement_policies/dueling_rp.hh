@@ -111,6 +111,8 @@ class Dueling : public Base
     ReplaceableEntry* getVictim(const ReplacementCandidates& candidates) const
                                                                      override;
     std::shared_ptr<ReplacementData> instantiateEntry() override;
+
+    const char *typeName() const override { return "Dueling"; }
 };
 
 } // namespace replacement_policy
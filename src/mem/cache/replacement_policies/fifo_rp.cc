@@ -95,5 +95,20 @@ FIFO::instantiateEntry()
     return std::shared_ptr<ReplacementData>(new FIFOReplData());
 }
 
+std::vector<uint64_t>
+FIFO::getState(const std::shared_ptr<ReplacementData>& replacement_data) const
+{
+    const auto data = std::static_pointer_cast<FIFOReplData>(replacement_data);
+    return {data->tickInserted};
+}
+
+void
+FIFO::setState(const std::shared_ptr<ReplacementData>& replacement_data,
+    const std::vector<uint64_t> &state) const
+{
+    const auto data = std::static_pointer_cast<FIFOReplData>(replacement_data);
+    data->tickInserted = state.at(0);
+}
+
 } // namespace replacement_policy
 } // namespace gem5
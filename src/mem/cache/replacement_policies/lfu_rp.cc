@@ -93,5 +93,20 @@ LFU::instantiateEntry()
     return std::shared_ptr<ReplacementData>(new LFUReplData());
 }
 
+std::vector<uint64_t>
+LFU::getState(const std::shared_ptr<ReplacementData>& replacement_data) const
+{
+    const auto data = std::static_pointer_cast<LFUReplData>(replacement_data);
+    return {data->refCount};
+}
+
+void
+LFU::setState(const std::shared_ptr<ReplacementData>& replacement_data,
+    const std::vector<uint64_t> &state) const
+{
+    const auto data = std::static_pointer_cast<LFUReplData>(replacement_data);
+    data->refCount = state.at(0);
+}
+
 } // namespace replacement_policy
 } // namespace gem5
@@ -97,5 +97,20 @@ LRU::instantiateEntry()
     return std::shared_ptr<ReplacementData>(new LRUReplData());
 }
 
+std::vector<uint64_t>
+LRU::getState(const std::shared_ptr<ReplacementData>& replacement_data) const
+{
+    const auto data = std::static_pointer_cast<LRUReplData>(replacement_data);
+    return {data->lastTouchTick};
+}
+
+void
+LRU::setState(const std::shared_ptr<ReplacementData>& replacement_data,
+    const std::vector<uint64_t> &state) const
+{
+    const auto data = std::static_pointer_cast<LRUReplData>(replacement_data);
+    data->lastTouchTick = state.at(0);
+}
+
 } // namespace replacement_policy
 } // namespace gem5
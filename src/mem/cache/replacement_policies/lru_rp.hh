@@ -108,6 +108,13 @@ class LRU : public Base
      * @return A shared pointer to the new replacement data.
      */
     std::shared_ptr<ReplacementData> instantiateEntry() override;
+
+    std::vector<uint64_t> getState(const std::shared_ptr<ReplacementData>&
+        replacement_data) const override;
+    void setState(const std::shared_ptr<ReplacementData>& replacement_data,
+        const std::vector<uint64_t> &state) const override;
+
+    const char *typeName() const override { return "LRU"; }
 };
 
 } // namespace replacement_policy
@@ -102,5 +102,20 @@ MRU::instantiateEntry()
     return std::shared_ptr<ReplacementData>(new MRUReplData());
 }
 
+std::vector<uint64_t>
+MRU::getState(const std::shared_ptr<ReplacementData>& replacement_data) const
+{
+    const auto data = std::static_pointer_cast<MRUReplData>(replacement_data);
+    return {data->lastTouchTick};
+}
+
+void
+MRU::setState(const std::shared_ptr<ReplacementData>& replacement_data,
+    const std::vector<uint64_t> &state) const
+{
+    const auto data = std::static_pointer_cast<MRUReplData>(replacement_data);
+    data->lastTouchTick = state.at(0);
+}
+
 } // namespace replacement_policy
 } // namespace gem5
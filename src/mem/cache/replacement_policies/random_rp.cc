@@ -96,5 +96,23 @@ Random::instantiateEntry()
     return std::shared_ptr<ReplacementData>(new RandomReplData());
 }
 
+std::vector<uint64_t>
+Random::getState(
+    const std::shared_ptr<ReplacementData>& replacement_data) const
+{
+    const auto data =
+        std::static_pointer_cast<RandomReplData>(replacement_data);
+    return {data->valid};
+}
+
+void
+Random::setState(const std::shared_ptr<ReplacementData>& replacement_data,
+    const std::vector<uint64_t> &state) const
+{
+    const auto data =
+        std::static_pointer_cast<RandomReplData>(replacement_data);
+    data->valid = state.at(0);
+}
+
 } // namespace replacement_policy
 } // namespace gem5
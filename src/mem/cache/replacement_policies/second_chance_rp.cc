@@ -138,5 +138,25 @@ SecondChance::instantiateEntry()
     return std::shared_ptr<ReplacementData>(new SecondChanceReplData());
 }
 
+std::vector<uint64_t>
+SecondChance::getState(
+    const std::shared_ptr<ReplacementData>& replacement_data) const
+{
+    std::vector<uint64_t> state = FIFO::getState(replacement_data);
+    state.push_back(std::static_pointer_cast<SecondChanceReplData>(
+        replacement_data)->hasSecondChance);
+    return state;
+}
+
+void
+SecondChance::setState(
+    const std::shared_ptr<ReplacementData>& replacement_data,
+    const std::vector<uint64_t> &state) const
+{
+    FIFO::setState(replacement_data, state);
+    std::static_pointer_cast<SecondChanceReplData>(
+        replacement_data)->hasSecondChance = state.at(1);
+}
+
 } // namespace replacement_policy
 } // namespace gem5
@@ -147,6 +147,33 @@ SHiP::instantiateEntry()
     return std::shared_ptr<ReplacementData>(new SHiPReplData(numRRPVBits));
 }
 
+std::vector<uint64_t>
+SHiP::getState(const std::shared_ptr<ReplacementData>& replacement_data) const
+{
+    const auto data =
+        std::static_pointer_cast<SHiPReplData>(replacement_data);
+    std::vector<uint64_t> state = BRRIP::getState(replacement_data);
+    state.push_back(data->getSignature());
+    state.push_back(data->wasReReferenced());
+    return state;
+}
+
+void
+SHiP::setState(const std::shared_ptr<ReplacementData>& replacement_data,
+    const std::vector<uint64_t> &state) const
+{
+    const auto data =
+        std::static_pointer_cast<SHiPReplData>(replacement_data);
+    BRRIP::setState(replacement_data, state);
+
+    const SignatureType signature = state.at(2);
+    fatal_if(signature >= SHCT.size(), "SHiP signature %d out of range, "
+             "was the SHCT size changed?\n", signature);
+    data->setSignature(signature);
+    if (state.at(3))
+        data->setReReferenced();
+}
+
 SHiPMem::SHiPMem(const SHiPMemRPParams &p) : SHiP(p) {}
 
 SHiP::SignatureType
@@ -159,6 +159,16 @@ class SHiP : public BRRIP
      * @return A shared pointer to the new replacement data.
      */
     std::shared_ptr<ReplacementData> instantiateEntry() override;
+
+    /**
+     * The state of an entry is BRRIP's, followed by the signature that
+     * inserted it and whether it was re-referenced since, so that the
+     * predictor is trained correctly when a restored entry is evicted.
+     */
+    std::vector<uint64_t> getState(const std::shared_ptr<ReplacementData>&
+        replacement_data) const override;
+    void setState(const std::shared_ptr<ReplacementData>& replacement_data,
+        const std::vector<uint64_t> &state) const override;
 };
 
 /** SHiP that Uses memory addresses as signatures. */
@@ -170,6 +180,8 @@ class SHiPMem : public SHiP
   public:
     SHiPMem(const SHiPMemRPParams &p);
     ~SHiPMem() = default;
+
+    const char *typeName() const override { return "SHiPMem"; }
 };
 
 /** SHiP that Uses PCs as signatures. */
@@ -185,6 +197,8 @@ class SHiPPC : public SHiP
   public:
     SHiPPC(const SHiPPCRPParams &p);
     ~SHiPPC() = default;
+
+    const char *typeName() const override { return "SHiPPC"; }
 };
 
 } // namespace replacement_policy
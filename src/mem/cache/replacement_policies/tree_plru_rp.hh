@@ -208,6 +208,8 @@ class TreePLRU : public Base
      * @return A shared pointer to the new replacement data.
      */
     std::shared_ptr<ReplacementData> instantiateEntry() override;
+
+    const char *typeName() const override { return "TreePLRU"; }
 };
 
 } // namespace replacement_policy
@@ -84,6 +84,8 @@ class WeightedLRU : public LRU
      */
     ReplaceableEntry* getVictim(const ReplacementCandidates&
                                               candidates) const override;
+
+    const char *typeName() const override { return "WeightedLRU"; }
 };
 
 } // namespace replacement_policy
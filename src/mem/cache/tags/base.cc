@@ -83,8 +83,8 @@ BaseTags::findBlock(Addr addr, bool is_secure) const
     Addr tag = extractTag(addr);
 
     // Find possible entries that may contain the given address
-    const std::vector<ReplaceableEntry*> entries =
-        indexingPolicy->getPossibleEntries(addr);
+    const std::vector<ReplaceableEntry*>& entries =
+        indexingPolicy->getPossibleEntriesView(addr);
 
     // Search for block
     for (const auto& location : entries) {
@@ -99,7 +99,8 @@ BaseTags::findBlock(Addr addr, bool is_secure) const
 }
 
 void
-BaseTags::insertBlock(const PacketPtr pkt, CacheBlk *blk)
+BaseTags::doInsertBlock(Addr addr, bool is_secure, RequestorID requestor_id,
+                        uint32_t task_id, CacheBlk *blk)
 {
     assert(!blk->isValid());
 
@@ -107,25 +108,39 @@ BaseTags::insertBlock(const PacketPtr pkt, CacheBlk *blk)
     // to insert the new one
 
     // Deal with what we are bringing in
-    RequestorID requestor_id = pkt->req->requestorId();
     assert(requestor_id < system->maxRequestors());
     stats.occupancies[requestor_id]++;
 
     // Insert block with tag, src requestor id and task id
-    blk->insert(extractTag(pkt->getAddr()), pkt->isSecure(), requestor_id,
-                pkt->req->taskId());
+    blk->insert(extractTag(addr), is_secure, requestor_id, task_id);
 
     // Check if cache warm up is done
     if (!warmedUp && stats.tagsInUse.value() >= warmupBound) {
         warmedUp = true;
         stats.warmupTick = curTick();
     }
+}
+
+void
+BaseTags::insertBlock(const PacketPtr pkt, CacheBlk *blk)
+{
+    doInsertBlock(pkt->getAddr(), pkt->isSecure(), pkt->req->requestorId(),
+                  pkt->req->taskId(), blk);
 
     // We only need to write into one tag and one data block.
     stats.tagAccesses += 1;
     stats.dataAccesses += 1;
 }
 
+void
+BaseTags::warmInsertBlock(Addr addr, bool is_secure, CacheBlk *blk)
+{
+    // Functional warmup has no request to take the owner from, so the
+    // block is attributed to the functional requestor
+    doInsertBlock(addr, is_secure, Request::funcRequestorId,
+                  context_switch_task_id::Unknown, blk);
+}
+
 void
 BaseTags::moveBlock(CacheBlk *src_blk, CacheBlk *dest_blk)
 {
@@ -50,6 +50,7 @@
 #include <cstdint>
 #include <functional>
 #include <string>
+#include <vector>
 
 #include "base/callback.hh"
 #include "base/logging.hh"
@@ -157,6 +158,19 @@ class BaseTags : public ClockedObject
         statistics::Scalar dataAccesses;
     } stats;
 
+    /**
+     * Common block insertion functionality, shared by timing and
+     * functional warmup insertions.
+     *
+     * @param addr Address of the block.
+     * @param is_secure True if the target memory space is secure.
+     * @param requestor_id Requestor the block is attributed to.
+     * @param task_id Task the block is attributed to.
+     * @param blk The block to update. Must be invalid.
+     */
+    void doInsertBlock(Addr addr, bool is_secure, RequestorID requestor_id,
+                       uint32_t task_id, CacheBlk *blk);
+
   public:
     typedef BaseTagsParams Params;
     BaseTags(const Params &p);
@@ -310,6 +324,64 @@ class BaseTags : public ClockedObject
      */
     virtual void insertBlock(const PacketPtr pkt, CacheBlk *blk);
 
+    /**
+     * Find a block for a functional warmup access and update its
+     * replacement data. Unlike accessBlock() this neither needs a packet
+     * nor accounts for tag and data array accesses.
+     *
+     * @param addr The address to find.
+     * @param is_secure True if the target memory space is secure.
+     * @return Pointer to the cache block if found.
+     */
+    virtual CacheBlk* warmAccessBlock(Addr addr, bool is_secure) = 0;
+
+    /**
+     * Insert a block during functional warmup. The block carries no data
+     * and is not accounted as a tag or data array access.
+     *
+     * @param addr Address of the block.
+     * @param is_secure True if the target memory space is secure.
+     * @param blk The block to update. Must be invalid.
+     */
+    virtual void warmInsertBlock(Addr addr, bool is_secure, CacheBlk *blk);
+
+    /**
+     * Get the type of the replacement policy, so that a checkpointed
+     * replacement state is only restored by the policy that saved it.
+     * Tags without per-block replacement data return an empty string.
+     *
+     * @return The type name of the replacement policy.
+     */
+    virtual std::string
+    getReplacementPolicyType() const
+    {
+        return "";
+    }
+
+    /**
+     * Get the replacement state of a block to save it in a checkpoint.
+     * Tags without per-block replacement data return no values.
+     *
+     * @param blk The block.
+     * @return The block's replacement state.
+     */
+    virtual std::vector<uint64_t>
+    getReplacementState(const CacheBlk *blk) const
+    {
+        return {};
+    }
+
+    /**
+     * Restore the replacement state of a block.
+     *
+     * @param blk The block. Must be valid.
+     * @param state State as returned by getReplacementState().
+     */
+    virtual void
+    setReplacementState(CacheBlk *blk, const std::vector<uint64_t> &state)
+    {
+    }
+
     /**
      * Move a block's metadata to another location decided by the replacement
      * policy. It behaves as a swap, however, since the destination block
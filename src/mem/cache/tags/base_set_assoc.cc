@@ -53,7 +53,8 @@ namespace gem5
 {
 
 BaseSetAssoc::BaseSetAssoc(const Params &p)
-    :BaseTags(p), allocAssoc(p.assoc), blks(p.size / p.block_size),
+    :BaseTags(p), allocAssoc(p.assoc), assoc(p.assoc),
+     blks(p.size / p.block_size), packedLookup(true),
      sequentialAccess(p.sequential_access),
      replacementPolicy(p.replacement_policy)
 {
@@ -69,6 +70,8 @@ BaseSetAssoc::BaseSetAssoc(const Params &p)
 void
 BaseSetAssoc::tagsInit()
 {
+    packedTags.init(numBlocks / assoc, assoc);
+
     // Initialize all blocks
     for (unsigned blk_index = 0; blk_index < numBlocks; blk_index++) {
         // Locate next cache block
@@ -77,6 +80,12 @@ BaseSetAssoc::tagsInit()
         // Link block to indexing policy
         indexingPolicy->setEntry(blk, blk_index);
 
+        // The packed keys assume the policy places the blocks set by set
+        if (blk->getSet() != blk_index / assoc ||
+                blk->getWay() != blk_index % assoc) {
+            packedLookup = false;
+        }
+
         // Associate a data chunk to the block
         blk->data = &dataBlks[blkSize*blk_index];
 
@@ -85,10 +94,29 @@ BaseSetAssoc::tagsInit()
     }
 }
 
+CacheBlk*
+BaseSetAssoc::findBlock(Addr addr, bool is_secure) const
+{
+    uint32_t set;
+    if (!packedLookup || !indexingPolicy->getUniqueSet(addr, set))
+        return BaseTags::findBlock(addr, is_secure);
+
+    const Addr tag = extractTag(addr);
+    const int way = packedTags.findWay(set, tag, is_secure);
+    if (way < 0)
+        return nullptr;
+
+    // Blocks are only handed out as mutable, as in BaseTags::findBlock()
+    CacheBlk *blk = const_cast<CacheBlk*>(&blks[set * assoc + way]);
+    assert(blk->matchTag(tag, is_secure));
+    return blk;
+}
+
 void
 BaseSetAssoc::invalidate(CacheBlk *blk)
 {
     BaseTags::invalidate(blk);
+    packedTags.invalidate(blkIndex(blk));
 
     // Decrease the number of tags in use
     stats.tagsInUse--;
@@ -101,6 +129,9 @@ void
 BaseSetAssoc::moveBlock(CacheBlk *src_blk, CacheBlk *dest_blk)
 {
     BaseTags::moveBlock(src_blk, dest_blk);
+    packedTags.invalidate(blkIndex(src_blk));
+    packedTags.insert(blkIndex(dest_blk), dest_blk->getTag(),
+                      dest_blk->isSecure());
 
     // Since the blocks were using different replacement data pointers,
     // we must touch the replacement data of the new entry, and invalidate
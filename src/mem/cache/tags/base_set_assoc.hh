@@ -59,6 +59,7 @@
 #include "mem/cache/replacement_policies/replaceable_entry.hh"
 #include "mem/cache/tags/base.hh"
 #include "mem/cache/tags/indexing_policies/base.hh"
+#include "mem/cache/tags/packed_tags.hh"
 #include "mem/packet.hh"
 #include "params/BaseSetAssoc.hh"
 
@@ -78,15 +79,30 @@ class BaseSetAssoc : public BaseTags
     /** The allocatable associativity of the cache (alloc mask). */
     unsigned allocAssoc;
 
+    /** The associativity of the cache. */
+    const unsigned assoc;
+
     /** The cache blocks. */
     std::vector<CacheBlk> blks;
 
+    /** Lookup keys of the blocks, kept in sync with blks. */
+    PackedTags packedTags;
+
+    /**
+     * Whether the blocks of each set are laid out as the indexing policy's
+     * sets, so that lookups may use packedTags.
+     */
+    bool packedLookup;
+
     /** Whether tags and data are accessed sequentially. */
     const bool sequentialAccess;
 
     /** Replacement policy */
     replacement_policy::Base *replacementPolicy;
 
+    /** The index of a block in blks and packedTags. */
+    uint64_t blkIndex(const CacheBlk *blk) const { return blk - blks.data(); }
+
   public:
     /** Convenience typedef. */
      typedef BaseSetAssocParams Params;
@@ -114,6 +130,16 @@ class BaseSetAssoc : public BaseTags
      */
     void invalidate(CacheBlk *blk) override;
 
+    /**
+     * Find a block given its address. Uses the packed tag keys when the
+     * indexing policy maps the address to a single set.
+     *
+     * @param addr The address to find.
+     * @param is_secure True if the target memory space is secure.
+     * @return Pointer to the cache block if found.
+     */
+    CacheBlk* findBlock(Addr addr, bool is_secure) const override;
+
     /**
      * Access block and update replacement data. May not succeed, in which case
      * nullptr is returned. This has all the implications of a cache access and
@@ -170,8 +196,8 @@ class BaseSetAssoc : public BaseTags
                          std::vector<CacheBlk*>& evict_blks) override
     {
         // Get possible entries to be victimized
-        const std::vector<ReplaceableEntry*> entries =
-            indexingPolicy->getPossibleEntries(addr);
+        const std::vector<ReplaceableEntry*>& entries =
+            indexingPolicy->getPossibleEntriesView(addr);
 
         // Choose replacement victim from replacement candidates
         CacheBlk* victim = static_cast<CacheBlk*>(replacementPolicy->getVictim(
@@ -193,6 +219,7 @@ class BaseSetAssoc : public BaseTags
     {
         // Insert block
         BaseTags::insertBlock(pkt, blk);
+        packedTags.insert(blkIndex(blk), blk->getTag(), blk->isSecure());
 
         // Increment tag counter
         stats.tagsInUse++;
@@ -201,6 +228,41 @@ class BaseSetAssoc : public BaseTags
         replacementPolicy->reset(blk->replacementData, pkt);
     }
 
+    CacheBlk* warmAccessBlock(Addr addr, bool is_secure) override
+    {
+        CacheBlk *blk = findBlock(addr, is_secure);
+        if (blk != nullptr)
+            replacementPolicy->touch(blk->replacementData);
+        return blk;
+    }
+
+    void warmInsertBlock(Addr addr, bool is_secure, CacheBlk *blk) override
+    {
+        BaseTags::warmInsertBlock(addr, is_secure, blk);
+        packedTags.insert(blkIndex(blk), blk->getTag(), blk->isSecure());
+        stats.tagsInUse++;
+        replacementPolicy->reset(blk->replacementData);
+    }
+
+    std::string
+    getReplacementPolicyType() const override
+    {
+        return replacementPolicy->typeName();
+    }
+
+    std::vector<uint64_t>
+    getReplacementState(const CacheBlk *blk) const override
+    {
+        return replacementPolicy->getState(blk->replacementData);
+    }
+
+    void
+    setReplacementState(CacheBlk *blk,
+                        const std::vector<uint64_t> &state) override
+    {
+        replacementPolicy->setState(blk->replacementData, state);
+    }
+
     void moveBlock(CacheBlk *src_blk, CacheBlk *dest_blk) override;
 
     /**
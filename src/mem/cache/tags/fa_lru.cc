@@ -223,6 +223,29 @@ FALRU::insertBlock(const PacketPtr pkt, CacheBlk *blk)
     tagHash[std::make_pair(blk->getTag(), blk->isSecure())] = falruBlk;
 }
 
+CacheBlk*
+FALRU::warmAccessBlock(Addr addr, bool is_secure)
+{
+    FALRUBlk* blk = static_cast<FALRUBlk*>(findBlock(addr, is_secure));
+
+    if (blk && blk->isValid())
+        moveToHead(blk);
+
+    return blk;
+}
+
+void
+FALRU::warmInsertBlock(Addr addr, bool is_secure, CacheBlk *blk)
+{
+    FALRUBlk* falruBlk = static_cast<FALRUBlk*>(blk);
+    assert(falruBlk->inCachesMask == 0);
+
+    BaseTags::warmInsertBlock(addr, is_secure, blk);
+    stats.tagsInUse++;
+    moveToHead(falruBlk);
+    tagHash[std::make_pair(blk->getTag(), blk->isSecure())] = falruBlk;
+}
+
 void
 FALRU::moveBlock(CacheBlk *src_blk, CacheBlk *dest_blk)
 {
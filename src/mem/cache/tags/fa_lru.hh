@@ -229,6 +229,9 @@ class FALRU : public BaseTags
      */
     void insertBlock(const PacketPtr pkt, CacheBlk *blk) override;
 
+    CacheBlk* warmAccessBlock(Addr addr, bool is_secure) override;
+    void warmInsertBlock(Addr addr, bool is_secure, CacheBlk *blk) override;
+
     void moveBlock(CacheBlk *src_blk, CacheBlk *dest_blk) override;
 
     /**
@@ -96,6 +96,12 @@ class BaseIndexingPolicy : public SimObject
      */
     const int tagShift;
 
+    /**
+     * Scratch list returned by getPossibleEntriesView() for policies
+     * whose possible entries are not stored as one of the sets.
+     */
+    mutable std::vector<ReplaceableEntry*> candidates;
+
   public:
     /**
      * Convenience typedef.
@@ -149,6 +155,37 @@ class BaseIndexingPolicy : public SimObject
     virtual std::vector<ReplaceableEntry*> getPossibleEntries(const Addr addr)
                                                                     const = 0;
 
+    /**
+     * Find all possible entries of an address without allocating. The
+     * returned list either is one of the policy's sets or is storage
+     * owned by the policy, so it is only valid until the next call.
+     *
+     * @param addr The addr to a find possible entries for.
+     * @return The possible entries.
+     */
+    virtual const std::vector<ReplaceableEntry*>&
+    getPossibleEntriesView(const Addr addr) const
+    {
+        candidates = getPossibleEntries(addr);
+        return candidates;
+    }
+
+    /**
+     * Find the set whose ways, in way order, are exactly the possible
+     * entries of an address. Tag stores use this to keep packed per-set
+     * lookup state; policies that spread an address over several sets
+     * have no such set.
+     *
+     * @param addr The address.
+     * @param set The set, if there is one.
+     * @return Whether the possible entries form a single set.
+     */
+    virtual bool
+    getUniqueSet(const Addr addr, uint32_t &set) const
+    {
+        return false;
+    }
+
     /**
      * Regenerate an entry's address from its tag and assigned indexing bits.
      *
@@ -118,6 +118,33 @@ class SetAssociative : public BaseIndexingPolicy
     std::vector<ReplaceableEntry*> getPossibleEntries(const Addr addr) const
                                                                      override;
 
+    /**
+     * Find all possible entries of an address without allocating. These
+     * are the ways of the address' set, so the set itself is returned.
+     *
+     * @param addr The addr to a find possible entries for.
+     * @return The possible entries.
+     */
+    const std::vector<ReplaceableEntry*>&
+    getPossibleEntriesView(const Addr addr) const override
+    {
+        return sets[extractSet(addr)];
+    }
+
+    /**
+     * All possible entries of an address are the ways of its set.
+     *
+     * @param addr The address.
+     * @param set The address' set.
+     * @return Always true.
+     */
+    bool
+    getUniqueSet(const Addr addr, uint32_t &set) const override
+    {
+        set = extractSet(addr);
+        return true;
+    }
+
     /**
      * Regenerate an entry's address from its tag and assigned set and way.
      *
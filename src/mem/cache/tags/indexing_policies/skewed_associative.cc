@@ -220,4 +220,15 @@ SkewedAssociative::getPossibleEntries(const Addr addr) const
     return entries;
 }
 
+const std::vector<ReplaceableEntry*>&
+SkewedAssociative::getPossibleEntriesView(const Addr addr) const
+{
+    candidates.resize(assoc);
+    for (uint32_t way = 0; way < assoc; ++way) {
+        candidates[way] = sets[extractSet(addr, way)][way];
+    }
+
+    return candidates;
+}
+
 } // namespace gem5
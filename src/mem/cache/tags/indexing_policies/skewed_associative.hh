@@ -163,6 +163,16 @@ class SkewedAssociative : public BaseIndexingPolicy
     std::vector<ReplaceableEntry*> getPossibleEntries(const Addr addr) const
                                                                    override;
 
+    /**
+     * Find all possible entries of an address without allocating. The
+     * entries are gathered into storage owned by the policy.
+     *
+     * @param addr The addr to a find possible entries for.
+     * @return The possible entries.
+     */
+    const std::vector<ReplaceableEntry*>&
+    getPossibleEntriesView(const Addr addr) const override;
+
     /**
      * Regenerate an entry's address from its tag and assigned set and way.
      * Uses the inverse of the skewing function.
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Declaration of a packed, structure-of-arrays tag lookup array.
+ */
+
+#ifndef __MEM_CACHE_TAGS_PACKED_TAGS_HH__
+#define __MEM_CACHE_TAGS_PACKED_TAGS_HH__
+
+#if defined(__AVX2__) || defined(__SSE4_1__)
+#include <immintrin.h>
+#endif
+
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include "base/bitfield.hh"
+#include "base/types.hh"
+
+namespace gem5
+{
+
+/**
+ * Lookup keys of a set associative tag store, kept apart from the blocks
+ * themselves. Each way's key packs its tag, secure bit and valid bit into
+ * one word, and the keys of a set are contiguous, so a lookup compares a
+ * few cache lines of keys instead of dereferencing every block of the
+ * set. When the simulator is built for a host with AVX2 or SSE4.1 the
+ * compare is vectorised.
+ *
+ * The tag store owns the blocks and must update the keys whenever a
+ * block is inserted, invalidated or moved.
+ */
+class PackedTags
+{
+  private:
+    /** The number of ways per set. */
+    unsigned assoc = 0;
+
+    /** Keys of all entries, indexed by set * assoc + way. */
+    std::vector<uint64_t> keys;
+
+  public:
+    /** The key of an invalid entry, which no lookup key matches. */
+    static constexpr uint64_t Invalid = 0;
+
+    /**
+     * Build the key of a valid entry. Tags are at least two bits shorter
+     * than an address since blocks are at least four bytes.
+     */
+    static uint64_t
+    key(Addr tag, bool is_secure)
+    {
+        return tag << 2 | uint64_t(is_secure) << 1 | 1;
+    }
+
+    /**
+     * Find the first of count keys equal to needle.
+     *
+     * @return The index of the matching key, or -1 if there is none.
+     */
+    static int
+    match(const uint64_t *keys, unsigned count, uint64_t needle)
+    {
+        unsigned i = 0;
+#if defined(__AVX2__)
+        const __m256i wide = _mm256_set1_epi64x(needle);
+        for (; i + 4 <= count; i += 4) {
+            const __m256i v = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i *>(keys + i));
+            const int hits = _mm256_movemask_pd(
+                _mm256_castsi256_pd(_mm256_cmpeq_epi64(v, wide)));
+            if (hits)
+                return i + ctz32(hits);
+        }
+#elif defined(__SSE4_1__)
+        const __m128i wide = _mm_set1_epi64x(needle);
+        for (; i + 2 <= count; i += 2) {
+            const __m128i v = _mm_loadu_si128(
+                reinterpret_cast<const __m128i *>(keys + i));
+            const int hits = _mm_movemask_pd(
+                _mm_castsi128_pd(_mm_cmpeq_epi64(v, wide)));
+            if (hits)
+                return i + ctz32(hits);
+        }
+#endif
+        for (; i < count; i++) {
+            if (keys[i] == needle)
+                return i;
+        }
+        return -1;
+    }
+
+    /** Size the array and mark every entry invalid. */
+    void
+    init(uint32_t num_sets, unsigned _assoc)
+    {
+        assoc = _assoc;
+        keys.assign(uint64_t(num_sets) * assoc, Invalid);
+    }
+
+    /** Record that the entry at index holds a valid block. */
+    void
+    insert(uint64_t index, Addr tag, bool is_secure)
+    {
+        assert(index < keys.size());
+        keys[index] = key(tag, is_secure);
+    }
+
+    /** Record that the entry at index no longer holds a valid block. */
+    void
+    invalidate(uint64_t index)
+    {
+        assert(index < keys.size());
+        keys[index] = Invalid;
+    }
+
+    /**
+     * Find the way of a set holding a valid block with the given tag.
+     *
+     * @return The way, or -1 on a miss.
+     */
+    int
+    findWay(uint32_t set, Addr tag, bool is_secure) const
+    {
+        assert(uint64_t(set + 1) * assoc <= keys.size());
+        return match(&keys[uint64_t(set) * assoc], assoc,
+                     key(tag, is_secure));
+    }
+};
+
+} // namespace gem5
+
+#endif //__MEM_CACHE_TAGS_PACKED_TAGS_HH__
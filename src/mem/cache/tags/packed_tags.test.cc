@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "mem/cache/tags/packed_tags.hh"
+
+using namespace gem5;
+
+/**
+ * Every position of arrays of all sizes around the vector widths is found,
+ * including the scalar tail.
+ */
+TEST(PackedTagsTest, MatchEveryPosition)
+{
+    for (unsigned count = 1; count <= 19; count++) {
+        std::vector<uint64_t> keys;
+        for (unsigned i = 0; i < count; i++)
+            keys.push_back(PackedTags::key(0x100 + i, false));
+
+        for (unsigned i = 0; i < count; i++) {
+            ASSERT_EQ(PackedTags::match(keys.data(), count, keys[i]), int(i))
+                << "count " << count;
+        }
+        ASSERT_EQ(PackedTags::match(keys.data(), count,
+                                    PackedTags::key(0x100 + count, false)),
+                  -1);
+    }
+}
+
+/** Only the first of several equal keys is reported. */
+TEST(PackedTagsTest, MatchFirst)
+{
+    const uint64_t needle = PackedTags::key(0x42, true);
+    std::vector<uint64_t> keys(9, PackedTags::Invalid);
+    keys[5] = needle;
+    keys[7] = needle;
+    ASSERT_EQ(PackedTags::match(keys.data(), keys.size(), needle), 5);
+    keys[1] = needle;
+    ASSERT_EQ(PackedTags::match(keys.data(), keys.size(), needle), 1);
+}
+
+/** Tag, secure bit and valid bit all take part in a match. */
+TEST(PackedTagsTest, KeyFields)
+{
+    ASSERT_NE(PackedTags::key(0, false), PackedTags::Invalid);
+    ASSERT_NE(PackedTags::key(0, true), PackedTags::key(0, false));
+    ASSERT_NE(PackedTags::key(1, false), PackedTags::key(0, false));
+    ASSERT_NE(PackedTags::key(MaxAddr >> 2, true), PackedTags::Invalid);
+}
+
+TEST(PackedTagsTest, FindWay)
+{
+    const uint32_t num_sets = 4;
+    const unsigned assoc = 6;
+    PackedTags tags;
+    tags.init(num_sets, assoc);
+
+    // An empty array misses everywhere, even on tag 0
+    for (uint32_t set = 0; set < num_sets; set++) {
+        ASSERT_EQ(tags.findWay(set, 0, false), -1);
+        ASSERT_EQ(tags.findWay(set, 0, true), -1);
+    }
+
+    tags.insert(2 * assoc + 3, 0x77, false);
+    tags.insert(2 * assoc + 5, 0x77, true);
+    tags.insert(1 * assoc + 3, 0x78, false);
+
+    ASSERT_EQ(tags.findWay(2, 0x77, false), 3);
+    ASSERT_EQ(tags.findWay(2, 0x77, true), 5);
+    ASSERT_EQ(tags.findWay(1, 0x77, false), -1);
+    ASSERT_EQ(tags.findWay(1, 0x78, false), 3);
+    ASSERT_EQ(tags.findWay(2, 0x78, false), -1);
+
+    tags.invalidate(2 * assoc + 3);
+    ASSERT_EQ(tags.findWay(2, 0x77, false), -1);
+    ASSERT_EQ(tags.findWay(2, 0x77, true), 5);
+
+    // Re-initialising clears everything
+    tags.init(num_sets, assoc);
+    ASSERT_EQ(tags.findWay(2, 0x77, true), -1);
+}
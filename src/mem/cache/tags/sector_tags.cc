@@ -200,6 +200,61 @@ SectorTags::insertBlock(const PacketPtr pkt, CacheBlk *blk)
     BaseTags::insertBlock(pkt, blk);
 }
 
+CacheBlk*
+SectorTags::warmAccessBlock(Addr addr, bool is_secure)
+{
+    CacheBlk *blk = findBlock(addr, is_secure);
+
+    // Replacement data is shared by the whole sector
+    if (blk != nullptr) {
+        const SectorBlk* sector_blk =
+            static_cast<SectorSubBlk*>(blk)->getSectorBlock();
+        replacementPolicy->touch(sector_blk->replacementData);
+    }
+
+    return blk;
+}
+
+std::string
+SectorTags::getReplacementPolicyType() const
+{
+    return replacementPolicy->typeName();
+}
+
+std::vector<uint64_t>
+SectorTags::getReplacementState(const CacheBlk *blk) const
+{
+    const SectorBlk* sector_blk =
+        static_cast<const SectorSubBlk*>(blk)->getSectorBlock();
+    return replacementPolicy->getState(sector_blk->replacementData);
+}
+
+void
+SectorTags::setReplacementState(CacheBlk *blk,
+                                const std::vector<uint64_t> &state)
+{
+    const SectorBlk* sector_blk =
+        static_cast<SectorSubBlk*>(blk)->getSectorBlock();
+    replacementPolicy->setState(sector_blk->replacementData, state);
+}
+
+void
+SectorTags::warmInsertBlock(Addr addr, bool is_secure, CacheBlk *blk)
+{
+    const SectorBlk* sector_blk =
+        static_cast<SectorSubBlk*>(blk)->getSectorBlock();
+
+    if (sector_blk->isValid()) {
+        replacementPolicy->touch(sector_blk->replacementData);
+    } else {
+        stats.tagsInUse++;
+        assert(stats.tagsInUse.value() <= numSectors);
+        replacementPolicy->reset(sector_blk->replacementData);
+    }
+
+    BaseTags::warmInsertBlock(addr, is_secure, blk);
+}
+
 void
 SectorTags::moveBlock(CacheBlk *src_blk, CacheBlk *dest_blk)
 {
@@ -257,8 +312,8 @@ SectorTags::findBlock(Addr addr, bool is_secure) const
     const Addr offset = extractSectorOffset(addr);
 
     // Find all possible sector entries that may contain the given address
-    const std::vector<ReplaceableEntry*> entries =
-        indexingPolicy->getPossibleEntries(addr);
+    const std::vector<ReplaceableEntry*>& entries =
+        indexingPolicy->getPossibleEntriesView(addr);
 
     // Search for block
     for (const auto& sector : entries) {
@@ -277,8 +332,8 @@ SectorTags::findVictim(Addr addr, const bool is_secure, const std::size_t size,
                        std::vector<CacheBlk*>& evict_blks)
 {
     // Get possible entries to be victimized
-    const std::vector<ReplaceableEntry*> sector_entries =
-        indexingPolicy->getPossibleEntries(addr);
+    const std::vector<ReplaceableEntry*>& sector_entries =
+        indexingPolicy->getPossibleEntriesView(addr);
 
     // Check if the sector this address belongs to has been allocated
     Addr tag = extractTag(addr);
@@ -153,6 +153,20 @@ class SectorTags : public BaseTags
      */
     void insertBlock(const PacketPtr pkt, CacheBlk *blk) override;
 
+    CacheBlk* warmAccessBlock(Addr addr, bool is_secure) override;
+    void warmInsertBlock(Addr addr, bool is_secure, CacheBlk *blk) override;
+
+    std::string getReplacementPolicyType() const override;
+
+    /**
+     * The replacement state is that of the block's sector, so it is
+     * saved and restored once for each valid sub-block.
+     */
+    std::vector<uint64_t>
+    getReplacementState(const CacheBlk *blk) const override;
+    void setReplacementState(CacheBlk *blk,
+                             const std::vector<uint64_t> &state) override;
+
     void moveBlock(CacheBlk *src_blk, CacheBlk *dest_blk) override;
 
     /**
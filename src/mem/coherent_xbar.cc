@@ -1033,6 +1033,124 @@ CoherentXBar::recvFunctional(PacketPtr pkt, PortID cpu_side_port_id)
     }
 }
 
+void
+CoherentXBar::recvWarmAccess(Addr addr, bool is_secure, bool needs_writable,
+                             PortID cpu_side_port_id)
+{
+    const QueuedResponsePort *src_port = cpuSidePorts[cpu_side_port_id];
+
+    DPRINTF(CoherentXBar, "%s: src %s addr %#x writable %d\n", __func__,
+            src_port->name(), addr, needs_writable);
+
+    // A requester taking ownership invalidates all other copies above,
+    // a reader leaves them without write permission, as the snoops of
+    // the corresponding timing requests would
+    std::vector<QueuedResponsePort*> others;
+    if (snoopFilter) {
+        others = snoopFilter->warmAccess(addr, is_secure, *src_port,
+                                         needs_writable);
+    } else {
+        for (const auto& p : snoopPorts) {
+            if (p != src_port)
+                others.push_back(p);
+        }
+    }
+    for (const auto& p : others) {
+        if (needs_writable)
+            p->sendWarmInvalidate(addr, is_secure);
+        else
+            p->sendWarmDowngrade(addr, is_secure);
+    }
+
+    PortID dest_id = findPort(RangeSize(addr, 1));
+    memSidePorts[dest_id]->sendWarmAccess(addr, is_secure, needs_writable);
+}
+
+void
+CoherentXBar::recvWarmEvict(Addr addr, bool is_secure, bool is_dirty,
+                            bool is_cached, PortID cpu_side_port_id)
+{
+    const QueuedResponsePort *src_port = cpuSidePorts[cpu_side_port_id];
+
+    DPRINTF(CoherentXBar, "%s: src %s addr %#x dirty %d cached %d\n",
+            __func__, src_port->name(), addr, is_dirty, is_cached);
+
+    // As with timing evictions, the sender stays a holder as long as a
+    // cache above it still has the block
+    if (snoopFilter && !is_cached)
+        snoopFilter->warmEvict(addr, is_secure, *src_port);
+
+    PortID dest_id = findPort(RangeSize(addr, 1));
+    memSidePorts[dest_id]->sendWarmEvict(addr, is_secure, is_dirty,
+                                         is_cached);
+}
+
+void
+CoherentXBar::recvWarmInvalidate(Addr addr, bool is_secure,
+                                 PortID mem_side_port_id)
+{
+    DPRINTF(CoherentXBar, "%s: src %s addr %#x\n", __func__,
+            memSidePorts[mem_side_port_id]->name(), addr);
+
+    if (snoopFilter) {
+        for (const auto& p : snoopFilter->warmInvalidate(addr, is_secure))
+            p->sendWarmInvalidate(addr, is_secure);
+    } else {
+        for (const auto& p : snoopPorts)
+            p->sendWarmInvalidate(addr, is_secure);
+    }
+}
+
+void
+CoherentXBar::recvWarmDowngrade(Addr addr, bool is_secure,
+                                PortID mem_side_port_id)
+{
+    DPRINTF(CoherentXBar, "%s: src %s addr %#x\n", __func__,
+            memSidePorts[mem_side_port_id]->name(), addr);
+
+    // The holders keep their copies, so the snoop filter is unchanged
+    if (snoopFilter) {
+        for (const auto& p : snoopFilter->warmHolders(addr, is_secure))
+            p->sendWarmDowngrade(addr, is_secure);
+    } else {
+        for (const auto& p : snoopPorts)
+            p->sendWarmDowngrade(addr, is_secure);
+    }
+}
+
+void
+CoherentXBar::recvWarmHold(Addr addr, bool is_secure,
+                           PortID cpu_side_port_id)
+{
+    if (snoopFilter) {
+        snoopFilter->warmAccess(addr, is_secure,
+                                *cpuSidePorts[cpu_side_port_id], false);
+    }
+
+    PortID dest_id = findPort(RangeSize(addr, 1));
+    memSidePorts[dest_id]->sendWarmHold(addr, is_secure);
+}
+
+bool
+CoherentXBar::recvWarmIsCached(Addr addr, bool is_secure,
+                               PortID mem_side_port_id)
+{
+    // The snoop filter may be conservative, so ask the holders it knows
+    if (snoopFilter) {
+        for (const auto& p : snoopFilter->warmHolders(addr, is_secure)) {
+            if (p->sendWarmIsCached(addr, is_secure))
+                return true;
+        }
+    } else {
+        for (const auto& p : snoopPorts) {
+            if (p->sendWarmIsCached(addr, is_secure))
+                return true;
+        }
+    }
+
+    return false;
+}
+
 void
 CoherentXBar::recvFunctionalSnoop(PacketPtr pkt, PortID mem_side_port_id)
 {
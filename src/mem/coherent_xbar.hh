@@ -136,6 +136,26 @@ class CoherentXBar : public BaseXBar
             xbar.recvFunctional(pkt, id);
         }
 
+        void
+        recvWarmAccess(Addr addr, bool is_secure,
+                       bool needs_writable) override
+        {
+            xbar.recvWarmAccess(addr, is_secure, needs_writable, id);
+        }
+
+        void
+        recvWarmEvict(Addr addr, bool is_secure, bool is_dirty,
+                      bool is_cached) override
+        {
+            xbar.recvWarmEvict(addr, is_secure, is_dirty, is_cached, id);
+        }
+
+        void
+        recvWarmHold(Addr addr, bool is_secure) override
+        {
+            xbar.recvWarmHold(addr, is_secure, id);
+        }
+
         AddrRangeList
         getAddrRanges() const override
         {
@@ -196,6 +216,24 @@ class CoherentXBar : public BaseXBar
             xbar.recvFunctionalSnoop(pkt, id);
         }
 
+        void
+        recvWarmInvalidate(Addr addr, bool is_secure) override
+        {
+            xbar.recvWarmInvalidate(addr, is_secure, id);
+        }
+
+        void
+        recvWarmDowngrade(Addr addr, bool is_secure) override
+        {
+            xbar.recvWarmDowngrade(addr, is_secure, id);
+        }
+
+        bool
+        recvWarmIsCached(Addr addr, bool is_secure) override
+        {
+            return xbar.recvWarmIsCached(addr, is_secure, id);
+        }
+
         void recvRangeChange() override { xbar.recvRangeChange(id); }
         void recvReqRetry() override { xbar.recvReqRetry(id); }
 
@@ -378,6 +416,35 @@ class CoherentXBar : public BaseXBar
         snoop transaction.*/
     void recvFunctionalSnoop(PacketPtr pkt, PortID mem_side_port_id);
 
+    /** Function called by the port when the crossbar is receiving a
+        functional warmup access.*/
+    void recvWarmAccess(Addr addr, bool is_secure, bool needs_writable,
+                        PortID cpu_side_port_id);
+
+    /** Function called by the port when the crossbar is receiving a
+        functional warmup eviction.*/
+    void recvWarmEvict(Addr addr, bool is_secure, bool is_dirty,
+                       bool is_cached, PortID cpu_side_port_id);
+
+    /** Function called by the port when the crossbar is told that a
+        cache above holds a block.*/
+    void recvWarmHold(Addr addr, bool is_secure, PortID cpu_side_port_id);
+
+    /** Function called by the port when the crossbar is receiving a
+        functional warmup invalidation from below.*/
+    void recvWarmInvalidate(Addr addr, bool is_secure,
+                            PortID mem_side_port_id);
+
+    /** Function called by the port when the crossbar is receiving a
+        functional warmup downgrade from below.*/
+    void recvWarmDowngrade(Addr addr, bool is_secure,
+                           PortID mem_side_port_id);
+
+    /** Function called by the port when the crossbar is asked whether
+        a block is cached above it during functional warmup.*/
+    bool recvWarmIsCached(Addr addr, bool is_secure,
+                          PortID mem_side_port_id);
+
     /**
      * Forward a functional packet to our snoopers, potentially
      * excluding one of the connected coherent requestors to avoid
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_DIRTY_BITMAP_HH__
+#define __MEM_DIRTY_BITMAP_HH__
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+
+#include "base/bitfield.hh"
+#include "base/intmath.hh"
+
+namespace gem5
+{
+
+namespace memory
+{
+
+/**
+ * One bit per page of a backing store, set when the page is written.
+ *
+ * Memories which are accessed by several event queues may mark pages
+ * concurrently, so the bits are updated atomically. Marking a page
+ * which is already dirty only costs a load.
+ */
+class DirtyBitmap
+{
+  private:
+    const unsigned pageShift;
+    const uint64_t _numPages;
+    const uint64_t numWords;
+    std::unique_ptr<std::atomic<uint64_t>[]> words;
+
+  public:
+    /**
+     * @param size Size of the backing store in bytes.
+     * @param page_size Tracking granularity, a power of two.
+     */
+    DirtyBitmap(uint64_t size, uint64_t page_size)
+        : pageShift(floorLog2(page_size)),
+          _numPages(divCeil(size, page_size)),
+          numWords(divCeil(_numPages, (uint64_t)64)),
+          words(new std::atomic<uint64_t>[numWords])
+    {
+        assert(isPowerOf2(page_size));
+        clear();
+    }
+
+    uint64_t numPages() const { return _numPages; }
+    uint64_t pageSize() const { return 1ULL << pageShift; }
+
+    /** Mark the pages overlapping a range of the backing store. */
+    void
+    mark(uint64_t offset, uint64_t size)
+    {
+        if (!size)
+            return;
+        const uint64_t last = (offset + size - 1) >> pageShift;
+        for (uint64_t page = offset >> pageShift; page <= last; ++page) {
+            std::atomic<uint64_t> &word = words[page / 64];
+            const uint64_t bit = 1ULL << (page % 64);
+            if (!(word.load(std::memory_order_relaxed) & bit))
+                word.fetch_or(bit, std::memory_order_relaxed);
+        }
+    }
+
+    void markAll() { markPages(0, _numPages - 1); }
+
+    /** Mark every page in [first, last]. */
+    void
+    markPages(uint64_t first, uint64_t last)
+    {
+        for (uint64_t w = first / 64; w <= last / 64; ++w) {
+            const unsigned lo = w == first / 64 ? first % 64 : 0;
+            const unsigned hi = w == last / 64 ? last % 64 : 63;
+            words[w].fetch_or(mask(hi, lo), std::memory_order_relaxed);
+        }
+    }
+
+    bool
+    dirty(uint64_t page) const
+    {
+        return words[page / 64].load(std::memory_order_relaxed) &
+            (1ULL << (page % 64));
+    }
+
+    /** Check whether any page in [first, last] is dirty. */
+    bool
+    anyDirty(uint64_t first, uint64_t last) const
+    {
+        for (uint64_t w = first / 64; w <= last / 64; ++w) {
+            const unsigned lo = w == first / 64 ? first % 64 : 0;
+            const unsigned hi = w == last / 64 ? last % 64 : 63;
+            if (words[w].load(std::memory_order_relaxed) & mask(hi, lo))
+                return true;
+        }
+        return false;
+    }
+
+    /** Number of dirty pages. */
+    uint64_t
+    count() const
+    {
+        uint64_t total = 0;
+        for (uint64_t w = 0; w < numWords; ++w)
+            total += popCount(words[w].load(std::memory_order_relaxed));
+        return total;
+    }
+
+    void
+    clear()
+    {
+        for (uint64_t w = 0; w < numWords; ++w)
+            words[w].store(0, std::memory_order_relaxed);
+    }
+};
+
+} // namespace memory
+} // namespace gem5
+
+#endif // __MEM_DIRTY_BITMAP_HH__
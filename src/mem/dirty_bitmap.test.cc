@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include "mem/dirty_bitmap.hh"
+
+using namespace gem5;
+using namespace gem5::memory;
+
+TEST(DirtyBitmapTest, Empty)
+{
+    DirtyBitmap bitmap(1 << 20, 4096);
+    EXPECT_EQ(bitmap.numPages(), 256);
+    EXPECT_EQ(bitmap.pageSize(), 4096);
+    EXPECT_EQ(bitmap.count(), 0);
+    EXPECT_FALSE(bitmap.anyDirty(0, 255));
+}
+
+/** Accesses mark every page they overlap. */
+TEST(DirtyBitmapTest, Mark)
+{
+    DirtyBitmap bitmap(1 << 20, 4096);
+    bitmap.mark(4095, 2);
+    bitmap.mark(10 * 4096, 64);
+    bitmap.mark(20 * 4096, 0);
+
+    EXPECT_EQ(bitmap.count(), 3);
+    EXPECT_TRUE(bitmap.dirty(0));
+    EXPECT_TRUE(bitmap.dirty(1));
+    EXPECT_TRUE(bitmap.dirty(10));
+    EXPECT_FALSE(bitmap.dirty(20));
+    EXPECT_FALSE(bitmap.anyDirty(2, 9));
+    EXPECT_TRUE(bitmap.anyDirty(2, 10));
+
+    bitmap.clear();
+    EXPECT_EQ(bitmap.count(), 0);
+}
+
+/** Ranges of pages spanning several words. */
+TEST(DirtyBitmapTest, MarkPages)
+{
+    DirtyBitmap bitmap(300 * 4096 + 1, 4096);
+    EXPECT_EQ(bitmap.numPages(), 301);
+
+    bitmap.markPages(60, 200);
+    EXPECT_EQ(bitmap.count(), 141);
+    EXPECT_FALSE(bitmap.dirty(59));
+    EXPECT_TRUE(bitmap.dirty(60));
+    EXPECT_TRUE(bitmap.dirty(200));
+    EXPECT_FALSE(bitmap.dirty(201));
+    EXPECT_FALSE(bitmap.anyDirty(0, 59));
+    EXPECT_FALSE(bitmap.anyDirty(201, 300));
+
+    bitmap.markAll();
+    EXPECT_EQ(bitmap.count(), 301);
+}
+
+/** Concurrent marks are not lost. */
+TEST(DirtyBitmapTest, Concurrent)
+{
+    DirtyBitmap bitmap(4096 * 4096, 4096);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&bitmap, t]() {
+            for (uint64_t page = t; page < 4096; page += 4)
+                bitmap.mark(page * 4096, 8);
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+
+    EXPECT_EQ(bitmap.count(), 4096);
+}
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/multi_config_calc.hh"
+
+#include <algorithm>
+#include <cassert>
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace
+{
+
+/** Scramble set indices so that sampling does not alias with strides */
+uint64_t
+mixBits(uint64_t x)
+{
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+} // anonymous namespace
+
+std::string
+MultiConfigCalc::Config::name() const
+{
+    return std::string(policy == Policy::LRU ? "lru_" : "plru_") +
+        std::to_string(sets) + "x" + std::to_string(ways);
+}
+
+MultiConfigCalc::MultiConfigCalc(const std::vector<unsigned> &sets,
+                                 const std::vector<unsigned> &ways,
+                                 bool lru, bool plru,
+                                 unsigned sample_period)
+    : lruDepth(0), minSetMask(0), _accesses(0)
+{
+    fatal_if(sets.empty() || ways.empty(),
+             "At least one number of sets and of ways is needed\n");
+    for (const auto s : sets)
+        fatal_if(!isPowerOf2(s), "The number of sets (%d) must be a power "
+                 "of two\n", s);
+    for (const auto w : ways)
+        fatal_if(w == 0, "Caches need at least one way\n");
+
+    if (lru) {
+        lruDepth = *std::max_element(ways.begin(), ways.end());
+        for (const auto s : sets) {
+            lruStacks.push_back({s - 1,
+                                 std::vector<Addr>(size_t(s) * lruDepth, 0),
+                                 std::vector<uint64_t>(lruDepth, 0)});
+            for (const auto w : ways) {
+                _configs.push_back({s, w, Policy::LRU});
+                lruStackOf.push_back(lruStacks.size() - 1);
+            }
+        }
+    }
+
+    if (plru) {
+        for (const auto s : sets) {
+            for (const auto w : ways) {
+                fatal_if(!isPowerOf2(w) || w > 64, "Tree PLRU needs a "
+                         "power of two number of ways up to 64, not %d\n", w);
+                plruCaches.push_back({s - 1, w,
+                                      std::vector<Addr>(size_t(s) * w, 0),
+                                      std::vector<uint64_t>(s, 0), 0});
+                _configs.push_back({s, w, Policy::PLRU});
+            }
+        }
+    }
+
+    const unsigned min_sets = *std::min_element(sets.begin(), sets.end());
+    minSetMask = min_sets - 1;
+    sampledSets.resize(min_sets);
+    for (unsigned i = 0; i < min_sets; i++)
+        sampledSets[i] = sample_period <= 1 || mixBits(i) % sample_period == 0;
+    fatal_if(std::none_of(sampledSets.begin(), sampledSets.end(),
+                          [](bool sampled) { return sampled; }),
+             "None of the %d sets is sampled with a period of %d\n",
+             min_sets, sample_period);
+}
+
+bool
+MultiConfigCalc::access(Addr blk_num)
+{
+    if (!sampledSets[blk_num & minSetMask])
+        return false;
+
+    _accesses++;
+    for (auto &stacks : lruStacks)
+        accessLRU(stacks, blk_num);
+    for (auto &cache : plruCaches)
+        accessPLRU(cache, blk_num);
+
+    return true;
+}
+
+void
+MultiConfigCalc::accessLRU(LRUStacks &stacks, Addr blk_num)
+{
+    Addr *set = &stacks.tags[size_t(blk_num & stacks.setMask) * lruDepth];
+    const Addr tag = blk_num + 1;
+
+    // Sets fill from the front, so the first invalid entry ends the
+    // search as well
+    unsigned pos = 0;
+    while (pos < lruDepth && set[pos] != tag && set[pos] != 0)
+        pos++;
+
+    if (pos < lruDepth && set[pos] == tag) {
+        stacks.hits[pos]++;
+    } else if (pos == lruDepth) {
+        // Deeper than any of the caches, drop the bottom of the stack
+        pos = lruDepth - 1;
+    }
+
+    std::move_backward(set, set + pos, set + pos + 1);
+    set[0] = tag;
+}
+
+void
+MultiConfigCalc::accessPLRU(PLRUCache &cache, Addr blk_num)
+{
+    const unsigned set_idx = blk_num & cache.setMask;
+    Addr *set = &cache.tags[size_t(set_idx) * cache.ways];
+    uint64_t &tree = cache.trees[set_idx];
+    const Addr tag = blk_num + 1;
+
+    unsigned way = std::find(set, set + cache.ways, tag) - set;
+    if (way == cache.ways) {
+        cache.misses++;
+
+        // Fill invalid ways first, then follow the tree to the victim
+        way = std::find(set, set + cache.ways, 0) - set;
+        if (way == cache.ways) {
+            unsigned node = 1;
+            while (node < cache.ways)
+                node = 2 * node + ((tree >> (node - 1)) & 1);
+            way = node - cache.ways;
+        }
+        set[way] = tag;
+    }
+
+    touchPLRU(tree, cache.ways, way);
+}
+
+void
+MultiConfigCalc::touchPLRU(uint64_t &tree, unsigned ways, unsigned way)
+{
+    // A set bit makes the victim search go right
+    unsigned node = 1;
+    for (unsigned level = floorLog2(ways); level > 0; level--) {
+        const unsigned right = (way >> (level - 1)) & 1;
+        const uint64_t bit = uint64_t(1) << (node - 1);
+        tree = right ? tree & ~bit : tree | bit;
+        node = 2 * node + right;
+    }
+}
+
+uint64_t
+MultiConfigCalc::misses(size_t config) const
+{
+    assert(config < _configs.size());
+
+    if (config < lruStackOf.size()) {
+        const LRUStacks &stacks = lruStacks[lruStackOf[config]];
+        const unsigned ways = _configs[config].ways;
+        uint64_t hits = 0;
+        for (unsigned d = 0; d < ways; d++)
+            hits += stacks.hits[d];
+        return _accesses - hits;
+    }
+
+    return plruCaches[config - lruStackOf.size()].misses;
+}
+
+double
+MultiConfigCalc::sampleRate() const
+{
+    return double(std::count(sampledSets.begin(), sampledSets.end(), true)) /
+        sampledSets.size();
+}
+
+void
+MultiConfigCalc::resetStats()
+{
+    _accesses = 0;
+    for (auto &stacks : lruStacks)
+        std::fill(stacks.hits.begin(), stacks.hits.end(), 0);
+    for (auto &cache : plruCaches)
+        cache.misses = 0;
+}
+
+} // namespace gem5
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_MULTI_CONFIG_CALC_HH__
+#define __MEM_MULTI_CONFIG_CALC_HH__
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "base/types.hh"
+
+namespace gem5
+{
+
+/**
+ * The multi-configuration calculator evaluates a grid of cache
+ * organizations in a single pass over a stream of block addresses,
+ * reporting the number of misses each of them would have had.
+ *
+ * LRU caches obey the inclusion property: for a given number of sets,
+ * a block hits in a cache with W ways iff its per-set stack distance
+ * is smaller than W. A single LRU stack per set count, truncated at the
+ * largest associativity of the grid, hence covers all associativities
+ * at once; a histogram of stack distances gives the misses of each.
+ * Tree pseudo-LRU has no inclusion property, so every (sets, ways)
+ * pair is simulated on its own, which only costs a tag compare per way
+ * and a tree walk per access.
+ *
+ * To speed up large grids, accesses may be sampled by set: a block is
+ * only simulated if its set in the configuration with the fewest sets
+ * is selected by a hash. Since the number of sets of every
+ * configuration is a power of two multiple of the smallest one, the
+ * same whole sets are sampled in every configuration, so the sampled
+ * miss ratios are unbiased estimates of the full ones.
+ */
+class MultiConfigCalc
+{
+  public:
+    enum class Policy
+    {
+        LRU,
+        PLRU,
+    };
+
+    /** A cache organization in the grid. */
+    struct Config
+    {
+        unsigned sets;
+        unsigned ways;
+        Policy policy;
+
+        /** A short name, e.g. "lru_1024x8". */
+        std::string name() const;
+    };
+
+    /**
+     * @param sets Numbers of sets to evaluate, powers of two.
+     * @param ways Associativities to evaluate. PLRU needs powers of two
+     *             no larger than 64.
+     * @param lru Whether to evaluate LRU caches.
+     * @param plru Whether to evaluate tree pseudo-LRU caches.
+     * @param sample_period Simulate about one set out of this many.
+     */
+    MultiConfigCalc(const std::vector<unsigned> &sets,
+                    const std::vector<unsigned> &ways, bool lru, bool plru,
+                    unsigned sample_period = 1);
+
+    /**
+     * Observe an access.
+     *
+     * @param blk_num Block number, i.e., the address divided by the
+     *                block size.
+     * @return True if the access was sampled.
+     */
+    bool access(Addr blk_num);
+
+    /** The evaluated configurations, LRU ones first. */
+    const std::vector<Config> &configs() const { return _configs; }
+
+    /** Number of sampled accesses since the last reset. */
+    uint64_t accesses() const { return _accesses; }
+
+    /** Number of misses of a configuration since the last reset. */
+    uint64_t misses(size_t config) const;
+
+    /** Fraction of the sets that are sampled. */
+    double sampleRate() const;
+
+    /** Clear the counters, keeping the cache contents. */
+    void resetStats();
+
+  private:
+    /** One LRU stack per set, truncated at the largest associativity */
+    struct LRUStacks
+    {
+        unsigned setMask;
+        /** Tags of each set, most recently used first; 0 is invalid */
+        std::vector<Addr> tags;
+        /** Number of hits at each stack distance */
+        std::vector<uint64_t> hits;
+    };
+
+    /** A tree pseudo-LRU cache */
+    struct PLRUCache
+    {
+        unsigned setMask;
+        unsigned ways;
+        /** Tags of each set, 0 is invalid */
+        std::vector<Addr> tags;
+        /** Tree bits of each set, node n at bit n - 1 */
+        std::vector<uint64_t> trees;
+        uint64_t misses;
+    };
+
+    void accessLRU(LRUStacks &stacks, Addr blk_num);
+    void accessPLRU(PLRUCache &cache, Addr blk_num);
+
+    /** Point the tree of a set away from a way */
+    static void touchPLRU(uint64_t &tree, unsigned ways, unsigned way);
+
+    std::vector<Config> _configs;
+
+    /** Index of the LRU stacks each LRU configuration reads */
+    std::vector<size_t> lruStackOf;
+
+    std::vector<LRUStacks> lruStacks;
+    std::vector<PLRUCache> plruCaches;
+
+    /** Largest LRU associativity, i.e., depth of the stacks */
+    unsigned lruDepth;
+
+    /** Sampled sets of the configuration with the fewest sets */
+    std::vector<bool> sampledSets;
+    unsigned minSetMask;
+
+    uint64_t _accesses;
+};
+
+} // namespace gem5
+
+#endif //__MEM_MULTI_CONFIG_CALC_HH__
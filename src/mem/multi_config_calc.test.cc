@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <list>
+#include <random>
+
+#include "mem/multi_config_calc.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/** Straightforward set-associative LRU cache to check against */
+class RefLRU
+{
+  public:
+    RefLRU(unsigned sets, unsigned ways) : sets(sets), ways(ways),
+        lists(sets)
+    {}
+
+    bool
+    access(Addr blk_num)
+    {
+        auto &list = lists[blk_num % sets];
+        for (auto it = list.begin(); it != list.end(); ++it) {
+            if (*it == blk_num) {
+                list.erase(it);
+                list.push_front(blk_num);
+                return true;
+            }
+        }
+        list.push_front(blk_num);
+        if (list.size() > ways)
+            list.pop_back();
+        return false;
+    }
+
+  private:
+    unsigned sets;
+    unsigned ways;
+    std::vector<std::list<Addr>> lists;
+};
+
+std::vector<Addr>
+randomTrace(size_t length, Addr footprint, unsigned seed)
+{
+    std::mt19937_64 gen(seed);
+    std::uniform_int_distribution<Addr> dist(0, footprint - 1);
+    std::vector<Addr> trace(length);
+    for (auto &blk : trace)
+        blk = dist(gen);
+    return trace;
+}
+
+} // anonymous namespace
+
+/** One LRU pass must match simulating each configuration on its own */
+TEST(MultiConfigCalcTest, LRUMatchesReference)
+{
+    const std::vector<unsigned> sets = {1, 4, 16};
+    const std::vector<unsigned> ways = {1, 2, 3, 8, 16};
+    MultiConfigCalc calc(sets, ways, true, false);
+
+    const auto trace = randomTrace(20000, 512, 1);
+    for (const auto blk : trace)
+        ASSERT_TRUE(calc.access(blk));
+    EXPECT_EQ(calc.accesses(), trace.size());
+
+    ASSERT_EQ(calc.configs().size(), sets.size() * ways.size());
+    for (size_t i = 0; i < calc.configs().size(); i++) {
+        const auto &config = calc.configs()[i];
+        RefLRU ref(config.sets, config.ways);
+        uint64_t misses = 0;
+        for (const auto blk : trace)
+            misses += !ref.access(blk);
+        EXPECT_EQ(calc.misses(i), misses) << config.name();
+    }
+}
+
+/** A single way, or a fully associative pair of ways, is exact LRU */
+TEST(MultiConfigCalcTest, PLRUSmallCases)
+{
+    MultiConfigCalc calc({1, 8}, {1, 2}, false, true);
+    const auto trace = randomTrace(5000, 64, 2);
+    for (const auto blk : trace)
+        calc.access(blk);
+
+    for (size_t i = 0; i < calc.configs().size(); i++) {
+        const auto &config = calc.configs()[i];
+        EXPECT_EQ(config.policy, MultiConfigCalc::Policy::PLRU);
+        RefLRU ref(config.sets, config.ways);
+        uint64_t misses = 0;
+        for (const auto blk : trace)
+            misses += !ref.access(blk);
+        EXPECT_EQ(calc.misses(i), misses) << config.name();
+    }
+}
+
+/** Tree PLRU evicts the block the tree points at, not the LRU one */
+TEST(MultiConfigCalcTest, PLRUVictim)
+{
+    MultiConfigCalc calc({1}, {4}, false, true);
+
+    // Fill ways 0-3, then touch way 0 again. The tree now points to
+    // the right half, at way 2, even though way 1 is the LRU block.
+    for (Addr blk : {10, 11, 12, 13, 10})
+        calc.access(blk);
+    EXPECT_EQ(calc.misses(0), 4U);
+
+    calc.access(14);    // evicts 12
+    calc.access(11);    // hit
+    EXPECT_EQ(calc.misses(0), 5U);
+    calc.access(12);    // miss
+    EXPECT_EQ(calc.misses(0), 6U);
+}
+
+/** Sampled sets are whole sets in every configuration */
+TEST(MultiConfigCalcTest, Sampling)
+{
+    MultiConfigCalc calc({16, 64}, {4}, true, false, 4);
+    EXPECT_GT(calc.sampleRate(), 0.0);
+    EXPECT_LT(calc.sampleRate(), 1.0);
+
+    const auto trace = randomTrace(10000, 4096, 3);
+    uint64_t sampled = 0;
+    for (const auto blk : trace)
+        sampled += calc.access(blk);
+    EXPECT_EQ(calc.accesses(), sampled);
+
+    // Blocks that differ only above the smallest set index bits share
+    // the sampling decision
+    for (Addr blk = 0; blk < 16; blk++) {
+        MultiConfigCalc probe({16, 64}, {4}, true, false, 4);
+        EXPECT_EQ(probe.access(blk), probe.access(blk + 16 * 7));
+    }
+
+    calc.resetStats();
+    EXPECT_EQ(calc.accesses(), 0U);
+    EXPECT_EQ(calc.misses(0), 0U);
+}
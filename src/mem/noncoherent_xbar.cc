@@ -314,4 +314,28 @@ NoncoherentXBar::recvFunctional(PacketPtr pkt, PortID cpu_side_port_id)
     memSidePorts[dest_id]->sendFunctional(pkt);
 }
 
+void
+NoncoherentXBar::recvWarmAccess(Addr addr, bool is_secure,
+                                bool needs_writable)
+{
+    PortID dest_id = findPort(RangeSize(addr, 1));
+    memSidePorts[dest_id]->sendWarmAccess(addr, is_secure, needs_writable);
+}
+
+void
+NoncoherentXBar::recvWarmEvict(Addr addr, bool is_secure, bool is_dirty,
+                               bool is_cached)
+{
+    PortID dest_id = findPort(RangeSize(addr, 1));
+    memSidePorts[dest_id]->sendWarmEvict(addr, is_secure, is_dirty,
+                                         is_cached);
+}
+
+void
+NoncoherentXBar::recvWarmHold(Addr addr, bool is_secure)
+{
+    PortID dest_id = findPort(RangeSize(addr, 1));
+    memSidePorts[dest_id]->sendWarmHold(addr, is_secure);
+}
+
 } // namespace gem5
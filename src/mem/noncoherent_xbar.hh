@@ -126,6 +126,26 @@ class NoncoherentXBar : public BaseXBar
             xbar.recvFunctional(pkt, id);
         }
 
+        void
+        recvWarmAccess(Addr addr, bool is_secure,
+                       bool needs_writable) override
+        {
+            xbar.recvWarmAccess(addr, is_secure, needs_writable);
+        }
+
+        void
+        recvWarmEvict(Addr addr, bool is_secure, bool is_dirty,
+                      bool is_cached) override
+        {
+            xbar.recvWarmEvict(addr, is_secure, is_dirty, is_cached);
+        }
+
+        void
+        recvWarmHold(Addr addr, bool is_secure) override
+        {
+            xbar.recvWarmHold(addr, is_secure);
+        }
+
         AddrRangeList
         getAddrRanges() const override
         {
@@ -180,6 +200,12 @@ class NoncoherentXBar : public BaseXBar
                             MemBackdoorPtr *backdoor=nullptr);
     void recvFunctional(PacketPtr pkt, PortID cpu_side_port_id);
 
+    /** Forward functional warmup notifications downwards. */
+    void recvWarmAccess(Addr addr, bool is_secure, bool needs_writable);
+    void recvWarmEvict(Addr addr, bool is_secure, bool is_dirty,
+                       bool is_cached);
+    void recvWarmHold(Addr addr, bool is_secure);
+
   public:
 
     NoncoherentXBar(const NoncoherentXBarParams &p);
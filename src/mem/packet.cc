@@ -48,10 +48,14 @@
 #include "mem/packet.hh"
 
 #include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <iostream>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <typeinfo>
+#include <vector>
 
 #include "base/cprintf.hh"
 #include "base/logging.hh"
@@ -235,6 +239,86 @@ MemCmd::commandInfo[] =
     { {IsRequest}, InvalidCmd, "TlbiExtSync" },
 };
 
+namespace
+{
+
+/**
+ * Per-thread count of packet data buffers served by the inline
+ * storage of the packet. Like the caches of the object pools, it is
+ * only written by its own thread and summed up when stats are dumped.
+ */
+struct InlineDataCounter
+{
+    std::atomic<uint64_t> count{0};
+
+    static std::mutex &
+    mutex()
+    {
+        static std::mutex theMutex;
+        return theMutex;
+    }
+
+    static std::vector<InlineDataCounter *> &
+    live()
+    {
+        static std::vector<InlineDataCounter *> theCounters;
+        return theCounters;
+    }
+
+    static uint64_t retired;
+
+    InlineDataCounter()
+    {
+        std::lock_guard<std::mutex> lock(mutex());
+        live().push_back(this);
+    }
+
+    ~InlineDataCounter()
+    {
+        std::lock_guard<std::mutex> lock(mutex());
+        retired += count;
+        live().erase(std::find(live().begin(), live().end(), this));
+    }
+};
+
+uint64_t InlineDataCounter::retired = 0;
+
+thread_local InlineDataCounter inlineDataCounter;
+
+} // anonymous namespace
+
+ObjectPool &
+Packet::pool()
+{
+    static ObjectPool thePool(typeid(Packet).name(), sizeof(Packet));
+    return thePool;
+}
+
+ObjectPool::Cache &
+Packet::poolCache()
+{
+    static thread_local ObjectPool::Cache theCache(pool());
+    return theCache;
+}
+
+void
+Packet::countInlineData()
+{
+    auto &count = inlineDataCounter.count;
+    count.store(count.load(std::memory_order_relaxed) + 1,
+                std::memory_order_relaxed);
+}
+
+uint64_t
+Packet::inlineDataAllocations()
+{
+    std::lock_guard<std::mutex> lock(InlineDataCounter::mutex());
+    uint64_t total = InlineDataCounter::retired;
+    for (const auto *counter : InlineDataCounter::live())
+        total += counter->count.load(std::memory_order_relaxed);
+    return total;
+}
+
 AddrRange
 Packet::getAddrRange() const
 {
@@ -49,6 +49,7 @@
 
 #include <bitset>
 #include <cassert>
+#include <cstddef>
 #include <initializer_list>
 #include <list>
 
@@ -57,6 +58,7 @@
 #include "base/compiler.hh"
 #include "base/flags.hh"
 #include "base/logging.hh"
+#include "base/object_pool.hh"
 #include "base/printable.hh"
 #include "base/types.hh"
 #include "mem/htm.hh"
@@ -347,7 +349,8 @@ class Packet : public Printable
         /// when the packet is destroyed?
         STATIC_DATA            = 0x00001000,
         /// The data pointer points to a value that should be freed when
-        /// the packet is destroyed. The pointer is assumed to be pointing
+        /// the packet is destroyed. Unless it points to the inline
+        /// buffer of the packet, the pointer is assumed to be pointing
         /// to an array, and delete [] is consequently called
         DYNAMIC_DATA           = 0x00002000,
 
@@ -373,6 +376,9 @@ class Packet : public Printable
     /// A pointer to the original request.
     RequestPtr req;
 
+    /// Largest payload held in the packet itself rather than the heap.
+    static constexpr unsigned inlineDataSize = 64;
+
   private:
    /**
     * A pointer to the data being transferred. It can be different
@@ -383,6 +389,19 @@ class Packet : public Printable
     */
     PacketDataPtr data;
 
+    /**
+     * Storage for the data of packets no larger than a typical cache
+     * line, which then needs no separate heap allocation. It is
+     * aligned like the arrays returned by new so that it may be
+     * accessed through getPtr() in the same way.
+     */
+    alignas(std::max_align_t) uint8_t inlineData[inlineDataSize];
+
+    static ObjectPool::Cache &poolCache();
+
+    /** Account for a data buffer served by inlineData. */
+    static void countInlineData();
+
     /// The address of the request.  This address could be virtual or
     /// physical, depending on the system configuration.
     Addr addr;
@@ -1036,6 +1055,34 @@ class Packet : public Printable
         deleteData();
     }
 
+    /**
+     * Packets are allocated from a per-thread pool rather than the
+     * system heap, as one is created for nearly every transaction.
+     */
+    static void *
+    operator new(size_t size)
+    {
+        if (size != sizeof(Packet)) {
+            pool().countFallback();
+            return ::operator new(size);
+        }
+        return pool().allocate(poolCache());
+    }
+
+    static void
+    operator delete(void *ptr, size_t size)
+    {
+        if (size != sizeof(Packet))
+            ::operator delete(ptr);
+        else
+            pool().deallocate(poolCache(), ptr);
+    }
+
+    static ObjectPool &pool();
+
+    /** Number of data buffers held in the packet rather than the heap. */
+    static uint64_t inlineDataAllocations();
+
     /**
      * Take a request packet and modify it in place to be suitable for
      * returning as a response to that request.
@@ -1327,7 +1374,7 @@ class Packet : public Printable
     void
     deleteData()
     {
-        if (flags.isSet(DYNAMIC_DATA))
+        if (flags.isSet(DYNAMIC_DATA) && data != inlineData)
             delete [] data;
 
         flags.clear(STATIC_DATA|DYNAMIC_DATA);
@@ -1343,7 +1390,12 @@ class Packet : public Printable
         if (hasData() || hasRespData()) {
             assert(flags.noneSet(STATIC_DATA|DYNAMIC_DATA));
             flags.set(DYNAMIC_DATA);
-            data = new uint8_t[getSize()];
+            if (getSize() <= inlineDataSize) {
+                data = inlineData;
+                countInlineData();
+            } else {
+                data = new uint8_t[getSize()];
+            }
         }
     }
 
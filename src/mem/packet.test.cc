@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+
+#include "mem/packet.hh"
+#include "mem/request.hh"
+#include "sim/cur_tick.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/** A packet of size bytes, reading from address 0. */
+PacketPtr
+makePacket(unsigned size)
+{
+    RequestPtr req = std::make_shared<Request>(0, size, 0, 0);
+    return new Packet(req, MemCmd::ReadReq);
+}
+
+/** Whether the packet's data is held by the packet itself. */
+bool
+dataIsInline(const Packet *pkt)
+{
+    const uint8_t *data = pkt->getConstPtr<uint8_t>();
+    const uint8_t *begin = reinterpret_cast<const uint8_t *>(pkt);
+    return data >= begin && data < begin + sizeof(Packet);
+}
+
+/** A type derived from Packet, which cannot be served by its pool. */
+class LargePacket : public Packet
+{
+  public:
+    using Packet::Packet;
+    uint64_t extra[4] = {};
+};
+
+/** Requests are stamped with the current tick. */
+class PacketTest : public testing::Test
+{
+  protected:
+    Tick tick = 0;
+
+    PacketTest() { Gem5Internal::_curTickPtr = &tick; }
+};
+
+} // anonymous namespace
+
+/** Packets are served by their pool, and recycled once deleted. */
+TEST_F(PacketTest, PoolAllocation)
+{
+    delete makePacket(8);
+    const uint64_t allocs = Packet::pool().allocations();
+    const uint64_t frees = Packet::pool().deallocations();
+    const uint64_t slabs = Packet::pool().slabs();
+
+    for (int i = 0; i < 1000; i++)
+        delete makePacket(8);
+
+    EXPECT_EQ(Packet::pool().allocations() - allocs, 1000U);
+    EXPECT_EQ(Packet::pool().deallocations() - frees, 1000U);
+    EXPECT_EQ(Packet::pool().slabs(), slabs);
+}
+
+/** Derived types bypass the pool, and go back to the heap. */
+TEST_F(PacketTest, DerivedTypeFallback)
+{
+    const uint64_t allocs = Packet::pool().allocations();
+    const uint64_t fallbacks = Packet::pool().fallbackAllocations();
+
+    RequestPtr req = std::make_shared<Request>(0, 8, 0, 0);
+    Packet *pkt = new LargePacket(req, MemCmd::ReadReq);
+    delete pkt;
+
+    EXPECT_EQ(Packet::pool().allocations(), allocs);
+    EXPECT_EQ(Packet::pool().fallbackAllocations() - fallbacks, 1U);
+}
+
+/** A payload up to a cache line is held in the packet itself. */
+TEST_F(PacketTest, InlineData)
+{
+    const uint64_t inline_allocs = Packet::inlineDataAllocations();
+
+    PacketPtr pkt = makePacket(Packet::inlineDataSize);
+    pkt->allocate();
+    EXPECT_TRUE(dataIsInline(pkt));
+    EXPECT_EQ(Packet::inlineDataAllocations() - inline_allocs, 1U);
+
+    // The data is dynamic, but must not be handed to delete[]
+    pkt->deleteData();
+
+    // Nor when the packet is deleted with its data
+    pkt->allocate();
+    EXPECT_TRUE(dataIsInline(pkt));
+    delete pkt;
+
+    EXPECT_EQ(Packet::inlineDataAllocations() - inline_allocs, 2U);
+}
+
+/** A larger payload is allocated on the heap. */
+TEST_F(PacketTest, HeapData)
+{
+    const uint64_t inline_allocs = Packet::inlineDataAllocations();
+
+    PacketPtr pkt = makePacket(Packet::inlineDataSize + 1);
+    pkt->allocate();
+    EXPECT_FALSE(dataIsInline(pkt));
+    EXPECT_EQ(Packet::inlineDataAllocations(), inline_allocs);
+    delete pkt;
+}
@@ -44,12 +44,16 @@
 #include <unistd.h>
 #include <zlib.h>
 
+#include <algorithm>
 #include <cerrno>
 #include <climits>
 #include <cstdio>
+#include <cstring>
 #include <iostream>
 #include <string>
+#include <utility>
 
+#include "base/chunked_image.hh"
 #include "base/intmath.hh"
 #include "base/trace.hh"
 #include "debug/AddrRanges.hh"
@@ -80,11 +84,27 @@ PhysicalMemory::PhysicalMemory(const std::string& _name,
                                const std::vector<AbstractMemory*>& _memories,
                                bool mmap_using_noreserve,
                                const std::string& shared_backstore,
-                               bool auto_unlink_shared_backstore) :
+                               bool auto_unlink_shared_backstore,
+                               bool chunked_checkpoint,
+                               int checkpoint_compression,
+                               unsigned checkpoint_threads,
+                               bool lazy_checkpoint_restore,
+                               bool incremental_checkpoint,
+                               unsigned max_checkpoint_deltas) :
     _name(_name), size(0), mmapUsingNoReserve(mmap_using_noreserve),
     sharedBackstore(shared_backstore), sharedBackstoreSize(0),
-    pageSize(sysconf(_SC_PAGE_SIZE))
+    pageSize(sysconf(_SC_PAGE_SIZE)),
+    chunkedCheckpoint(chunked_checkpoint),
+    checkpointCompression(checkpoint_compression),
+    checkpointThreads(checkpoint_threads),
+    lazyCheckpointRestore(lazy_checkpoint_restore),
+    incrementalCheckpoint(incremental_checkpoint),
+    maxCheckpointDeltas(max_checkpoint_deltas),
+    kvmWrites(false)
 {
+    fatal_if(incrementalCheckpoint && !chunkedCheckpoint,
+             "Incremental memory checkpoints require the chunked format\n");
+
     // Register cleanup callback if requested.
     if (auto_unlink_shared_backstore && !sharedBackstore.empty()) {
         registerExitCallback([=]() { shm_unlink(shared_backstore.c_str()); });
@@ -253,12 +273,20 @@ PhysicalMemory::createBackingStore(
     backingStore.emplace_back(range, pmem,
                               conf_table_reported, in_addr_map, kvm_map,
                               shm_fd, map_offset);
+    imageChains.emplace_back();
+    writtenChains.emplace_back();
+
+    if (incrementalCheckpoint)
+        dirtyPages.emplace_back(new DirtyBitmap(range.size(), pageSize));
 
     // point the memories to their backing store
     for (const auto& m : _memories) {
         DPRINTF(AddrRanges, "Mapping memory %s to backing store\n",
                 m->name());
         m->setBackingStore(pmem);
+
+        if (incrementalCheckpoint)
+            m->trackDirtyPages(dirtyPages.back().get());
     }
 }
 
@@ -359,25 +387,51 @@ PhysicalMemory::serialize(CheckpointOut &cp) const
     }
 }
 
+void
+PhysicalMemory::checkpointWritten()
+{
+    if (!incrementalCheckpoint)
+        return;
+
+    for (size_t i = 0; i < backingStore.size(); ++i) {
+        if (writtenChains[i].empty())
+            continue;
+        imageChains[i] = std::move(writtenChains[i]);
+        writtenChains[i].clear();
+        dirtyPages[i]->clear();
+    }
+}
+
 void
 PhysicalMemory::serializeStore(CheckpointOut &cp, unsigned int store_id,
                                AddrRange range, uint8_t* pmem) const
 {
     // we cannot use the address range for the name as the
     // memories that are not part of the address map can overlap
-    std::string filename =
-        name() + ".store" + std::to_string(store_id) + ".pmem";
+    std::string format = chunkedCheckpoint ? "chunked" : "gzip";
+    std::string filename = name() + ".store" + std::to_string(store_id) +
+        (chunkedCheckpoint ? ".cimg" : ".pmem");
     long range_size = range.size();
 
     DPRINTF(Checkpoint, "Serializing physical memory %s with size %d\n",
             filename, range_size);
 
     SERIALIZE_SCALAR(store_id);
+    SERIALIZE_SCALAR(format);
     SERIALIZE_SCALAR(filename);
     SERIALIZE_SCALAR(range_size);
 
     // write memory file
     std::string filepath = CheckpointIn::dir() + "/" + filename.c_str();
+
+    if (chunkedCheckpoint) {
+        std::vector<std::string> chain =
+            serializeChunkedStore(store_id, filename);
+        if (!chain.empty())
+            SERIALIZE_CONTAINER(chain);
+        return;
+    }
+
     gzFile compressed_mem = gzopen(filepath.c_str(), "wb");
     if (compressed_mem == NULL)
         fatal("Can't open physical memory checkpoint file '%s'\n",
@@ -406,6 +460,83 @@ PhysicalMemory::serializeStore(CheckpointOut &cp, unsigned int store_id,
 
 }
 
+std::vector<std::string>
+PhysicalMemory::serializeChunkedStore(unsigned int store_id,
+                                      const std::string &filename) const
+{
+    const BackingStoreEntry &store = backingStore[store_id];
+    const std::string dir = CheckpointIn::dir();
+    const std::string filepath = dir + "/" + filename;
+
+    ChunkedImage::WriteOptions options;
+    options.level = checkpointCompression;
+    options.threads = checkpointThreads;
+    options.alignment = pageSize;
+
+    std::vector<std::string> chain;
+    const std::vector<std::string> &prev = imageChains[store_id];
+
+    // guest writes to memories mapped by KVM are not tracked
+    const bool untracked = kvmWrites && store.kvmMap;
+
+    if (incrementalCheckpoint) {
+        // a chunk is stored as soon as one of its pages is dirty, so
+        // keep them small
+        options.chunkSize = std::max<long>(pageSize, 64 * 1024);
+
+        // hard link the images of the previous checkpoint into this
+        // one, unless the chain is long enough already
+        if (!untracked && !prev.empty() &&
+                prev.size() <= maxCheckpointDeltas) {
+            for (size_t i = 0; i < prev.size(); ++i) {
+                std::string link_name = csprintf("%s.store%d.chain%d.cimg",
+                                                 name(), store_id, i);
+                std::string path = dir + "/" + link_name;
+                if (prev[i] != path) {
+                    unlink(path.c_str());
+                    if (link(prev[i].c_str(), path.c_str())) {
+                        warn("Can't link '%s' into the checkpoint (%s), "
+                             "storing all of the memory\n", prev[i],
+                             strerror(errno));
+                        chain.clear();
+                        break;
+                    }
+                }
+                chain.push_back(link_name);
+            }
+        }
+
+        if (!chain.empty()) {
+            const DirtyBitmap &dirty = *dirtyPages[store_id];
+            const uint64_t pages = options.chunkSize / dirty.pageSize();
+            options.changed = [&dirty, pages](uint64_t chunk) {
+                const uint64_t first = chunk * pages;
+                const uint64_t last =
+                    std::min(first + pages, dirty.numPages()) - 1;
+                return dirty.anyDirty(first, last);
+            };
+            DPRINTF(Checkpoint, "Storing %d dirty pages of %s as a delta "
+                    "over %d images\n", dirty.count(), filename,
+                    chain.size());
+        }
+    }
+
+    // the file may be the image of a previous checkpoint which was just
+    // linked under another name, so never write over it in place
+    unlink(filepath.c_str());
+    ChunkedImage::write(filepath, store.pmem, store.range.size(), options);
+
+    if (incrementalCheckpoint) {
+        std::vector<std::string> &written = writtenChains[store_id];
+        written.clear();
+        for (const auto &name : chain)
+            written.push_back(dir + "/" + name);
+        written.push_back(filepath);
+    }
+
+    return chain;
+}
+
 void
 PhysicalMemory::unserialize(CheckpointIn &cp)
 {
@@ -428,7 +559,6 @@ PhysicalMemory::unserialize(CheckpointIn &cp)
         ScopedCheckpointSection sec(cp, csprintf("store%d", i));
         unserializeStore(cp);
     }
-
 }
 
 void
@@ -443,10 +573,9 @@ PhysicalMemory::unserializeStore(CheckpointIn &cp)
     UNSERIALIZE_SCALAR(filename);
     std::string filepath = cp.getCptDir() + "/" + filename;
 
-    // mmap memoryfile
-    gzFile compressed_mem = gzopen(filepath.c_str(), "rb");
-    if (compressed_mem == NULL)
-        fatal("Can't open physical memory checkpoint file '%s'", filename);
+    // checkpoints predating the chunked format only have gzip streams
+    std::string format = "gzip";
+    UNSERIALIZE_OPT_SCALAR(format);
 
     // we've already got the actual backing store mapped
     uint8_t* pmem = backingStore[store_id].pmem;
@@ -462,6 +591,28 @@ PhysicalMemory::unserializeStore(CheckpointIn &cp)
         fatal("Memory range size has changed! Saw %lld, expected %lld\n",
               range_size, range.size());
 
+    if (format == "chunked") {
+        // an incremental checkpoint lists the images it is a delta over
+        std::vector<std::string> chain;
+        if (cp.entryExists(Serializable::currentSection(), "chain"))
+            UNSERIALIZE_CONTAINER(chain);
+
+        std::vector<std::string> paths;
+        for (const auto &name : chain)
+            paths.push_back(cp.getCptDir() + "/" + name);
+        paths.push_back(filepath);
+
+        unserializeChunkedStore(store_id, paths);
+        return;
+    }
+
+    warn_if(lazyCheckpointRestore, "Not mapping '%s' lazily as it is a "
+            "gzip stream\n", filename);
+
+    gzFile compressed_mem = gzopen(filepath.c_str(), "rb");
+    if (compressed_mem == NULL)
+        fatal("Can't open physical memory checkpoint file '%s'", filename);
+
     uint64_t curr_size = 0;
     long* temp_page = new long[chunk_size];
     long* pmem_current;
@@ -491,5 +642,51 @@ PhysicalMemory::unserializeStore(CheckpointIn &cp)
               filename);
 }
 
+void
+PhysicalMemory::unserializeChunkedStore(unsigned int store_id,
+                                        const std::vector<std::string> &paths)
+{
+    const BackingStoreEntry &store = backingStore[store_id];
+
+    for (size_t i = 0; i < paths.size(); ++i) {
+        ChunkedImage image(paths[i]);
+        fatal_if(image.size() != store.range.size(),
+                 "Physical memory checkpoint file '%s' has size %lld, "
+                 "expected %lld\n", paths[i], image.size(),
+                 store.range.size());
+        fatal_if(i == 0 && image.isDelta(),
+                 "Physical memory checkpoint file '%s' is a delta without "
+                 "a base image\n", paths[i]);
+
+        if (i == 0 && lazyCheckpointRestore) {
+            if (store.shmFd != -1) {
+                warn("Not mapping '%s' lazily over a shared backing "
+                     "store\n", paths[i]);
+            } else if (!image.mappable(pageSize)) {
+                warn("Not mapping '%s' lazily as it is compressed, use "
+                     "checkpoint_mem_compression=0 when checkpointing\n",
+                     paths[i]);
+            } else {
+                uint64_t mappings = image.mapPrivate(store.pmem, pageSize);
+                DPRINTF(Checkpoint, "Mapped %s with %d mappings\n",
+                        paths[i], mappings);
+                continue;
+            }
+        }
+
+        // the backing store is freshly mapped, so zero chunks of the
+        // full image are skipped like the zero words of a gzip stream,
+        // while those of the deltas clear what is below
+        DPRINTF(Checkpoint, "Reading %s\n", paths[i]);
+        image.read(store.pmem, checkpointThreads, 0, UINT64_MAX, i > 0);
+    }
+
+    // the next incremental checkpoint is a delta over this one
+    if (incrementalCheckpoint) {
+        imageChains[store_id] = paths;
+        dirtyPages[store_id]->clear();
+    }
+}
+
 } // namespace memory
 } // namespace gem5
@@ -39,11 +39,13 @@
 #define __MEM_PHYSICAL_HH__
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "base/addr_range.hh"
 #include "base/addr_range_map.hh"
+#include "mem/dirty_bitmap.hh"
 #include "mem/packet.hh"
 #include "sim/serialize.hh"
 
@@ -158,6 +160,39 @@ class PhysicalMemory : public Serializable
 
     long pageSize;
 
+    // Checkpoint the backing store as chunked images rather than as
+    // gzip streams, using the given zlib level and number of threads
+    const bool chunkedCheckpoint;
+    const int checkpointCompression;
+    const unsigned checkpointThreads;
+
+    // Map uncompressed chunked images copy-on-write when restoring
+    const bool lazyCheckpointRestore;
+
+    // Only checkpoint the pages written since the last checkpoint, as
+    // a delta over the images of that checkpoint, up to a maximum
+    // number of deltas after which a full image is written again
+    const bool incrementalCheckpoint;
+    const unsigned maxCheckpointDeltas;
+
+    // Pages written in each backing store, when checkpointing
+    // incrementally
+    std::vector<std::unique_ptr<DirtyBitmap>> dirtyPages;
+
+    // Whether KVM guests may write to the stores mapped for them,
+    // which bypasses the dirty page tracking
+    bool kvmWrites;
+
+    // Paths of the images making up the last checkpoint (or restored
+    // checkpoint) of each backing store, starting with a full image
+    // and followed by deltas
+    std::vector<std::vector<std::string>> imageChains;
+
+    // Paths of the images of each backing store in the checkpoint
+    // being written, which become the image chains once it is
+    // complete
+    mutable std::vector<std::vector<std::string>> writtenChains;
+
     // The physical memory used to provide the memory in the simulated
     // system
     std::vector<BackingStoreEntry> backingStore;
@@ -191,7 +226,13 @@ class PhysicalMemory : public Serializable
                    const std::vector<AbstractMemory*>& _memories,
                    bool mmap_using_noreserve,
                    const std::string& shared_backstore,
-                   bool auto_unlink_shared_backstore);
+                   bool auto_unlink_shared_backstore,
+                   bool chunked_checkpoint=false,
+                   int checkpoint_compression=1,
+                   unsigned checkpoint_threads=0,
+                   bool lazy_checkpoint_restore=false,
+                   bool incremental_checkpoint=false,
+                   unsigned max_checkpoint_deltas=0);
 
     /**
      * Unmap all the backing store we have used.
@@ -274,6 +315,20 @@ class PhysicalMemory : public Serializable
      */
     void serialize(CheckpointOut &cp) const override;
 
+    /**
+     * Notify the memory that the checkpoint it was serialized to is
+     * complete. The next incremental checkpoint is then a delta over
+     * the images just written.
+     */
+    void checkpointWritten();
+
+    /**
+     * Notify the memory that KVM guests may write to the backing
+     * stores mapped for them. These writes cannot be tracked, so
+     * such stores are always checkpointed in full.
+     */
+    void setKvmWrites() { kvmWrites = true; }
+
     /**
      * Serialize a specific store.
      *
@@ -296,6 +351,26 @@ class PhysicalMemory : public Serializable
      */
     void unserializeStore(CheckpointIn &cp);
 
+  private:
+
+    /**
+     * Write a backing store as a chunked image, possibly as a delta
+     * over the images of the previous checkpoint.
+     *
+     * @param store_id Unique identifier of this backing store
+     * @param filename Name of the image in the checkpoint directory
+     * @return Names of the images the new image is a delta over
+     */
+    std::vector<std::string> serializeChunkedStore(
+        unsigned int store_id, const std::string &filename) const;
+
+    /**
+     * Restore a backing store from a chain of chunked images, a full
+     * image followed by deltas.
+     */
+    void unserializeChunkedStore(unsigned int store_id,
+                                 const std::vector<std::string> &paths);
+
 };
 
 } // namespace memory
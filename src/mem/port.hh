@@ -209,6 +209,43 @@ class RequestPort: public Port, public AtomicRequestProtocol,
      */
     virtual void sendRetryResp();
 
+  public:
+    /* The functional warmup protocol. */
+
+    /**
+     * Tell the responder that a cache above it looked up a block during
+     * functional warmup and missed, or needs the block writable. There
+     * is no packet and no data; only tags and replacement state are
+     * updated along the way.
+     *
+     * @param addr Block address.
+     * @param is_secure Whether the address is in the secure space.
+     * @param needs_writable Whether the requesting cache will own the block.
+     */
+    void sendWarmAccess(Addr addr, bool is_secure, bool needs_writable) const;
+
+    /**
+     * Tell the responder that a cache above it evicted a block during
+     * functional warmup.
+     *
+     * @param addr Block address.
+     * @param is_secure Whether the address is in the secure space.
+     * @param is_dirty Whether the evicted block was dirty.
+     * @param is_cached Whether a cache further up still holds the block.
+     */
+    void sendWarmEvict(Addr addr, bool is_secure, bool is_dirty,
+                       bool is_cached) const;
+
+    /**
+     * Tell the responder that a cache above it holds a block, e.g.
+     * after restoring it from a checkpoint. Caches below pass this on
+     * without looking the block up, so only snoop filters are updated.
+     *
+     * @param addr Block address.
+     * @param is_secure Whether the address is in the secure space.
+     */
+    void sendWarmHold(Addr addr, bool is_secure) const;
+
   protected:
     /**
      * Called to receive an address range change from the peer response
@@ -219,6 +256,26 @@ class RequestPort: public Port, public AtomicRequestProtocol,
      */
     virtual void recvRangeChange() { }
 
+    /**
+     * Called to receive a functional warmup invalidation of a block from
+     * the peer response port. The default implementation ignores it, as
+     * only caches and interconnects hold warmup state.
+     */
+    virtual void recvWarmInvalidate(Addr addr, bool is_secure) { }
+
+    /**
+     * Called to receive a functional warmup downgrade of a block from
+     * the peer response port, as another cache reads the block. The
+     * default implementation ignores it.
+     */
+    virtual void recvWarmDowngrade(Addr addr, bool is_secure) { }
+
+    /**
+     * Called to ask whether anything on the requesting side of this
+     * port holds a block during functional warmup.
+     */
+    virtual bool recvWarmIsCached(Addr addr, bool is_secure) { return false; }
+
     /**
      * Default implementations.
      */
@@ -295,6 +352,44 @@ class ResponsePort : public Port, public AtomicResponseProtocol,
      */
     void sendRangeChange() const { _requestPort->recvRangeChange(); }
 
+    /**
+     * Invalidate a block in the caches above during functional warmup.
+     *
+     * @param addr Block address.
+     * @param is_secure Whether the address is in the secure space.
+     */
+    void
+    sendWarmInvalidate(Addr addr, bool is_secure) const
+    {
+        _requestPort->recvWarmInvalidate(addr, is_secure);
+    }
+
+    /**
+     * Make the copies of a block in the caches above non-writable during
+     * functional warmup, as a snooped read would.
+     *
+     * @param addr Block address.
+     * @param is_secure Whether the address is in the secure space.
+     */
+    void
+    sendWarmDowngrade(Addr addr, bool is_secure) const
+    {
+        _requestPort->recvWarmDowngrade(addr, is_secure);
+    }
+
+    /**
+     * Check whether a cache above holds a block during functional warmup.
+     *
+     * @param addr Block address.
+     * @param is_secure Whether the address is in the secure space.
+     * @return True if the block is cached above this port.
+     */
+    bool
+    sendWarmIsCached(Addr addr, bool is_secure) const
+    {
+        return _requestPort->recvWarmIsCached(addr, is_secure);
+    }
+
     /**
      * Get a list of the non-overlapping address ranges the owner is
      * responsible for. All response ports must override this function
@@ -434,6 +529,24 @@ class ResponsePort : public Port, public AtomicResponseProtocol,
      */
     void responderBind(RequestPort& request_port);
 
+    /**
+     * Called to receive a functional warmup access, eviction or hold
+     * notification from the peer request port. The default
+     * implementations ignore them, which is what memories and other
+     * non-caching responders need.
+     */
+    virtual void
+    recvWarmAccess(Addr addr, bool is_secure, bool needs_writable)
+    {
+    }
+
+    virtual void
+    recvWarmEvict(Addr addr, bool is_secure, bool is_dirty, bool is_cached)
+    {
+    }
+
+    virtual void recvWarmHold(Addr addr, bool is_secure) { }
+
     /**
      * Default implementations.
      */
@@ -491,6 +604,26 @@ RequestPort::sendFunctional(PacketPtr pkt) const
     }
 }
 
+inline void
+RequestPort::sendWarmAccess(Addr addr, bool is_secure,
+                            bool needs_writable) const
+{
+    _responsePort->recvWarmAccess(addr, is_secure, needs_writable);
+}
+
+inline void
+RequestPort::sendWarmEvict(Addr addr, bool is_secure, bool is_dirty,
+                           bool is_cached) const
+{
+    _responsePort->recvWarmEvict(addr, is_secure, is_dirty, is_cached);
+}
+
+inline void
+RequestPort::sendWarmHold(Addr addr, bool is_secure) const
+{
+    _responsePort->recvWarmHold(addr, is_secure);
+}
+
 inline bool
 RequestPort::sendTimingReq(PacketPtr pkt)
 {
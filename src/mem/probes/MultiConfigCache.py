@@ -0,0 +1,57 @@
+# Copyright (c) 2026 The ECE565-Project Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.params import *
+from m5.proxy import *
+from m5.objects.BaseMemProbe import BaseMemProbe
+
+class MultiConfigCache(BaseMemProbe):
+    type = 'MultiConfigCache'
+    cxx_header = "mem/probes/multi_config_cache.hh"
+    cxx_class = 'gem5::MultiConfigCache'
+
+    system = Param.System(Parent.any,
+                          "System to use when determining system cache "
+                          "line size")
+
+    line_size = Param.Unsigned(Parent.cache_line_size,
+                               "Cache line size in bytes (must be larger or "
+                               "equal to the system's line size)")
+
+    # The grid of organizations to evaluate, every number of sets with
+    # every associativity and replacement policy
+    sets = VectorParam.Unsigned([256, 512, 1024, 2048, 4096],
+                                "Numbers of sets (powers of two)")
+    ways = VectorParam.Unsigned([1, 2, 4, 8, 16], "Associativities")
+    lru = Param.Bool(True, "Evaluate LRU caches")
+    plru = Param.Bool(False, "Evaluate tree pseudo-LRU caches (power of "
+                      "two associativities up to 64)")
+
+    sample_period = Param.Unsigned(1, "Only simulate about one set out of "
+                                   "this many")
+
+    table_file = Param.String("", "File to write the table of results to "
+                              "at exit, <name>.txt if empty")
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/probes/cache_warmup.hh"
+
+#include "mem/cache/base.hh"
+#include "params/CacheWarmupProbe.hh"
+#include "sim/system.hh"
+
+namespace gem5
+{
+
+CacheWarmupProbe::CacheWarmupProbe(const CacheWarmupProbeParams &p)
+    : BaseMemProbe(p),
+      cache(p.cache),
+      system(p.system)
+{
+}
+
+void
+CacheWarmupProbe::handleRequest(const probing::PacketInfo &pi)
+{
+    // Caches that are not bypassed see the accesses themselves
+    if (!system->bypassCaches())
+        return;
+
+    if (!(pi.cmd.isRead() || pi.cmd.isWrite()) || pi.size == 0 ||
+        (pi.flags & Request::UNCACHEABLE)) {
+        return;
+    }
+
+    const Addr blk_size = cache->getBlockSize();
+    const bool is_secure = pi.flags & Request::SECURE;
+    const bool is_write = pi.cmd.isWrite();
+    const Addr end = pi.addr + pi.size;
+    for (Addr addr = pi.addr & ~(blk_size - 1); addr < end;
+         addr += blk_size) {
+        cache->warmAccess(addr, is_secure, is_write);
+    }
+}
+
+} // namespace gem5
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_PROBES_CACHE_WARMUP_HH__
+#define __MEM_PROBES_CACHE_WARMUP_HH__
+
+#include "mem/probes/base.hh"
+
+namespace gem5
+{
+
+struct CacheWarmupProbeParams;
+class BaseCache;
+class System;
+
+/**
+ * Probe that replays the accesses it observes as functional warmup
+ * accesses to a cache, and through it to the rest of the hierarchy.
+ *
+ * This is meant for fast-forwarding with the caches bypassed (i.e., in
+ * atomic_noncaching mode), with the probe listening to the requests of
+ * a CPU, e.g. through a CommMonitor between the CPU and its first level
+ * cache. Accesses are only replayed while the caches are bypassed, so
+ * the probe can stay attached after switching to a timing CPU.
+ */
+class CacheWarmupProbe : public BaseMemProbe
+{
+  public:
+    CacheWarmupProbe(const CacheWarmupProbeParams &params);
+
+  protected:
+    void handleRequest(const probing::PacketInfo &pkt_info) override;
+
+    /** Cache the observed accesses are replayed to */
+    BaseCache *cache;
+
+    /** System whose memory mode tells whether caches are bypassed */
+    System *system;
+};
+
+} // namespace gem5
+
+#endif //__MEM_PROBES_CACHE_WARMUP_HH__
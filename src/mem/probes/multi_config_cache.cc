@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/probes/multi_config_cache.hh"
+
+#include "base/intmath.hh"
+#include "base/output.hh"
+#include "params/MultiConfigCache.hh"
+#include "sim/core.hh"
+#include "sim/system.hh"
+
+namespace gem5
+{
+
+MultiConfigCache::MultiConfigCache(const MultiConfigCacheParams &p)
+    : BaseMemProbe(p),
+      lineSize(p.line_size),
+      tableFile(p.table_file.empty() ? name() + ".txt" : p.table_file),
+      calc(p.sets, p.ways, p.lru, p.plru, p.sample_period),
+      stats(this)
+{
+    fatal_if(p.system->cacheLineSize() > p.line_size,
+             "The multi-configuration cache must use a cache line size "
+             "that is larger or equal to the system's cache line size.");
+    fatal_if(!isPowerOf2(lineSize),
+             "The multi-configuration cache line size must be a power of "
+             "two.");
+    fatal_if(!p.lru && !p.plru,
+             "The multi-configuration cache needs at least one policy.");
+
+    registerExitCallback([this]() { writeTable(); });
+}
+
+MultiConfigCache::MultiConfigCacheStats::MultiConfigCacheStats(
+    MultiConfigCache *parent)
+    : statistics::Group(parent),
+      probe(*parent),
+      ADD_STAT(accesses, statistics::units::Count::get(),
+               "Number of sampled accesses"),
+      ADD_STAT(misses, statistics::units::Count::get(),
+               "Number of sampled misses of each organization"),
+      ADD_STAT(missRatio, statistics::units::Ratio::get(),
+               "Miss ratio of each organization", misses / accesses)
+{
+    const auto &configs = parent->calc.configs();
+
+    misses.init(configs.size());
+    for (size_t i = 0; i < configs.size(); i++) {
+        misses.subname(i, configs[i].name());
+        missRatio.subname(i, configs[i].name());
+    }
+
+    statistics::registerResetCallback(
+        [parent]() { parent->calc.resetStats(); });
+}
+
+void
+MultiConfigCache::MultiConfigCacheStats::preDumpStats()
+{
+    statistics::Group::preDumpStats();
+
+    // The calculator keeps the counts, so only copy them out on dumps
+    accesses = probe.calc.accesses();
+    for (size_t i = 0; i < probe.calc.configs().size(); i++)
+        misses[i] = probe.calc.misses(i);
+}
+
+void
+MultiConfigCache::handleRequest(const probing::PacketInfo &pkt_info)
+{
+    // only capturing read and write requests (which allocate in the
+    // cache)
+    if (!pkt_info.cmd.isRead() && !pkt_info.cmd.isWrite())
+        return;
+
+    calc.access(pkt_info.addr / lineSize);
+}
+
+void
+MultiConfigCache::writeTable() const
+{
+    OutputStream *os = simout.create(tableFile);
+    std::ostream &out = *os->stream();
+
+    ccprintf(out, "# %d sampled accesses, %.4f of the sets sampled\n",
+             calc.accesses(), calc.sampleRate());
+    ccprintf(out, "%-8s %8s %6s %12s %12s %10s\n", "policy", "sets", "ways",
+             "size", "misses", "miss_ratio");
+
+    const auto &configs = calc.configs();
+    for (size_t i = 0; i < configs.size(); i++) {
+        const auto &config = configs[i];
+        const uint64_t misses = calc.misses(i);
+        ccprintf(out, "%-8s %8d %6d %12d %12d %10.6f\n",
+                 config.policy == MultiConfigCalc::Policy::LRU ?
+                     "lru" : "plru",
+                 config.sets, config.ways,
+                 uint64_t(config.sets) * config.ways * lineSize, misses,
+                 calc.accesses() ? double(misses) / calc.accesses() : 0.0);
+    }
+
+    simout.close(os);
+}
+
+} // namespace gem5
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_PROBES_MULTI_CONFIG_CACHE_HH__
+#define __MEM_PROBES_MULTI_CONFIG_CACHE_HH__
+
+#include <string>
+
+#include "base/statistics.hh"
+#include "mem/multi_config_calc.hh"
+#include "mem/probes/base.hh"
+
+namespace gem5
+{
+
+struct MultiConfigCacheParams;
+
+/**
+ * Probe that evaluates a grid of cache organizations on the observed
+ * accesses in a single pass, using a MultiConfigCalc. The miss counts
+ * and ratios of all organizations are reported as statistics, and
+ * written as a table at exit.
+ */
+class MultiConfigCache : public BaseMemProbe
+{
+  public:
+    MultiConfigCache(const MultiConfigCacheParams &params);
+
+  protected:
+    void handleRequest(const probing::PacketInfo &pkt_info) override;
+
+    /** Write the table of results */
+    void writeTable() const;
+
+    // Cache line size to simulate
+    const unsigned lineSize;
+
+    // File the table of results is written to
+    const std::string tableFile;
+
+    MultiConfigCalc calc;
+
+    struct MultiConfigCacheStats : public statistics::Group
+    {
+        MultiConfigCacheStats(MultiConfigCache *parent);
+
+        void preDumpStats() override;
+
+        const MultiConfigCache &probe;
+
+        // Number of sampled accesses
+        statistics::Scalar accesses;
+
+        // Misses of each organization
+        statistics::Vector misses;
+
+        // Miss ratio of each organization
+        statistics::Formula missRatio;
+    } stats;
+};
+
+} // namespace gem5
+
+#endif //__MEM_PROBES_MULTI_CONFIG_CACHE_HH__
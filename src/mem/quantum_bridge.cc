@@ -0,0 +1,301 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Implementation of a bridge that connects a requestor and a responder
+ * running on different event queues.
+ */
+
+#include "mem/quantum_bridge.hh"
+
+#include <mutex>
+
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "debug/QuantumBridge.hh"
+#include "params/QuantumBridge.hh"
+
+namespace gem5
+{
+
+QuantumBridge::Channel::Channel(const std::string &name,
+                                QuantumBridge &_bridge,
+                                EventQueue *dst_queue,
+                                std::function<bool(PacketPtr)> send_fn)
+    : _name(name), bridge(_bridge), dstQueue(dst_queue),
+      sendFn(send_fn), waitingForRetry(false), inFlight(0)
+{
+}
+
+void
+QuantumBridge::Channel::push(PacketPtr pkt, Tick when)
+{
+    DPRINTF(QuantumBridge, "%s: push %s addr %#x due @%d\n", name(),
+            pkt->cmdString(), pkt->getAddr(), when);
+
+    ++inFlight;
+    {
+        std::lock_guard<UncontendedMutex> lock(mutex);
+        inbound.push_back({when, pkt});
+    }
+
+    // Every packet gets its own delivery event, taken from a pool. When
+    // the destination belongs to a different thread, schedule() goes
+    // through the asynchronous queue of the destination, which is
+    // merged at the end of the current quantum.
+    dstQueue->schedule(new DeliverEvent(*this), when);
+}
+
+void
+QuantumBridge::Channel::deliver()
+{
+    {
+        std::lock_guard<UncontendedMutex> lock(mutex);
+        // Keep the packets in arrival order. A packet which is due but
+        // queued behind one that is not will be delivered together
+        // with the packet in front of it.
+        while (!inbound.empty() && inbound.front().tick <= curTick()) {
+            outbound.push_back(inbound.front().pkt);
+            inbound.pop_front();
+        }
+    }
+
+    if (!waitingForRetry)
+        trySend();
+}
+
+void
+QuantumBridge::Channel::trySend()
+{
+    while (!outbound.empty()) {
+        PacketPtr pkt = outbound.front();
+        if (!sendFn(pkt)) {
+            DPRINTF(QuantumBridge, "%s: send of addr %#x refused\n",
+                    name(), pkt->getAddr());
+            waitingForRetry = true;
+            return;
+        }
+        outbound.pop_front();
+        --inFlight;
+    }
+
+    bridge.checkDrained();
+}
+
+void
+QuantumBridge::Channel::retry()
+{
+    assert(waitingForRetry);
+    waitingForRetry = false;
+    trySend();
+}
+
+bool
+QuantumBridge::Channel::empty() const
+{
+    return inFlight == 0;
+}
+
+bool
+QuantumBridge::Channel::trySatisfyFunctional(PacketPtr pkt) const
+{
+    for (auto pending : outbound) {
+        if (pkt->trySatisfyFunctional(pending))
+            return true;
+    }
+
+    std::lock_guard<UncontendedMutex> lock(mutex);
+    for (const auto &pending : inbound) {
+        if (pkt->trySatisfyFunctional(pending.pkt))
+            return true;
+    }
+
+    return false;
+}
+
+QuantumBridge::QuantumBridgeResponsePort::QuantumBridgeResponsePort(
+        const std::string &_name, QuantumBridge &_bridge)
+    : ResponsePort(_name, &_bridge), bridge(_bridge)
+{
+}
+
+QuantumBridge::QuantumBridgeRequestPort::QuantumBridgeRequestPort(
+        const std::string &_name, QuantumBridge &_bridge)
+    : RequestPort(_name, &_bridge), bridge(_bridge)
+{
+}
+
+QuantumBridge::QuantumBridge(const Params &p)
+    : SimObject(p),
+      cpuSidePort(p.name + ".cpu_side_port", *this),
+      memSidePort(p.name + ".mem_side_port", *this),
+      memSideQueue(getEventQueue(p.mem_side_eventq_index)),
+      delay(p.delay),
+      reqChannel(p.name + ".req", *this, memSideQueue,
+                 [this](PacketPtr pkt)
+                 { return memSidePort.sendTimingReq(pkt); }),
+      respChannel(p.name + ".resp", *this, eventQueue(),
+                  [this](PacketPtr pkt)
+                  { return cpuSidePort.sendTimingResp(pkt); }),
+      stats(this)
+{
+}
+
+Port &
+QuantumBridge::getPort(const std::string &if_name, PortID idx)
+{
+    if (if_name == "mem_side_port")
+        return memSidePort;
+    else if (if_name == "cpu_side_port")
+        return cpuSidePort;
+    else
+        return SimObject::getPort(if_name, idx);
+}
+
+void
+QuantumBridge::init()
+{
+    if (!cpuSidePort.isConnected() || !memSidePort.isConnected())
+        fatal("Both ports of a quantum bridge must be connected.\n");
+
+    fatal_if(memSideQueue != eventQueue() && delay < simQuantum,
+             "%s: delay (%d) must not be smaller than the simulation "
+             "quantum (%d).\n", name(), delay, simQuantum);
+
+    cpuSidePort.sendRangeChange();
+}
+
+Tick
+QuantumBridge::deliveryTick(PacketPtr pkt)
+{
+    // The packet only reaches us after the header delay, and the
+    // payload has to be received before it is handed over.
+    Tick when = curTick() + delay + pkt->headerDelay + pkt->payloadDelay;
+    pkt->headerDelay = pkt->payloadDelay = 0;
+    return when;
+}
+
+void
+QuantumBridge::checkDrained()
+{
+    std::lock_guard<UncontendedMutex> lock(drainMutex);
+    if (reqChannel.empty() && respChannel.empty())
+        signalDrainDone();
+}
+
+DrainState
+QuantumBridge::drain()
+{
+    return reqChannel.empty() && respChannel.empty() ?
+        DrainState::Drained : DrainState::Draining;
+}
+
+bool
+QuantumBridge::QuantumBridgeResponsePort::recvTimingReq(PacketPtr pkt)
+{
+    panic_if(pkt->cacheResponding(), "Should not see packets where cache "
+             "is responding");
+
+    ++bridge.stats.crossedReqs;
+    bridge.reqChannel.push(pkt, bridge.deliveryTick(pkt));
+    return true;
+}
+
+void
+QuantumBridge::QuantumBridgeResponsePort::recvRespRetry()
+{
+    bridge.respChannel.retry();
+}
+
+Tick
+QuantumBridge::QuantumBridgeResponsePort::recvAtomic(PacketPtr pkt)
+{
+    panic_if(pkt->cacheResponding(), "Should not see packets where cache "
+             "is responding");
+
+    EventQueue::ScopedMigration migrate(bridge.memSideQueue);
+    return bridge.delay + bridge.memSidePort.sendAtomic(pkt);
+}
+
+void
+QuantumBridge::QuantumBridgeResponsePort::recvFunctional(PacketPtr pkt)
+{
+    // Taking the memory-side queue makes sure the thread owning it is
+    // not processing any events while we look at the packets in
+    // flight.
+    EventQueue::ScopedMigration migrate(bridge.memSideQueue);
+
+    pkt->pushLabel(name());
+    if (bridge.respChannel.trySatisfyFunctional(pkt) ||
+        bridge.reqChannel.trySatisfyFunctional(pkt)) {
+        pkt->makeResponse();
+        return;
+    }
+    pkt->popLabel();
+
+    bridge.memSidePort.sendFunctional(pkt);
+}
+
+AddrRangeList
+QuantumBridge::QuantumBridgeResponsePort::getAddrRanges() const
+{
+    return bridge.memSidePort.getAddrRanges();
+}
+
+bool
+QuantumBridge::QuantumBridgeRequestPort::recvTimingResp(PacketPtr pkt)
+{
+    ++bridge.stats.crossedResps;
+    bridge.respChannel.push(pkt, bridge.deliveryTick(pkt));
+    return true;
+}
+
+void
+QuantumBridge::QuantumBridgeRequestPort::recvReqRetry()
+{
+    bridge.reqChannel.retry();
+}
+
+void
+QuantumBridge::QuantumBridgeRequestPort::recvRangeChange()
+{
+    bridge.cpuSidePort.sendRangeChange();
+}
+
+QuantumBridge::QuantumBridgeStats::QuantumBridgeStats(
+        statistics::Group *parent)
+    : statistics::Group(parent),
+      ADD_STAT(crossedReqs, statistics::units::Count::get(),
+               "Number of requests handed over to the memory side"),
+      ADD_STAT(crossedResps, statistics::units::Count::get(),
+               "Number of responses handed over to the CPU side")
+{
+}
+
+} // namespace gem5
@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Declaration of a bridge that connects a requestor and a responder
+ * running on different event queues.
+ */
+
+#ifndef __MEM_QUANTUM_BRIDGE_HH__
+#define __MEM_QUANTUM_BRIDGE_HH__
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <string>
+
+#include "base/statistics.hh"
+#include "base/types.hh"
+#include "base/uncontended_mutex.hh"
+#include "mem/port.hh"
+#include "params/QuantumBridge.hh"
+#include "sim/eventq.hh"
+#include "sim/pooled_event.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+/**
+ * A quantum bridge is used to split a memory system across event
+ * queues (and thus simulation threads). The response port belongs to
+ * the event queue of the bridge itself, the request port to the event
+ * queue selected by mem_side_eventq_index.
+ *
+ * Timing packets crossing the bridge are handed over to the thread
+ * owning the other side and delivered after a fixed delay. As long as
+ * the delay is no smaller than the simulation quantum, the delivery
+ * event is merged into the destination queue at a quantum boundary
+ * before it is due, which keeps the simulation deterministic. Atomic
+ * and functional accesses temporarily migrate to the memory-side
+ * queue instead.
+ *
+ * The bridge is deliberately not a ClockedObject since both of its
+ * sides run concurrently and the cached clock state of a clocked
+ * object is not thread safe.
+ *
+ * The bridge does not take part in coherence: it is not snooping, and
+ * it never forwards snoops. It is therefore only suitable for splits
+ * where the two sides do not share writable data, e.g. private cache
+ * clusters running independent processes.
+ */
+class QuantumBridge : public SimObject
+{
+  protected:
+
+    /**
+     * One direction of the bridge. Packets are pushed by the thread
+     * owning the source event queue and sent by the thread owning the
+     * destination event queue.
+     */
+    class Channel
+    {
+      private:
+
+        /** A packet along with the tick it is due at the destination. */
+        struct DeferredPacket
+        {
+            Tick tick;
+            PacketPtr pkt;
+        };
+
+        /** Event delivering the packets pushed to a channel. */
+        class DeliverEvent : public PooledEvent<DeliverEvent>
+        {
+          private:
+            Channel &channel;
+
+          public:
+            DeliverEvent(Channel &_channel)
+                : PooledEvent(Default_Pri, AutoDelete), channel(_channel)
+            {}
+
+            void process() override { channel.deliver(); }
+            const std::string name() const override { return channel.name(); }
+            const char *
+            description() const override
+            {
+                return "QuantumBridge delivery";
+            }
+        };
+
+        /** Name used for the delivery events. */
+        const std::string _name;
+
+        /** The bridge to which this channel belongs. */
+        QuantumBridge &bridge;
+
+        /** Event queue of the destination side. */
+        EventQueue *dstQueue;
+
+        /** Function used to send a packet at the destination side. */
+        std::function<bool(PacketPtr)> sendFn;
+
+        /** Protects the inbound list. */
+        mutable UncontendedMutex mutex;
+
+        /** Packets handed over by the source thread, in arrival order. */
+        std::deque<DeferredPacket> inbound;
+
+        /**
+         * Packets which are due but have not been accepted by the
+         * destination yet. Only touched by the destination thread.
+         */
+        std::deque<PacketPtr> outbound;
+
+        /** Set when the destination refused a packet. */
+        bool waitingForRetry;
+
+        /** Number of packets pushed but not yet sent. */
+        std::atomic<unsigned> inFlight;
+
+
+        /** Move due packets to the outbound list and try to send them. */
+        void deliver();
+
+        /** Send outbound packets until the destination refuses one. */
+        void trySend();
+
+      public:
+
+        Channel(const std::string &name, QuantumBridge &_bridge,
+                EventQueue *dst_queue,
+                std::function<bool(PacketPtr)> send_fn);
+
+        const std::string &name() const { return _name; }
+
+        /**
+         * Hand a packet over to the destination. Called by the thread
+         * owning the source event queue.
+         *
+         * @param pkt packet to send at the destination side
+         * @param when tick at which the packet is due
+         */
+        void push(PacketPtr pkt, Tick when);
+
+        /** The destination is ready to accept a packet again. */
+        void retry();
+
+        /** Check if no packets are in flight through this channel. */
+        bool empty() const;
+
+        /**
+         * Try to satisfy a functional access using the packets in
+         * flight. The caller must own both event queues.
+         */
+        bool trySatisfyFunctional(PacketPtr pkt) const;
+    };
+
+    class QuantumBridgeResponsePort : public ResponsePort
+    {
+      private:
+        QuantumBridge &bridge;
+
+      public:
+        QuantumBridgeResponsePort(const std::string &_name,
+                                  QuantumBridge &_bridge);
+
+      protected:
+        bool recvTimingReq(PacketPtr pkt) override;
+        void recvRespRetry() override;
+        Tick recvAtomic(PacketPtr pkt) override;
+        void recvFunctional(PacketPtr pkt) override;
+        AddrRangeList getAddrRanges() const override;
+    };
+
+    class QuantumBridgeRequestPort : public RequestPort
+    {
+      private:
+        QuantumBridge &bridge;
+
+      public:
+        QuantumBridgeRequestPort(const std::string &_name,
+                                 QuantumBridge &_bridge);
+
+      protected:
+        bool recvTimingResp(PacketPtr pkt) override;
+        void recvReqRetry() override;
+        void recvRangeChange() override;
+    };
+
+    /** Response port of the bridge. */
+    QuantumBridgeResponsePort cpuSidePort;
+
+    /** Request port of the bridge. */
+    QuantumBridgeRequestPort memSidePort;
+
+    /** Event queue of the objects on the memory side. */
+    EventQueue *memSideQueue;
+
+    /** Latency of the bridge. */
+    const Tick delay;
+
+    /** Requests travelling from the CPU side to the memory side. */
+    Channel reqChannel;
+
+    /** Responses travelling from the memory side to the CPU side. */
+    Channel respChannel;
+
+    /**
+     * Compute the tick a packet received now is due at the other side
+     * of the bridge.
+     */
+    Tick deliveryTick(PacketPtr pkt);
+
+    /** Signal that draining completed if no packets are in flight. */
+    void checkDrained();
+
+    /** Serialises drain completion between the two sides. */
+    UncontendedMutex drainMutex;
+
+    struct QuantumBridgeStats : public statistics::Group
+    {
+        QuantumBridgeStats(statistics::Group *parent);
+
+        /**
+         * Each counter is only updated by the thread owning the
+         * receiving side of the corresponding channel.
+         */
+        statistics::Scalar crossedReqs;
+        statistics::Scalar crossedResps;
+    } stats;
+
+  public:
+
+    Port &getPort(const std::string &if_name,
+                  PortID idx=InvalidPortID) override;
+
+    void init() override;
+
+    DrainState drain() override;
+
+    PARAMS(QuantumBridge);
+
+    QuantumBridge(const Params &p);
+};
+
+} // namespace gem5
+
+#endif //__MEM_QUANTUM_BRIDGE_HH__
@@ -54,11 +54,13 @@
 #include <functional>
 #include <limits>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "base/amo.hh"
 #include "base/compiler.hh"
 #include "base/flags.hh"
+#include "base/object_pool.hh"
 #include "base/types.hh"
 #include "cpu/inst_seq.hh"
 #include "mem/htm.hh"
@@ -522,6 +524,19 @@ class Request
 
     ~Request() {}
 
+    /**
+     * Create a request, taking its storage and that of the shared
+     * pointer bookkeeping from a per-thread pool rather than the
+     * system heap. Takes the same arguments as the constructors.
+     */
+    template <typename... Args>
+    static RequestPtr
+    create(Args&&... args)
+    {
+        return std::allocate_shared<Request>(PoolAllocator<Request>(),
+                                             std::forward<Args>(args)...);
+    }
+
     /**
      * Factory method for creating memory management requests, with
      * unspecified addr and size.
@@ -529,7 +544,7 @@ class Request
     static RequestPtr
     createMemManagement(Flags flags, RequestorID id)
     {
-        auto mgmt_req = std::make_shared<Request>();
+        auto mgmt_req = create();
         mgmt_req->_flags.set(flags);
         mgmt_req->_requestorId = id;
         mgmt_req->_time = curTick();
@@ -611,8 +626,8 @@ class Request
         assert(hasVaddr());
         assert(!hasPaddr());
         assert(split_addr > _vaddr && split_addr < _vaddr + _size);
-        req1 = std::make_shared<Request>(*this);
-        req2 = std::make_shared<Request>(*this);
+        req1 = create(*this);
+        req2 = create(*this);
         req1->_size = split_addr - _vaddr;
         req2->_vaddr = split_addr;
         req2->_size = _size - req1->_size;
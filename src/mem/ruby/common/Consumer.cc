@@ -91,7 +91,18 @@ Consumer::processCurrentEvent()
     // remove the current tick from the wakeup list, wake up, and then schedule
     // the next wakeup
     m_wakeup_ticks.erase(curr);
+    const bool skip_idle = em->skipIdleWakeups();
+    if (skip_idle && quiescent())
+        em->countWastedWakeup();
     wakeup();
+
+    if (skip_idle && !m_wakeup_ticks.empty() && quiescent()) {
+        em->countIdleSleep();
+        m_wakeup_ticks.clear();
+        if (m_wakeup_event.scheduled())
+            em->deschedule(m_wakeup_event);
+        return;
+    }
     scheduleNextWakeup();
 }
 
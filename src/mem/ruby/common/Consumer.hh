@@ -72,6 +72,16 @@ class Consumer
     virtual void print(std::ostream& out) const = 0;
     virtual void storeEventInfo(int info) {}
 
+    /**
+     * Quiescence condition of the consumer: true if it has nothing to do
+     * until a new message arrives, e.g., because all its input buffers
+     * are empty. If the object's skip_idle_wakeups parameter is set,
+     * wakeups which find the consumer quiescent are counted as wasted and
+     * all pending wakeups are dropped when the consumer is quiescent after
+     * wakeup(), relying on message arrivals to schedule new ones.
+     */
+    virtual bool quiescent() const { return false; }
+
     bool
     alreadyScheduled(Tick time)
     {
@@ -91,6 +91,16 @@ CrossbarSwitch::wakeup()
     }
 }
 
+bool
+CrossbarSwitch::isIdle() const
+{
+    for (const auto &buffer : switchBuffers) {
+        if (!buffer.isEmpty())
+            return false;
+    }
+    return true;
+}
+
 uint32_t
 CrossbarSwitch::functionalWrite(Packet *pkt)
 {
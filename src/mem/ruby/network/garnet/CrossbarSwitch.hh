@@ -65,6 +65,9 @@ class CrossbarSwitch : public Consumer
         switchBuffers[inport].insert(t_flit);
     }
 
+    /** No flit is waiting to traverse the switch */
+    bool isIdle() const;
+
     inline double get_crossbar_activity() { return m_crossbar_activity; }
 
     uint32_t functionalWrite(Packet *pkt);
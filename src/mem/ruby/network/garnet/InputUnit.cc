@@ -152,6 +152,18 @@ InputUnit::increment_credit(int in_vc, bool free_signal, Tick curTime)
 }
 
 
+bool
+InputUnit::isIdle() const
+{
+    if (!m_in_link->isEmpty())
+        return false;
+    for (const auto &vc : virtualChannels) {
+        if (!vc.isEmpty())
+            return false;
+    }
+    return true;
+}
+
 uint32_t
 InputUnit::functionalWrite(Packet *pkt)
 {
@@ -133,6 +133,9 @@ class InputUnit : public Consumer
 
     flitBuffer* getCreditQueue() { return &creditQueue; }
 
+    /** No flit is arriving on the input link or waiting in a VC */
+    bool isIdle() const;
+
     inline void
     set_in_link(NetworkLink *link)
     {
@@ -78,6 +78,8 @@ class NetworkLink : public ClockedObject, public Consumer
         return linkBuffer.isReady(curTime);
     }
 
+    bool isEmpty() const { return linkBuffer.isEmpty(); }
+
     inline flit* peekLink() { return linkBuffer.peekTopFlit(); }
     inline flit* consumeLink() { return linkBuffer.getTopFlit(); }
 
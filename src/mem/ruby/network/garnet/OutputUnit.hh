@@ -98,6 +98,9 @@ class OutputUnit : public Consumer
 
     void insert_flit(flit *t_flit);
 
+    /** No credit is arriving from the downstream router */
+    bool isIdle() const;
+
     inline int
     getVcsPerVnet()
     {
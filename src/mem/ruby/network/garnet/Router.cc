@@ -96,6 +96,22 @@ Router::wakeup()
     crossbarSwitch.wakeup();
 }
 
+bool
+Router::quiescent() const
+{
+    // Flits and credits in flight towards the router, or through its
+    // pipeline, all hold a wakeup of the router at the time they are due.
+    for (const auto &input_unit : m_input_unit) {
+        if (!input_unit->isIdle())
+            return false;
+    }
+    for (const auto &output_unit : m_output_unit) {
+        if (!output_unit->isIdle())
+            return false;
+    }
+    return crossbarSwitch.isIdle();
+}
+
 void
 Router::addInPort(PortDirection inport_dirn,
                   NetworkLink *in_link, CreditLink *credit_link)
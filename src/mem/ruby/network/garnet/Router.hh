@@ -72,6 +72,7 @@ class Router : public BasicRouter, public Consumer
     ~Router() = default;
 
     void wakeup();
+    bool quiescent() const override;
     void print(std::ostream& out) const {};
 
     void init();
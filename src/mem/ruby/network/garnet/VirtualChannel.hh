@@ -70,6 +70,8 @@ class VirtualChannel
         return inputBuffer.isReady(curTime);
     }
 
+    bool isEmpty() const { return inputBuffer.isEmpty(); }
+
     inline void
     insertFlit(flit *t_flit)
     {
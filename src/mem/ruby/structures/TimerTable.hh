@@ -64,6 +64,7 @@ class TimerTable
     bool isReady(Tick curTime) const;
     Addr nextAddress() const;
     bool isSet(Addr address) const { return !!m_map.count(address); }
+    bool isEmpty() const { return m_map.empty(); }
     void set(Addr address, Tick ready_time);
     void unset(Addr address);
     void print(std::ostream& out) const;
@@ -83,6 +83,7 @@ class WireBuffer : public SimObject
     const Message* peek();
     void recycle(Tick current_time, Tick recycle_latency);
     bool isReady(Tick current_time);
+    bool isEmpty() const { return m_message_queue.empty(); }
     // infinite queue length
     bool areNSlotsAvailable(int n, Tick current_time) { return true; };
 
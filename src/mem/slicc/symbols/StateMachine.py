@@ -323,6 +323,7 @@ class $c_ident : public AbstractController
 
     void print(std::ostream& out) const;
     void wakeup();
+    bool quiescent() const override;
     void resetStats();
     void regStats();
     void collateStats();
@@ -1028,7 +1029,26 @@ void $c_ident::resetStats()
 
     AbstractController::resetStats();
 }
+
+bool
+$c_ident::quiescent() const
+{
 ''')
+        # A controller only has work to do once a message is waiting in
+        # one of its in_ports, or in the queue to memory, unless it
+        # schedules wakeups of its own.
+        code.indent()
+        if any(func.c_name == "scheduleEvent" for func in self.functions):
+            code('return false;')
+        else:
+            code('if (getMemReqQueue() && !getMemReqQueue()->isEmpty())')
+            code('    return false;')
+            for port in self.in_ports:
+                code('if (!${{port.code}}.isEmpty())')
+                code('    return false;')
+            code('return true;')
+        code.dedent()
+        code('}')
 
         if self.EntryType != None:
             code('''
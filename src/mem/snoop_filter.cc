@@ -336,6 +336,99 @@ SnoopFilter::updateSnoopForward(const Packet* cpkt,
     }
 }
 
+SnoopFilter::SnoopList
+SnoopFilter::warmAccess(Addr addr, bool is_secure,
+                        const ResponsePort& cpu_side_port,
+                        bool needs_writable)
+{
+    if (!cpu_side_port.isSnooping())
+        return SnoopList();
+
+    Addr line_addr = addr & ~Addr(linesize - 1);
+    if (is_secure) {
+        line_addr |= LineSecure;
+    }
+
+    panic_if(cachedLocations.find(line_addr) == cachedLocations.end() &&
+             cachedLocations.size() >= maxEntryCount,
+             "snoop filter exceeded capacity of %d cache blocks\n",
+             maxEntryCount);
+
+    const SnoopMask req_port = portToMask(cpu_side_port);
+    SnoopItem& sf_item = cachedLocations[line_addr];
+    const SnoopMask others = sf_item.holder & ~req_port;
+
+    // Warmup accesses complete instantly, so the requester goes straight
+    // to being a holder, and is the only one if it takes ownership
+    if (needs_writable) {
+        sf_item.holder = req_port;
+    } else {
+        sf_item.holder |= req_port;
+    }
+
+    DPRINTF(SnoopFilter, "%s: addr %#x SF value %x.%x\n",
+            __func__, line_addr, sf_item.requested, sf_item.holder);
+
+    return maskToPortList(others);
+}
+
+void
+SnoopFilter::warmEvict(Addr addr, bool is_secure,
+                       const ResponsePort& cpu_side_port)
+{
+    if (!cpu_side_port.isSnooping())
+        return;
+
+    Addr line_addr = addr & ~Addr(linesize - 1);
+    if (is_secure) {
+        line_addr |= LineSecure;
+    }
+
+    auto sf_it = cachedLocations.find(line_addr);
+    if (sf_it == cachedLocations.end())
+        return;
+
+    sf_it->second.holder &= ~portToMask(cpu_side_port);
+    DPRINTF(SnoopFilter, "%s: addr %#x SF value %x.%x\n",
+            __func__, line_addr, sf_it->second.requested,
+            sf_it->second.holder);
+    eraseIfNullEntry(sf_it);
+}
+
+SnoopFilter::SnoopList
+SnoopFilter::warmInvalidate(Addr addr, bool is_secure)
+{
+    Addr line_addr = addr & ~Addr(linesize - 1);
+    if (is_secure) {
+        line_addr |= LineSecure;
+    }
+
+    auto sf_it = cachedLocations.find(line_addr);
+    if (sf_it == cachedLocations.end())
+        return SnoopList();
+
+    const SnoopMask holders = sf_it->second.holder;
+    sf_it->second.holder = 0;
+    eraseIfNullEntry(sf_it);
+
+    return maskToPortList(holders);
+}
+
+SnoopFilter::SnoopList
+SnoopFilter::warmHolders(Addr addr, bool is_secure) const
+{
+    Addr line_addr = addr & ~Addr(linesize - 1);
+    if (is_secure) {
+        line_addr |= LineSecure;
+    }
+
+    auto sf_it = cachedLocations.find(line_addr);
+    if (sf_it == cachedLocations.end())
+        return SnoopList();
+
+    return maskToPortList(sf_it->second.holder);
+}
+
 void
 SnoopFilter::updateResponse(const Packet* cpkt, const ResponsePort&
                             cpu_side_port)
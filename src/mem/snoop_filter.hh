@@ -200,6 +200,51 @@ class SnoopFilter : public SimObject
      */
     void updateResponse(const Packet *cpkt, const ResponsePort& cpu_side_port);
 
+    /**
+     * Record that a cache above holds a line after a functional warmup
+     * access, which has no request/response pair to track.
+     *
+     * @param addr          Block address.
+     * @param is_secure     Whether the address is in the secure space.
+     * @param cpu_side_port ResponsePort the access came from.
+     * @param needs_writable Whether the requester takes ownership.
+     * @return The other holders, which must be invalidated if the
+     *         requester takes ownership, and downgraded otherwise.
+     */
+    SnoopList warmAccess(Addr addr, bool is_secure,
+                         const ResponsePort& cpu_side_port,
+                         bool needs_writable);
+
+    /**
+     * Record that a cache above evicted a line during functional warmup,
+     * and that nothing further up still holds it.
+     *
+     * @param addr          Block address.
+     * @param is_secure     Whether the address is in the secure space.
+     * @param cpu_side_port ResponsePort the eviction came from.
+     */
+    void warmEvict(Addr addr, bool is_secure,
+                   const ResponsePort& cpu_side_port);
+
+    /**
+     * Forget all holders of a line invalidated from below during
+     * functional warmup.
+     *
+     * @param addr      Block address.
+     * @param is_secure Whether the address is in the secure space.
+     * @return The ports that held the line.
+     */
+    SnoopList warmInvalidate(Addr addr, bool is_secure);
+
+    /**
+     * Get the ports that may hold a line during functional warmup.
+     *
+     * @param addr      Block address.
+     * @param is_secure Whether the address is in the secure space.
+     * @return The ports that may hold the line.
+     */
+    SnoopList warmHolders(Addr addr, bool is_secure) const;
+
     virtual void regStats();
 
   protected:
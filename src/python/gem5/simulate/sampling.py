@@ -0,0 +1,218 @@
+# Copyright (c) 2026 The ECE565-Project Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Statistics of sampled simulation.
+
+The sampling driver, `Simulator.run_sampled()`, simulates a number of
+short detailed windows and evaluates a set of metrics (e.g., IPC) in
+each of them. The classes in this module hold the per-window results
+and estimate the mean of each metric over the whole execution, along
+with a confidence interval, as done by SMARTS-style sampling.
+"""
+
+import json
+import math
+from typing import Callable, Dict, List, Optional
+
+# Two-sided standard normal quantiles for the supported confidence
+# levels.
+_Z = {0.90: 1.6448536, 0.95: 1.9599640, 0.99: 2.5758293}
+
+
+def _t_quantile(confidence: float, dof: int) -> float:
+    """
+    The two-sided quantile of Student's t distribution with `dof` degrees
+    of freedom. Exact for one and two degrees of freedom, and a
+    Cornish-Fisher expansion around the normal quantile otherwise, which
+    is within one percent of the exact value.
+    """
+    if confidence not in _Z:
+        raise ValueError(
+            f"Unsupported confidence level {confidence}, use one of "
+            f"{sorted(_Z)}"
+        )
+
+    p = (1 + confidence) / 2
+    if dof == 1:
+        return math.tan(math.pi * (p - 0.5))
+    if dof == 2:
+        return (2 * p - 1) / math.sqrt(2 * p * (1 - p))
+
+    z = _Z[confidence]
+    n = dof
+    return (
+        z
+        + (z**3 + z) / (4 * n)
+        + (5 * z**5 + 16 * z**3 + 3 * z) / (96 * n**2)
+        + (3 * z**7 + 19 * z**5 + 17 * z**3 - 15 * z) / (384 * n**3)
+    )
+
+
+class SampleWindow:
+    """
+    A detailed simulation window, as seen by the metric functions, which
+    are called in the simulation process of the window once it is over.
+    """
+
+    def __init__(
+        self,
+        index: int,
+        start_tick: int,
+        ticks: int,
+        insts: int,
+        cycles: float,
+    ) -> None:
+        """
+        :param index: The index of the window in the sample.
+        :param start_tick: The tick at which the detailed window started,
+        after warmup.
+        :param ticks: The number of ticks simulated in detail.
+        :param insts: The number of instructions committed by the detailed
+        cores during the window.
+        :param cycles: The number of cycles of the board clock in the window.
+        """
+        self.index = index
+        self.start_tick = start_tick
+        self.ticks = ticks
+        self.insts = insts
+        self.cycles = cycles
+
+
+def ipc(window: SampleWindow) -> float:
+    """Instructions committed per board clock cycle, over all cores."""
+    return window.insts / window.cycles if window.cycles else 0.0
+
+
+default_metrics = {"ipc": ipc}
+
+
+class MetricEstimate:
+    """The estimate of the mean of a metric over the sampled windows."""
+
+    def __init__(self, values: List[float], confidence: float) -> None:
+        self.values = values
+        self.confidence = confidence
+        self.count = len(values)
+        self.mean = sum(values) / self.count if values else float("nan")
+
+        if self.count > 1:
+            self.stdev = math.sqrt(
+                sum((v - self.mean) ** 2 for v in values) / (self.count - 1)
+            )
+            self.half_width = (
+                _t_quantile(confidence, self.count - 1)
+                * self.stdev
+                / math.sqrt(self.count)
+            )
+        else:
+            self.stdev = float("nan")
+            self.half_width = float("inf")
+
+    def relative_error(self) -> float:
+        """The half width of the confidence interval relative to the mean."""
+        if not self.mean:
+            return float("inf")
+        return self.half_width / abs(self.mean)
+
+    def __str__(self) -> str:
+        return (
+            f"{self.mean:.6g} +/- {self.half_width:.3g} "
+            f"({self.confidence:.0%} confidence, n={self.count})"
+        )
+
+
+class SamplingResult:
+    """
+    The results of a sampled simulation: the metrics of every window and
+    the estimate of each metric over all of them.
+    """
+
+    def __init__(
+        self,
+        windows: List[Dict],
+        failed: List[int],
+        confidence: float,
+    ) -> None:
+        """
+        :param windows: For each window that completed, a dictionary with
+        its "index", "start_tick", "ticks", "insts" and "metrics".
+        :param failed: The indices of the windows whose simulation failed.
+        :param confidence: The confidence level of the intervals.
+        """
+        self.windows = sorted(windows, key=lambda w: w["index"])
+        self.failed = failed
+        self.confidence = confidence
+
+        names = []
+        for window in self.windows:
+            for name in window["metrics"]:
+                if name not in names:
+                    names.append(name)
+
+        self.estimates = {
+            name: MetricEstimate(
+                [
+                    w["metrics"][name]
+                    for w in self.windows
+                    if name in w["metrics"]
+                ],
+                confidence,
+            )
+            for name in names
+        }
+
+    def __getitem__(self, name: str) -> MetricEstimate:
+        return self.estimates[name]
+
+    def to_json(self) -> Dict:
+        return {
+            "confidence": self.confidence,
+            "failed": self.failed,
+            "windows": self.windows,
+            "estimates": {
+                name: {
+                    "mean": est.mean,
+                    "stdev": est.stdev,
+                    "half_width": est.half_width,
+                    "count": est.count,
+                }
+                for name, est in self.estimates.items()
+            },
+        }
+
+    def dump(self, path: str) -> None:
+        with open(path, "w") as f:
+            json.dump(self.to_json(), f, indent=4)
+
+    def __str__(self) -> str:
+        lines = [
+            f"{len(self.windows)} windows sampled"
+            + (f", {len(self.failed)} failed" if self.failed else "")
+        ]
+        for name, est in self.estimates.items():
+            lines.append(f"  {name}: {est}")
+        return "\n".join(lines)
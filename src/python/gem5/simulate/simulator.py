@@ -31,9 +31,20 @@ from m5.stats.gem5stats import get_simstat
 from m5.objects import Root
 from m5.util import warn
 
+import json
 import os
+import sys
+import traceback
 from pathlib import Path
-from typing import Optional, List, Tuple, Dict, Generator, Union
+from typing import (
+    Callable,
+    Optional,
+    List,
+    Tuple,
+    Dict,
+    Generator,
+    Union,
+)
 
 from .exit_event_generators import (
     default_exit_generator,
@@ -42,6 +53,7 @@ from .exit_event_generators import (
     default_workend_generator,
 )
 from .exit_event import ExitEvent
+from .sampling import SampleWindow, SamplingResult, default_metrics
 from ..components.boards.abstract_board import AbstractBoard
 from ..components.processors.cpu_types import CPUTypes
 
@@ -373,3 +385,196 @@ class Simulator:
         """
         m5.checkpoint(str(checkpoint_dir))
 
+    def run_sampled(
+        self,
+        window_starts: List[int],
+        window_ticks: int,
+        warmup_ticks: int = 0,
+        metrics: Optional[Dict[str, Callable[[SampleWindow], float]]] = None,
+        max_parallel: Optional[int] = None,
+        confidence: float = 0.95,
+        switch_processor: bool = True,
+    ) -> SamplingResult:
+        """
+        Run a sampled simulation. The simulation is fast-forwarded to the
+        start of each sample window, where it is drained and forked. The
+        child process switches to the detailed cores, warms them up for
+        `warmup_ticks`, simulates the window and evaluates the metrics, while
+        the parent process moves on to the next window. Windows are thus
+        simulated in parallel, each in its own output directory
+        (`sample<N>` within the output directory).
+
+        The simulation must not have been instantiated with listeners (e.g.,
+        GDB or terminal ports) enabled, as they cannot be shared by the
+        forked processes; this function disables them.
+
+        :param window_starts: The ticks at which the windows start.
+        :param window_ticks: The number of ticks simulated in detail in each
+        window, after warmup.
+        :param warmup_ticks: The number of ticks simulated with the detailed
+        cores before the stats are reset and the window starts.
+        :param metrics: The metrics to evaluate at the end of each window,
+        as functions of the `SampleWindow`. Defaults to the IPC.
+        :param max_parallel: The maximum number of windows simulated at once.
+        Defaults to the number of host cores, minus one for the parent.
+        :param confidence: The confidence level of the estimates, one of
+        0.90, 0.95 and 0.99.
+        :param switch_processor: Whether to switch the processor of the board
+        to its other cores at the start of each window. The processor must
+        then have a `switch()` method, as does the
+        `SimpleSwitchableProcessor`.
+
+        :returns: The per-window metrics and their estimates, which are also
+        written to `sampling.json` in the output directory.
+        """
+
+        if switch_processor and not hasattr(
+            self._board.get_processor(), "switch"
+        ):
+            raise Exception(
+                "The processor of the board cannot be switched; use a "
+                "switchable processor or set `switch_processor` to False."
+            )
+
+        if metrics is None:
+            metrics = default_metrics
+
+        if max_parallel is None:
+            max_parallel = max(1, (os.cpu_count() or 2) - 1)
+
+        if not m5.listenersDisabled():
+            m5.disableAllListeners()
+
+        self._instantiate()
+
+        outdir = m5.options.outdir
+        running = {}
+        finished = {}
+
+        def reap(block: bool) -> None:
+            while running:
+                pid, status = os.waitpid(-1, 0 if block else os.WNOHANG)
+                if pid == 0:
+                    return
+                if pid in running:
+                    finished[running.pop(pid)] = status
+                block = False
+
+        for index, start in enumerate(sorted(window_starts)):
+            if start > self.get_current_tick():
+                self._last_exit_event = m5.simulate(
+                    start - self.get_current_tick()
+                )
+                cause = self.get_last_exit_event_cause()
+                exit_enum = ExitEvent.translate_exit_status(cause)
+                if exit_enum != ExitEvent.MAX_TICK:
+                    warn(
+                        f"Simulation exited with '{cause}' before sample "
+                        f"window {index}, skipping the remaining windows."
+                    )
+                    break
+            elif start < self.get_current_tick():
+                warn(f"Sample window {index} starts in the past, skipping.")
+                continue
+
+            while len(running) >= max_parallel:
+                reap(block=True)
+
+            simout = os.path.join(outdir.replace("%", "%%"), f"sample{index}")
+            pid = m5.fork(simout=simout)
+            if pid == 0:
+                self._run_sample_window(
+                    index=index,
+                    window_ticks=window_ticks,
+                    warmup_ticks=warmup_ticks,
+                    metrics=metrics,
+                    switch_processor=switch_processor,
+                )
+            running[pid] = index
+
+        while running:
+            reap(block=True)
+
+        windows = []
+        failed = []
+        for index, status in sorted(finished.items()):
+            path = os.path.join(outdir, f"sample{index}", "sample.json")
+            if status != 0 or not os.path.isfile(path):
+                warn(f"Sample window {index} failed (status {status}).")
+                failed.append(index)
+                continue
+            with open(path) as f:
+                windows.append(json.load(f))
+
+        result = SamplingResult(windows, failed, confidence)
+        result.dump(os.path.join(outdir, "sampling.json"))
+        return result
+
+    def _run_sample_window(
+        self,
+        index: int,
+        window_ticks: int,
+        warmup_ticks: int,
+        metrics: Dict[str, Callable[[SampleWindow], float]],
+        switch_processor: bool,
+    ) -> None:
+        """
+        Simulate a sample window in a forked child process and write its
+        metrics to `sample.json` in the child's output directory. This never
+        returns.
+        """
+        status = 1
+        try:
+            processor = self._board.get_processor()
+            if switch_processor:
+                processor.switch()
+
+            if warmup_ticks:
+                m5.simulate(warmup_ticks)
+            m5.stats.reset()
+
+            def insts() -> int:
+                return sum(
+                    core.get_simobject().totalInsts()
+                    for core in processor.get_cores()
+                )
+
+            start_tick = self.get_current_tick()
+            start_insts = insts()
+            m5.simulate(window_ticks)
+            ticks = self.get_current_tick() - start_tick
+
+            period = self._board.get_clock_domain().clock[0].getValue()
+            window = SampleWindow(
+                index=index,
+                start_tick=start_tick,
+                ticks=ticks,
+                insts=insts() - start_insts,
+                cycles=ticks / period,
+            )
+
+            m5.stats.dump()
+            path = os.path.join(m5.options.outdir, "sample.json")
+            with open(path, "w") as f:
+                json.dump(
+                    {
+                        "index": index,
+                        "start_tick": start_tick,
+                        "ticks": ticks,
+                        "insts": window.insts,
+                        "metrics": {
+                            name: metric(window)
+                            for name, metric in metrics.items()
+                        },
+                    },
+                    f,
+                    indent=4,
+                )
+            status = 0
+        except BaseException:
+            traceback.print_exc()
+        finally:
+            # Never let the child return into the parent's sampling loop.
+            sys.stdout.flush()
+            sys.stderr.flush()
+            os._exit(status)
@@ -0,0 +1,260 @@
+# Copyright (c) 2026 The ECE565-Project Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Automatic partitioning of a system into event queues for parallel
+simulation.
+
+gem5 can simulate each main event queue in its own host thread, but
+objects on different queues may only interact through events that are
+at least one simulation quantum in the future. The functions in this
+module assign each core, together with the objects that are private to
+it (typically its L1 caches, table walkers and interrupt controller),
+to its own event queue. Every port connection crossing a partition
+boundary is split by a `QuantumBridge` which hands packets over between
+the threads with a latency of one quantum.
+
+Note that the bridges do not forward snoops, so the partitions are not
+kept coherent with each other. This is intended for workloads where the
+cores do not share writable data, e.g. rate-style multiprogrammed runs.
+"""
+
+from typing import Dict, Iterable, List, Optional, Set
+
+import m5
+from m5.objects import QuantumBridge, Root
+from m5.params import PortRef, VectorPortRef
+from m5.SimObject import SimObject
+from m5.util import convert, inform
+
+
+def _port_refs(obj: SimObject) -> Iterable[PortRef]:
+    """Yields every connected (non-proxy) port reference of an object."""
+    for ref in obj._port_refs.values():
+        refs = ref.elements if isinstance(ref, VectorPortRef) else [ref]
+        for r in refs:
+            if isinstance(r.peer, PortRef):
+                yield r
+
+
+def _absorb_private_objects(
+    partitions: List[Set[SimObject]], all_objects: Iterable[SimObject]
+) -> None:
+    """
+    Grows each partition with the objects that only receive requests from
+    that partition, e.g. the L1 caches and private L2 of a core. Objects
+    without any incoming connection are left on the shared queue.
+    """
+    owner = {}
+    for index, objs in enumerate(partitions):
+        for obj in objs:
+            owner[obj] = index
+
+    changed = True
+    while changed:
+        changed = False
+        for obj in all_objects:
+            if obj in owner:
+                continue
+
+            sources = set()
+            for ref in _port_refs(obj):
+                if ref.role == "GEM5 RESPONDER":
+                    sources.add(owner.get(ref.peer.simobj, None))
+
+            if len(sources) == 1 and None not in sources:
+                index = sources.pop()
+                for desc in obj.descendants():
+                    if desc not in owner:
+                        owner[desc] = index
+                        partitions[index].add(desc)
+                changed = True
+
+
+class PartitionReport:
+    """
+    Describes how a system was partitioned and, once simulation has run,
+    how much traffic crossed the partition boundaries.
+    """
+
+    def __init__(self, shared_eventq_index: int, sim_quantum: int):
+        self.shared_eventq_index = shared_eventq_index
+        self.sim_quantum = sim_quantum
+        self.queues: Dict[int, List[SimObject]] = {}
+        self.bridges: List[QuantumBridge] = []
+
+    def num_queues(self) -> int:
+        return len(self.queues) + 1
+
+    def __str__(self) -> str:
+        lines = [
+            "Partitioned into {} event queues with a {} tick quantum:".format(
+                self.num_queues(), self.sim_quantum
+            ),
+            "  queue {}: shared objects".format(self.shared_eventq_index),
+        ]
+        for index, objs in sorted(self.queues.items()):
+            lines.append(
+                "  queue {}: {} ({} objects)".format(
+                    index, objs[0].path(), len(objs)
+                )
+            )
+        lines.append("  {} boundary bridges".format(len(self.bridges)))
+        return "\n".join(lines)
+
+    def crossed_messages(self) -> int:
+        """
+        Returns the number of packets that crossed a partition boundary
+        since the stats were last reset. Only valid after instantiation.
+        """
+        total = 0
+        for bridge in self.bridges:
+            total += bridge.resolveStat("crossedReqs").value
+            total += bridge.resolveStat("crossedResps").value
+        return int(total)
+
+    def summary(self, serial_host_seconds: Optional[float] = None) -> str:
+        """
+        Returns a summary of the run so far: the simulation rate, the
+        number of messages which crossed a boundary, and the speedup over
+        a serial run if its host time is provided.
+
+        :param serial_host_seconds: Host seconds taken by a serial run of
+            the same region of interest.
+        """
+        root = Root.getInstance()
+        host_seconds = root.resolveStat("hostSeconds").value
+        sim_ticks = root.resolveStat("simTicks").value
+
+        lines = [str(self)]
+        if host_seconds > 0:
+            lines.append(
+                "  simulation rate: {:.0f} ticks/host second".format(
+                    sim_ticks / host_seconds
+                )
+            )
+        lines.append(
+            "  cross-queue messages: {}".format(self.crossed_messages())
+        )
+        if serial_host_seconds is not None and host_seconds > 0:
+            lines.append(
+                "  speedup over serial run: {:.2f}x".format(
+                    serial_host_seconds / host_seconds
+                )
+            )
+        return "\n".join(lines)
+
+
+def partition_cores(
+    cores: List[SimObject],
+    root: Optional[Root] = None,
+    sim_quantum: str = "10ns",
+    shared_eventq_index: int = 0,
+    absorb_private: bool = True,
+) -> PartitionReport:
+    """
+    Assigns each core and the objects private to it to its own event queue
+    and splits every connection to the rest of the system with a
+    `QuantumBridge`. This has to be called once the whole system has been
+    built and connected, and before `m5.instantiate()`.
+
+    :param cores: The cores to partition. Each core's descendants (caches
+        created with `addPrivateSplitL1Caches`, walkers, interrupt
+        controllers) are placed on the same queue as the core.
+    :param root: The simulation's root object. Its quantum is set to
+        `sim_quantum`. Defaults to the current Root instance.
+    :param sim_quantum: The synchronisation quantum, which is also the
+        latency of every boundary bridge.
+    :param shared_eventq_index: The event queue of the objects shared by
+        all cores. The cores use the following queue indices.
+    :param absorb_private: Also move objects which only receive requests
+        from a single partition (e.g. L1 caches which are not children of
+        the core) to that partition.
+    :returns: A report describing the partitioning.
+    """
+
+    if root is None:
+        root = Root.getInstance()
+    if root is None:
+        raise Exception("partition_cores() needs a Root object.")
+
+    m5.ticks.fixGlobalFrequency()
+    quantum = m5.ticks.fromSeconds(convert.anyToLatency(sim_quantum))
+    root.sim_quantum = quantum
+
+    report = PartitionReport(shared_eventq_index, quantum)
+
+    partitions = [set(core.descendants()) for core in cores]
+    if absorb_private:
+        _absorb_private_objects(partitions, list(root.descendants()))
+
+    queue_of = {}
+    for i, (core, objs) in enumerate(zip(cores, partitions)):
+        index = shared_eventq_index + 1 + i
+        for obj in objs:
+            obj.eventq_index = index
+            queue_of[obj] = index
+        report.queues[index] = [core] + sorted(
+            (obj for obj in objs if obj is not core), key=lambda o: o.path()
+        )
+
+    for core, objs in zip(cores, partitions):
+        bridges = []
+        for obj in sorted(objs, key=lambda o: o.path()):
+            for ref in list(_port_refs(obj)):
+                peer = ref.peer
+                if isinstance(peer.simobj, QuantumBridge):
+                    continue
+
+                src_queue = queue_of[obj]
+                dst_queue = queue_of.get(peer.simobj, shared_eventq_index)
+                if src_queue == dst_queue:
+                    continue
+
+                # Connections between two partitions are visited from both
+                # sides, only split them from the requestor side.
+                if ref.role != "GEM5 REQUESTOR" and peer.simobj in queue_of:
+                    continue
+
+                if ref.role == "GEM5 REQUESTOR":
+                    req_queue, resp_queue = src_queue, dst_queue
+                else:
+                    req_queue, resp_queue = dst_queue, src_queue
+
+                bridge = QuantumBridge(
+                    delay=sim_quantum,
+                    eventq_index=req_queue,
+                    mem_side_eventq_index=resp_queue,
+                )
+                ref.splice(bridge.cpu_side_port, bridge.mem_side_port)
+                bridges.append(bridge)
+
+        if bridges:
+            core.quantum_bridges = bridges
+            report.bridges.extend(bridges)
+
+    inform("%s", report)
+    return report
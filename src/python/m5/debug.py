@@ -29,6 +29,7 @@ from collections.abc import Mapping
 import _m5.debug
 from _m5.debug import SimpleFlag, CompoundFlag
 from _m5.debug import schedBreak, setRemoteGDBPort
+from _m5.trace import flush
 from m5.util import printList
 
 def help():
@@ -55,6 +56,12 @@ def help():
         print("    %s: %s" % (name, flag.desc))
     print()
 
+def compiledOut(flag):
+    """True if the code guarded by flag was removed with TRACING_FLAGS."""
+    if isinstance(flag, CompoundFlag):
+        return all(compiledOut(kid) for kid in flag.kids())
+    return flag.compiledOut
+
 class AllFlags(Mapping):
     def __init__(self):
         self._version = -1
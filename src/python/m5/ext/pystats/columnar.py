@@ -0,0 +1,171 @@
+# Copyright (c) 2026 The ECE565-Project Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Reader for the columnar binary stats format (the `columnar://` stats
+output). Each stat is loaded as a numpy array with one row per dump:
+
+    stats = ColumnarStats("m5out/stats.bin")
+    ipc = stats["system.cpu.ipc"]       # shape (dumps,)
+    hist = stats["system.cpu.fetch.nisnDist"]  # shape (dumps, fields)
+    stats.ticks                         # tick of every dump
+
+Files written without compression are memory mapped, and the arrays are
+views into the file, so loading even a very large file is immediate.
+"""
+
+import mmap
+import struct
+import zlib
+from typing import Dict, List, Tuple
+
+_MAGIC = b"gem5STAT"
+_FILE_HEADER = struct.Struct("<8sIIQQ")
+_BLOCK_HEADER = struct.Struct("<IIQ")
+_RAW = 0
+_DEFLATE = 1
+
+
+class ColumnarStat:
+    """Schema entry of a stat."""
+
+    def __init__(self, line: str) -> None:
+        fields = line.split("\t")
+        self.name = fields[0]
+        self.kind = fields[1]
+        self.offset = int(fields[2])
+        self.shape = tuple(int(d) for d in fields[3].split("x"))
+        self.labels = fields[4].split(",") if fields[4] else []
+        self.description = fields[5]
+
+    @property
+    def columns(self) -> int:
+        count = 1
+        for dim in self.shape:
+            count *= dim
+        return count
+
+    def __repr__(self) -> str:
+        return f"ColumnarStat({self.name}, {self.kind}, {self.shape})"
+
+
+class ColumnarStats:
+    """A columnar stats file, loaded as numpy arrays."""
+
+    def __init__(self, path: str) -> None:
+        import numpy as np
+
+        with open(path, "rb") as f:
+            self._map = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+
+        magic, version, columns, schema_size, data_offset = (
+            _FILE_HEADER.unpack_from(self._map, 0)
+        )
+        if magic != _MAGIC:
+            raise ValueError(f"{path} is not a columnar stats file")
+        if version != 1:
+            raise ValueError(f"Unsupported columnar stats version {version}")
+
+        schema = self._map[
+            _FILE_HEADER.size : _FILE_HEADER.size + schema_size
+        ].decode()
+        self.stats = {}  # type: Dict[str, ColumnarStat]
+        for line in schema.splitlines():
+            stat = ColumnarStat(line)
+            self.stats[stat.name] = stat
+
+        self._dtype = np.dtype(
+            [("tick", "<u8"), ("values", "<f8", (columns,))]
+        )
+        blocks = self._read_blocks(np, data_offset)
+        if len(blocks) == 1:
+            self._rows = blocks[0]
+        elif blocks:
+            self._rows = np.concatenate(blocks)
+        else:
+            self._rows = np.zeros(0, dtype=self._dtype)
+
+    def _read_blocks(self, np, offset: int) -> List:
+        blocks = []
+        size = len(self._map)
+        row_size = self._dtype.itemsize
+        while offset + _BLOCK_HEADER.size <= size:
+            encoding, rows, stored = _BLOCK_HEADER.unpack_from(
+                self._map, offset
+            )
+            offset += _BLOCK_HEADER.size
+            if encoding == _RAW:
+                # The last block may be cut short if the simulation was
+                # still running.
+                rows = min(rows, (size - offset) // row_size)
+                blocks.append(
+                    np.frombuffer(
+                        self._map, dtype=self._dtype, count=rows,
+                        offset=offset,
+                    )
+                )
+                offset += rows * row_size
+            elif encoding == _DEFLATE:
+                data = zlib.decompress(self._map[offset : offset + stored])
+                blocks.append(np.frombuffer(data, dtype=self._dtype))
+                offset += (stored + 7) // 8 * 8
+            else:
+                raise ValueError(f"Unknown block encoding {encoding}")
+            if rows == 0:
+                break
+        return blocks
+
+    @property
+    def ticks(self):
+        """The tick of every dump."""
+        return self._rows["tick"]
+
+    @property
+    def values(self):
+        """All the values, one row per dump and one column per value."""
+        return self._rows["values"]
+
+    def names(self) -> List[str]:
+        return list(self.stats)
+
+    def __len__(self) -> int:
+        return len(self._rows)
+
+    def __contains__(self, name: str) -> bool:
+        return name in self.stats
+
+    def __getitem__(self, name: str):
+        """The values of a stat, shaped (dumps,) for scalars and
+        (dumps,) + shape otherwise."""
+        stat = self.stats[name]
+        values = self.values[:, stat.offset : stat.offset + stat.columns]
+        if stat.shape == (1,):
+            return values[:, 0]
+        return values.reshape((len(self),) + stat.shape)
+
+    def labels(self, name: str) -> List[str]:
+        """The labels of the columns of a stat, e.g., vector subnames."""
+        return self.stats[name].labels
@@ -115,11 +115,24 @@ def parse_options():
     option("--stats-help",
            action="callback", callback=_stats_help,
            help="Display documentation for available stat visitors")
+    option("--stats-filter", metavar="REGEX", action="append", default=[],
+        help="Only keep statistics whose full name matches REGEX. "
+             "Can be passed multiple times.")
+    option("--stats-async", action="store_true", default=False,
+        help="Write stats dumps from a helper thread")
+    option("--stats-incremental", action="store_true", default=False,
+        help="Only dump text stats that changed since the previous dump "
+             "(implies --stats-async)")
+    option("--stats-arena", action="store_true", default=False,
+        help="Pack the storage of vector stats into per-object arenas")
 
     # Configuration Options
     group("Configuration Options")
     option("--dump-config", metavar="FILE", default="config.ini",
         help="Dump configuration output file [Default: %default]")
+    option("--dump-config-binary", metavar="FILE", default="",
+        help="Also dump the configuration in the compact binary format "
+             "read by util/cxx_config (requires --dump-config)")
     option("--json-config", metavar="FILE", default="config.json",
         help="Create JSON output of the configuration [Default: %default]")
     option("--dot-config", metavar="FILE", default="config.dot",
@@ -144,6 +157,13 @@ def parse_options():
     option("--debug-file", metavar="FILE", default="cout",
         help="Sets the output file for debug. Append '.gz' to the name for it"
               " to be compressed automatically [Default: %default]")
+    option("--debug-binary", action='store_true', default=False,
+        help="Write debug output in a compact binary format that is "
+             "decoded with util/decode_debug_trace")
+    option("--debug-flight-recorder", metavar="SIZE", default="",
+        help="Only keep the last SIZE (e.g. 64MiB) of debug output of each "
+             "thread in memory and write it to the debug file when the "
+             "simulator panics or m5.debug.flush() is called")
     option("--debug-ignore", metavar="EXPR", action='append', split=':',
         help="Ignore EXPR sim objects")
     option("--remote-gdb-port", type='int', default=7000,
@@ -205,7 +225,8 @@ def main():
     from . import stats
     from . import trace
 
-    from .util import inform, fatal, panic, isInteractive
+    from .util import inform, warn, fatal, panic, isInteractive
+    from .util import convert
     from m5.util.terminal_formatter import TerminalFormatter
 
     options, arguments = parse_options()
@@ -342,6 +363,12 @@ def main():
 
     # set stats options
     stats.addStatVisitor(options.stats_file)
+    if options.stats_filter:
+        stats.setFilter(options.stats_filter)
+    if options.stats_async or options.stats_incremental:
+        stats.setAsyncDump(incremental=options.stats_incremental)
+    if options.stats_arena:
+        stats.enableArenaStorage()
 
     # Disable listeners unless running interactively or explicitly
     # enabled
@@ -383,6 +410,9 @@ def main():
                 debug.flags[flag].disable()
             else:
                 debug.flags[flag].enable()
+                if debug.compiledOut(debug.flags[flag]):
+                    warn("Debug flag '%s' was compiled out of this build "
+                         "(see TRACING_FLAGS)" % flag)
 
     if options.debug_start:
         _check_tracing()
@@ -396,7 +426,11 @@ def main():
         e = event.create(trace.disable, event.Event.Debug_Enable_Pri)
         event.mainq.schedule(e, options.debug_end)
 
-    trace.output(options.debug_file)
+    if options.debug_flight_recorder:
+        trace.flightRecorder(options.debug_file,
+            convert.toMemorySize(options.debug_flight_recorder))
+    else:
+        trace.output(options.debug_file, options.debug_binary)
 
     for ignore in options.debug_ignore:
         _check_tracing()
@@ -44,6 +44,7 @@ import sys
 # import the wrapped C++ functions
 import _m5.drain
 import _m5.core
+import _m5.trace
 from _m5.stats import updateEvents as updateStatEvents
 
 from . import stats
@@ -97,6 +98,16 @@ def instantiate(ckpt_dir=None):
             obj.print_ini(ini_file)
         ini_file.close()
 
+        if options.dump_config_binary:
+            if not _m5.core.writeBinaryConfig(
+                    os.path.join(options.outdir, options.dump_config),
+                    os.path.join(options.outdir,
+                                 options.dump_config_binary)):
+                fatal("Failed to write binary config %s",
+                      options.dump_config_binary)
+    elif options.dump_config_binary:
+        fatal("--dump-config-binary requires --dump-config")
+
     if options.json_config:
         try:
             import json
@@ -360,8 +371,11 @@ def fork(simout="%(parent)s.f%(fork_seq)i"):
 
     drain()
 
-    # Terminate helper threads that service parallel event queues.
+    # Terminate helper threads that service parallel event queues and
+    # write stats dumps and debug traces.
     _m5.event.terminateEventQueueThreads()
+    stats.drainAsyncDump()
+    _m5.trace.prepareFork()
 
     try:
         pid = os.fork()
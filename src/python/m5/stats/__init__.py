@@ -37,6 +37,9 @@
 # (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 # OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+import atexit
+import re
+
 import m5
 
 import _m5.stats
@@ -48,6 +51,7 @@ from m5.util import attrdict, fatal
 # Stat exports
 from _m5.stats import schedStatEvent as schedEvent
 from _m5.stats import periodicStatDump
+from _m5.stats import enableArenaStorage
 
 outputList = []
 
@@ -183,6 +187,38 @@ def _hdf5Factory(fn, chunking=10, desc=True, formulas=True):
 
     return _m5.stats.initHDF5(fn, chunking, desc, formulas)
 
+@_url_factory([ "columnar", ])
+def _columnarFactory(fn, block_rows=64, compression=1, desc=True,
+                     formulas=True):
+    """Output stats in a columnar binary format.
+
+    The schema of the stats is written once, at the first dump, and
+    every dump then appends a fixed-width row holding the current tick
+    and the value of every stat. This makes periodic dumps much smaller
+    and faster to write and to load than text. Rows are grouped in
+    blocks, which are compressed once they are full unless compression
+    is disabled, in which case the file can be memory mapped as is.
+
+    The file can be loaded as numpy arrays using
+    m5.ext.pystats.columnar.ColumnarStats.
+
+    Known limitations:
+      * Sparse histograms are unsupported.
+      * No support for forking.
+
+    Parameters:
+      * block_rows (unsigned): Rows per compressed block (default: 64)
+      * compression (int): zlib compression level, 0 disables (default: 1)
+      * desc (bool): Output stat descriptions (default: True)
+      * formulas (bool): Output derived stats (default: True)
+
+    Example:
+      columnar://stats.bin?compression=0;formulas=False
+
+    """
+
+    return _m5.stats.initColumnar(fn, block_rows, compression, desc, formulas)
+
 @_url_factory(["json"])
 def _jsonFactory(fn):
     """Output stats in JSON format.
@@ -288,6 +324,28 @@ def _bindStatHierarchy(root):
     for name, obj in root._children.items():
         _bind_obj(name, obj)
 
+def _visit_stats_by_name(visitor, root=None, prefix=""):
+    if root is None:
+        root = Root.getInstance()
+    for stat in root.getStats():
+        visitor(prefix + stat.name, stat)
+    for name, group in root.getStatGroups().items():
+        _visit_stats_by_name(visitor, root=group, prefix=prefix + name + ".")
+
+def _filtered(stat):
+    return bool(stat.flags & flags.filtered)
+
+stats_filter = []
+def setFilter(patterns):
+    '''Only keep the statistics whose full name matches one of the
+    regular expressions in patterns. All other statistics are left out
+    of dumps, and distributions stop recording samples. The
+    filter is applied when the statistics package is enabled, so it has
+    to be set before the simulation is instantiated.'''
+
+    global stats_filter
+    stats_filter = [ re.compile(p) for p in patterns ]
+
 names = []
 stats_dict = {}
 stats_list = []
@@ -322,6 +380,15 @@ def enable():
     _visit_stats(check_stat)
     _visit_stats(lambda g, s: s.enable())
 
+    if stats_filter:
+        def filter_stat(name, stat):
+            if not any(p.fullmatch(name) for p in stats_filter):
+                stat.filter()
+
+        for stat in stats_list:
+            filter_stat(stat.name, stat)
+        _visit_stats_by_name(filter_stat)
+
     _m5.stats.enable();
 
 def prepare():
@@ -330,16 +397,22 @@ def prepare():
 
     # Legacy stats
     for stat in stats_list:
-        stat.prepare()
+        if not _filtered(stat):
+            stat.prepare()
 
     # New stats
-    _visit_stats(lambda g, s: s.prepare())
+    def prepare_stat(group, stat):
+        if not _filtered(stat):
+            stat.prepare()
+
+    _visit_stats(prepare_stat)
 
 def _dump_to_visitor(visitor, roots=None):
     # New stats
     def dump_group(group):
         for stat in group.getStats():
-            stat.visit(visitor)
+            if not _filtered(stat):
+                stat.visit(visitor)
         for n, g in group.getStatGroups().items():
             visitor.beginGroup(n)
             dump_group(g)
@@ -359,12 +432,34 @@ def _dump_to_visitor(visitor, roots=None):
 
         # Legacy stats
         for stat in stats_list:
-            stat.visit(visitor)
+            if not _filtered(stat):
+                stat.visit(visitor)
 
 lastDump = 0
 # List[SimObject].
 global_dump_roots = []
 
+async_dump = False
+incremental_dump = False
+def setAsyncDump(enable=True, incremental=False):
+    '''Write full stats dumps from a helper thread. The simulation only
+    waits for the stats to be copied, formatting and file output happen
+    in the background. If incremental is set, outputs that support it
+    only receive the stats that changed since the previous dump.'''
+
+    global async_dump, incremental_dump
+    async_dump = enable
+    incremental_dump = incremental
+    if not enable:
+        _m5.stats.drainAsyncDump()
+
+def drainAsyncDump():
+    '''Wait for stats dumps that are written in the background.'''
+    _m5.stats.drainAsyncDump()
+
+# Registered at import time so that it runs after the final dump.
+atexit.register(drainAsyncDump)
+
 def dump(roots=None):
     '''Dump all statistics data to the registered outputs'''
 
@@ -394,18 +489,30 @@ def dump(roots=None):
             sim_root.preDumpStats();
         prepare()
 
+    background = async_dump and not all_roots
+    if not background:
+        # Outputs can't be shared with the helper thread.
+        _m5.stats.drainAsyncDump()
+
+    async_outputs = []
     for output in outputList:
         if isinstance(output, JsonOutputVistor):
             if not all_roots:
                 output.dump(Root.getInstance())
             else:
                 output.dump(all_roots)
+        elif background:
+            async_outputs.append(output)
         else:
             if output.valid():
                 output.begin()
                 _dump_to_visitor(output, roots=all_roots)
                 output.end()
 
+    if async_outputs:
+        _m5.stats.dumpAsync(Root.getInstance().getCCObject(), async_outputs,
+                            stats_list, incremental_dump)
+
 def reset():
     '''Reset all statistics to the base state'''
 
@@ -430,4 +537,5 @@ flags = attrdict({
     'dist'    : 0x0080,
     'nozero'  : 0x0100,
     'nonan'   : 0x0200,
+    'filtered': 0x0800,
 })
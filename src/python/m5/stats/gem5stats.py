@@ -81,6 +81,15 @@ class JsonOutputVistor():
             simstat = get_simstat(root=roots, prepare_stats=False)
             simstat.dump(fp=fp, **self.json_args)
 
+def _is_filtered(statistic: _m5.stats.Info) -> bool:
+    """
+    Returns True if the statistic has been excluded by the stats filter.
+    """
+
+    # Imported here since m5.stats imports this module.
+    from m5.stats import flags
+    return bool(statistic.flags & flags.filtered)
+
 def get_stats_group(group: _m5.stats.Group) -> Group:
     """
     Translates a gem5 Group object into a Python stats Group object. A Python
@@ -104,6 +113,8 @@ def get_stats_group(group: _m5.stats.Group) -> Group:
     stats_dict = {}
 
     for stat in group.getStats():
+        if _is_filtered(stat):
+            continue
         statistic = __get_statistic(stat)
         if statistic is not None:
             stats_dict[stat.name] = statistic
@@ -228,7 +239,8 @@ def _prepare_stats(group: _m5.stats.Group):
     group.preDumpStats()
 
     for stat in group.getStats():
-        stat.prepare()
+        if not _is_filtered(stat):
+            stat.prepare()
 
     for child in group.getStatGroups().values():
         _prepare_stats(child)
@@ -54,6 +54,7 @@
 #include "base/temperature.hh"
 #include "base/types.hh"
 #include "sim/core.hh"
+#include "sim/cxx_config_binary.hh"
 #include "sim/cur_tick.hh"
 #include "sim/drain.hh"
 #include "sim/serialize.hh"
@@ -279,6 +280,8 @@ pybind_init_core(py::module_ &m_native)
         .def("setClockFrequency", &setClockFrequency)
         .def("getClockFrequency", &getClockFrequency)
         .def("curTick", curTick)
+
+        .def("writeBinaryConfig", &CxxBinaryFile::convert)
         ;
 
     /* TODO: These should be read-only */
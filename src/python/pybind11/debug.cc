@@ -47,8 +47,10 @@
 
 #include "base/compiler.hh"
 #include "base/debug.hh"
+#include "base/logging.hh"
 #include "base/output.hh"
 #include "base/trace.hh"
+#include "sim/core.hh"
 #include "sim/debug.hh"
 
 namespace py = pybind11;
@@ -57,14 +59,57 @@ namespace gem5
 {
 
 static void
-output(const char *filename)
+flushDebugLogger()
+{
+    Trace::getDebugLogger()->flush();
+}
+
+static void
+prepareDebugLoggerFork()
+{
+    Trace::getDebugLogger()->prepareFork();
+}
+
+static std::ostream &
+debugStream(const char *filename, bool binary)
 {
     OutputStream *file_stream = simout.find(filename);
 
     if (!file_stream)
-        file_stream = simout.create(filename);
+        file_stream = simout.create(filename, binary);
+
+    // Write out buffered messages if the simulator panics.
+    static bool registered = false;
+    if (!registered) {
+        Logger::addExitHook(flushDebugLogger);
+        registered = true;
+    }
 
-    Trace::setDebugLogger(new Trace::OstreamLogger(*file_stream->stream()));
+    return *file_stream->stream();
+}
+
+static void
+output(const char *filename, bool binary)
+{
+    std::ostream &stream = debugStream(filename, binary);
+
+    if (binary) {
+        static bool registered = false;
+        if (!registered) {
+            registerExitCallback(flushDebugLogger);
+            registered = true;
+        }
+        Trace::setDebugLogger(new Trace::BinaryLogger(stream));
+    } else {
+        Trace::setDebugLogger(new Trace::OstreamLogger(stream));
+    }
+}
+
+static void
+flightRecorder(const char *filename, size_t capacity)
+{
+    Trace::setDebugLogger(
+        new Trace::FlightRecorder(debugStream(filename, false), capacity));
 }
 
 static void
@@ -113,6 +158,8 @@ pybind_init_debug(py::module_ &m_native)
 
     py::class_<debug::SimpleFlag>(m_debug, "SimpleFlag", c_flag)
         .def_property_readonly("isFormat", &debug::SimpleFlag::isFormat)
+        .def_property_readonly("compiledOut",
+                               &debug::SimpleFlag::compiledOut)
         ;
     py::class_<debug::CompoundFlag>(m_debug, "CompoundFlag", c_flag)
         .def("kids", &debug::CompoundFlag::kids)
@@ -121,7 +168,11 @@ pybind_init_debug(py::module_ &m_native)
 
     py::module_ m_trace = m_native.def_submodule("trace");
     m_trace
-        .def("output", &output)
+        .def("output", &output,
+             py::arg("filename"), py::arg("binary") = false)
+        .def("flightRecorder", &flightRecorder)
+        .def("flush", &flushDebugLogger)
+        .def("prepareFork", &prepareDebugLoggerFork)
         .def("ignore", &ignore)
         .def("enable", &Trace::enable)
         .def("disable", &Trace::disable)
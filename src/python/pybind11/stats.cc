@@ -42,6 +42,9 @@
 #include "pybind11/stl.h"
 
 #include "base/statistics.hh"
+#include "base/stats/arena.hh"
+#include "base/stats/columnar.hh"
+#include "base/stats/snapshot.hh"
 #include "base/stats/text.hh"
 #include "config/have_hdf5.hh"
 
@@ -110,8 +113,11 @@ pybind_init_stats(py::module_ &m_native)
 
     m
         .def("initSimStats", &statistics::initSimStats)
+        .def("enableArenaStorage", &statistics::enableArenaStorage,
+             py::arg("enable") = true)
         .def("initText", &statistics::initText,
             py::return_value_policy::reference)
+        .def("initColumnar", &statistics::initColumnar)
 #if HAVE_HDF5
         .def("initHDF5", &statistics::initHDF5)
 #endif
@@ -125,6 +131,14 @@ pybind_init_stats(py::module_ &m_native)
         .def("enable", &statistics::enable)
         .def("enabled", &statistics::enabled)
         .def("statsList", &statistics::statsList)
+        .def("dumpAsync", [](statistics::Group &root,
+                             const std::vector<statistics::Output *> &outputs,
+                             const std::vector<statistics::Info *> &legacy,
+                             bool incremental) {
+                statistics::asyncDump().dump(root, outputs, legacy,
+                                             incremental);
+            })
+        .def("drainAsyncDump", []() { statistics::asyncDump().drain(); })
         ;
 
     py::class_<statistics::Output>(m, "Output")
@@ -149,6 +163,7 @@ pybind_init_stats(py::module_ &m_native)
         .def("check", &statistics::Info::check)
         .def("baseCheck", &statistics::Info::baseCheck)
         .def("enable", &statistics::Info::enable)
+        .def("filter", &statistics::Info::filter)
         .def("prepare", &statistics::Info::prepare)
         .def("reset", &statistics::Info::reset)
         .def("zero", &statistics::Info::zero)
@@ -53,3 +53,8 @@ class ClockedObject(SimObject):
 
     power_state = Param.PowerState(PowerState(), "Power state")
 
+    # Stop waking up the parts of this object which declare themselves
+    # quiescent until new work arrives, and count those wakeups in the
+    # wakeups stats group
+    skip_idle_wakeups = Param.Bool(False, "Skip wakeups while quiescent")
+
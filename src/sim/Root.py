@@ -30,6 +30,9 @@ from m5.SimObject import SimObject
 from m5.params import *
 from m5.util import fatal
 
+class EventQueueImpl(Enum):
+    vals = ['linked_list', 'indexed']
+
 class Root(SimObject):
 
     _the_instance = None
@@ -67,6 +70,20 @@ class Root(SimObject):
     # Needs to be set explicitly for a multi-eventq simulation.
     sim_quantum = Param.Tick(0, "simulation quantum")
 
+    # Data structure used by the main event queues to locate event bins.
+    # Both implementations service events in exactly the same order, the
+    # indexed queue is faster when many distinct (tick, priority) bins
+    # are pending at the same time.
+    event_queue_impl = Param.EventQueueImpl('linked_list',
+        "Event queue implementation (linked_list, indexed)")
+
+    # Attribute the host time spent servicing events to the SimObjects
+    # owning them. One in this many events is timed (on average), zero
+    # disables the profile. The profile is written to hostprofile.txt
+    # and, as folded stacks for flame graphs, hostprofile.folded.
+    host_profile_sample_period = Param.Unsigned(0,
+        "Time one in this many events to profile host time (0: disabled)")
+
     full_system = Param.Bool("if this is a full system simulation")
 
     # Time syncing prevents the simulation from running faster than real time.
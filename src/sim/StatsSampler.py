@@ -0,0 +1,56 @@
+# Copyright (c) 2026 The ECE565-Project Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.SimObject import SimObject
+from m5.params import *
+
+class StatsSampler(SimObject):
+    """
+    Periodically sample a few stats and stream them out from a background
+    thread, to monitor long simulations without dumping all the stats.
+    The simulation thread only copies the values of the selected stats
+    into a ring buffer, formatting and I/O happen on the export thread.
+
+    Every sample is a line with the tick and the value of each stat,
+    tab-separated, after a header line naming the columns.
+    """
+
+    type = 'StatsSampler'
+    cxx_header = "sim/stats_sampler.hh"
+    cxx_class = 'gem5::StatsSampler'
+
+    stats = VectorParam.String(
+        "Regular expressions matching the full names of the stats to "
+        "sample (scalars, vectors and formulas)")
+    period = Param.Latency('1ms', "Simulated time between samples")
+
+    file = Param.String("",
+        "File in the output directory to write samples to")
+    socket = Param.String("",
+        "Path of a Unix socket on which to stream samples to clients")
+
+    ring_size = Param.Unsigned(256,
+        "Samples buffered for the export thread, must be a power of two")
@@ -48,6 +48,8 @@ from m5.objects.Workload import StubWorkload
 class MemoryMode(Enum): vals = ['invalid', 'atomic', 'timing',
                                 'atomic_noncaching']
 
+class MemCheckpointFormat(Enum): vals = ['gzip', 'chunked']
+
 class System(SimObject):
     type = 'System'
     cxx_header = "sim/system.hh"
@@ -75,6 +77,35 @@ class System(SimObject):
     mmap_using_noreserve = Param.Bool(False, "mmap the backing store " \
                                           "without reserving swap")
 
+    # The backing store is either checkpointed as a single gzip
+    # stream, or as a chunked image whose chunks are compressed and
+    # restored by several threads, and where chunks that only contain
+    # zeros are not stored at all.
+    checkpoint_mem_format = Param.MemCheckpointFormat('gzip',
+        "Format of the memory images in checkpoints")
+    checkpoint_mem_compression = Param.Int(1, "zlib compression level of "
+        "chunked memory images, 0 to store them uncompressed")
+    checkpoint_mem_threads = Param.Unsigned(0, "Number of threads used to "
+        "write and read chunked memory images, 0 for one per host CPU")
+    # Uncompressed chunked images (checkpoint_mem_compression = 0) can
+    # be mapped copy-on-write instead of being read when restoring, so
+    # that pages are only loaded when touched and clean pages are
+    # shared by all the simulations restoring the same checkpoint.
+    checkpoint_mem_lazy_restore = Param.Bool(False, "Map uncompressed "
+        "memory images copy-on-write when restoring from a checkpoint")
+    # Periodic checkpoints can track the pages written since the
+    # previous checkpoint, and only store those as a delta over the
+    # images of the previous checkpoint, which are hard linked into the
+    # new checkpoint so that each checkpoint stays self-contained.
+    # Backdoors to the memories are read only while pages are tracked,
+    # and memories which KVM maps for its guests are always stored in
+    # full if the system uses KVM.
+    checkpoint_mem_incremental = Param.Bool(False, "Only store the memory "
+        "pages written since the previous checkpoint (requires the "
+        "chunked format)")
+    checkpoint_mem_max_deltas = Param.Unsigned(8, "Maximum number of "
+        "deltas on top of a full memory image in incremental checkpoints")
+
     # The memory ranges are to be populated when creating the system
     # such that these can be passed from the I/O subsystem through an
     # I/O bridge or cache
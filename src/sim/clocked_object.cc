@@ -44,8 +44,13 @@ namespace gem5
 {
 
 ClockedObject::ClockedObject(const ClockedObjectParams &p) :
-    SimObject(p), Clocked(*p.clk_domain), powerState(p.power_state)
+    SimObject(p), Clocked(*p.clk_domain), powerState(p.power_state),
+    _skipIdleWakeups(p.skip_idle_wakeups)
 {
+    // Keep the stats of objects which tick every cycle as they are.
+    if (_skipIdleWakeups)
+        wakeupStats = std::make_unique<WakeupStats>(*this);
+
     // Register the power_model with the object
     // Slightly counter-intuitively, power models need to to register with the
     // clocked object and not the power stated object because the power model
@@ -55,6 +60,20 @@ ClockedObject::ClockedObject(const ClockedObjectParams &p) :
         power_model->setClockedObject(this);
 }
 
+ClockedObject::WakeupStats::WakeupStats(ClockedObject &co)
+    : statistics::Group(&co, "wakeups"),
+      ADD_STAT(wasted, statistics::units::Count::get(),
+               "Number of wakeups which found the object quiescent"),
+      ADD_STAT(sleeps, statistics::units::Count::get(),
+               "Number of times the object stopped waking up as it "
+               "became quiescent")
+{
+    // Only objects which declare their quiescence condition count
+    // these, keep them out of everyone else's stats.
+    wasted.flags(statistics::nozero);
+    sleeps.flags(statistics::nozero);
+}
+
 void
 ClockedObject::serialize(CheckpointOut &cp) const
 {
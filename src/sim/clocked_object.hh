@@ -44,7 +44,9 @@
 #ifndef __SIM_CLOCKED_OBJECT_HH__
 #define __SIM_CLOCKED_OBJECT_HH__
 
+#include <memory>
 
+#include "base/statistics.hh"
 #include "params/ClockedObject.hh"
 #include "sim/core.hh"
 #include "sim/clock_domain.hh"
@@ -243,6 +245,46 @@ class ClockedObject : public SimObject, public Clocked
     void unserialize(CheckpointIn &cp) override;
 
     PowerState *powerState;
+
+    /**
+     * Should this object stop waking up while it is quiescent? Parts of
+     * the object which wake up every cycle may declare their quiescence
+     * condition (see Ticked::quiescent() and ruby::Consumer::quiescent()),
+     * in which case they are only woken again by the arrival of new work.
+     */
+    bool skipIdleWakeups() const { return _skipIdleWakeups; }
+
+    /** Account a wakeup which found the object with nothing to do. */
+    void
+    countWastedWakeup()
+    {
+        if (wakeupStats)
+            ++wakeupStats->wasted;
+    }
+
+    /** Account the object going to sleep as it became quiescent. */
+    void
+    countIdleSleep()
+    {
+        if (wakeupStats)
+            ++wakeupStats->sleeps;
+    }
+
+  private:
+    const bool _skipIdleWakeups;
+
+    struct WakeupStats : public statistics::Group
+    {
+        WakeupStats(ClockedObject &co);
+
+        /** Wakeups which found the object quiescent */
+        statistics::Scalar wasted;
+        /** Number of times the object stopped waking up when quiescent */
+        statistics::Scalar sleeps;
+    };
+
+    /** Only registered when skipping idle wakeups, see skipIdleWakeups() */
+    std::unique_ptr<WakeupStats> wakeupStats;
 };
 
 } // namespace gem5
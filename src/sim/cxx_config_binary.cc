@@ -0,0 +1,346 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/cxx_config_binary.hh"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <utility>
+
+#include "base/str.hh"
+
+namespace gem5
+{
+
+namespace
+{
+
+void
+putU32(std::ostream &os, uint32_t v)
+{
+    const char bytes[4] = {
+        char(v & 0xff), char((v >> 8) & 0xff),
+        char((v >> 16) & 0xff), char((v >> 24) & 0xff)
+    };
+    os.write(bytes, sizeof(bytes));
+}
+
+/** Bounds checked cursor over a loaded file image */
+class Cursor
+{
+  private:
+    const uint8_t *pos;
+    const uint8_t *end;
+
+  public:
+    Cursor(const std::string &image) :
+        pos(reinterpret_cast<const uint8_t *>(image.data())),
+        end(pos + image.size())
+    {}
+
+    bool
+    bytes(const uint8_t *&ptr, size_t len)
+    {
+        if (size_t(end - pos) < len)
+            return false;
+        ptr = pos;
+        pos += len;
+        return true;
+    }
+
+    bool
+    u32(uint32_t &v)
+    {
+        const uint8_t *p;
+        if (!bytes(p, 4))
+            return false;
+        v = uint32_t(p[0]) | uint32_t(p[1]) << 8 |
+            uint32_t(p[2]) << 16 | uint32_t(p[3]) << 24;
+        return true;
+    }
+
+    /** Read a string table index, checking it against the table size */
+    bool
+    id(uint32_t &v, size_t num_strings)
+    {
+        return u32(v) && v < num_strings;
+    }
+
+    bool done() const { return pos == end; }
+};
+
+} // anonymous namespace
+
+const CxxBinaryFile::Param *
+CxxBinaryFile::findParam(const std::string &object_name,
+    const std::string &param_name) const
+{
+    auto obj = objects.find(object_name);
+    if (obj == objects.end())
+        return nullptr;
+
+    auto param = obj->second.find(param_name);
+    if (param == obj->second.end())
+        return nullptr;
+
+    return &param->second;
+}
+
+bool
+CxxBinaryFile::getParam(const std::string &object_name,
+    const std::string &param_name,
+    std::string &value) const
+{
+    const Param *param = findParam(object_name, param_name);
+    if (!param)
+        return false;
+
+    value = strings[param->value];
+    return true;
+}
+
+bool
+CxxBinaryFile::getParamVector(const std::string &object_name,
+    const std::string &param_name,
+    std::vector<std::string> &values) const
+{
+    const Param *param = findParam(object_name, param_name);
+    if (!param)
+        return false;
+
+    values.clear();
+    values.reserve(param->tokens.size());
+    for (auto token : param->tokens)
+        values.push_back(strings[token]);
+    return true;
+}
+
+bool
+CxxBinaryFile::getPortPeers(const std::string &object_name,
+    const std::string &port_name,
+    std::vector<std::string> &peers) const
+{
+    return getParamVector(object_name, port_name, peers);
+}
+
+bool
+CxxBinaryFile::objectExists(const std::string &object) const
+{
+    return objects.find(object) != objects.end();
+}
+
+void
+CxxBinaryFile::getAllObjectNames(std::vector<std::string> &list) const
+{
+    list.insert(list.end(), objectNames.begin(), objectNames.end());
+}
+
+void
+CxxBinaryFile::getObjectChildren(const std::string &object_name,
+    std::vector<std::string> &children, bool return_paths) const
+{
+    if (!getParamVector(object_name, "children", children))
+        return;
+
+    if (return_paths && object_name != "root") {
+        for (auto i = children.begin(); i != children.end(); ++i)
+            *i = object_name + "." + *i;
+    }
+}
+
+bool
+CxxBinaryFile::load(const std::string &filename)
+{
+    std::ifstream is(filename, std::ios::binary);
+    if (!is)
+        return false;
+
+    return load(is);
+}
+
+bool
+CxxBinaryFile::load(std::istream &is)
+{
+    strings.clear();
+    objectNames.clear();
+    objects.clear();
+
+    const std::string image(std::istreambuf_iterator<char>(is), {});
+    Cursor cursor(image);
+
+    const uint8_t *file_magic;
+    uint32_t file_version;
+    if (!cursor.bytes(file_magic, sizeof(magic)) ||
+            std::memcmp(file_magic, magic, sizeof(magic)) != 0 ||
+            !cursor.u32(file_version) || file_version != version) {
+        return false;
+    }
+
+    uint32_t num_strings;
+    if (!cursor.u32(num_strings))
+        return false;
+    strings.reserve(num_strings);
+    for (uint32_t i = 0; i < num_strings; i++) {
+        uint32_t len;
+        const uint8_t *str;
+        if (!cursor.u32(len) || !cursor.bytes(str, len))
+            return false;
+        strings.emplace_back(reinterpret_cast<const char *>(str), len);
+    }
+
+    uint32_t num_objects;
+    if (!cursor.u32(num_objects))
+        return false;
+    objectNames.reserve(num_objects);
+    objects.reserve(num_objects);
+    for (uint32_t i = 0; i < num_objects; i++) {
+        uint32_t name, num_params;
+        if (!cursor.id(name, num_strings) || !cursor.u32(num_params))
+            return false;
+
+        objectNames.push_back(strings[name]);
+        Object &object = objects[strings[name]];
+        object.reserve(num_params);
+        for (uint32_t j = 0; j < num_params; j++) {
+            uint32_t param_name, num_tokens;
+            Param param;
+            if (!cursor.id(param_name, num_strings) ||
+                    !cursor.id(param.value, num_strings) ||
+                    !cursor.u32(num_tokens)) {
+                return false;
+            }
+            param.tokens.resize(num_tokens);
+            for (auto &token : param.tokens) {
+                if (!cursor.id(token, num_strings))
+                    return false;
+            }
+            object.emplace(strings[param_name], std::move(param));
+        }
+    }
+
+    return cursor.done();
+}
+
+bool
+CxxBinaryFile::save(IniFile &ini, std::ostream &os)
+{
+    std::vector<std::string> table;
+    std::unordered_map<std::string, uint32_t> ids;
+    auto intern = [&table, &ids](const std::string &str) {
+        auto [it, inserted] = ids.emplace(str, table.size());
+        if (inserted)
+            table.push_back(str);
+        return it->second;
+    };
+
+    struct SavedParam
+    {
+        uint32_t name;
+        uint32_t value;
+        std::vector<uint32_t> tokens;
+    };
+    std::vector<std::pair<uint32_t, std::vector<SavedParam>>> saved;
+
+    // Sort sections and entries so that the same config always produces
+    // the same file.
+    std::vector<std::string> section_names;
+    ini.getSectionNames(section_names);
+    std::sort(section_names.begin(), section_names.end());
+
+    for (const auto &section_name : section_names) {
+        std::vector<std::pair<std::string, std::string>> entries;
+        ini.visitSection(section_name,
+            [&entries](const std::string &key, const std::string &value) {
+                entries.emplace_back(key, value);
+            });
+        std::sort(entries.begin(), entries.end());
+
+        std::vector<SavedParam> params;
+        for (const auto &[key, value] : entries) {
+            SavedParam param{intern(key), intern(value), {}};
+            std::vector<std::string> tokens;
+            tokenize(tokens, value, ' ', true);
+            for (const auto &token : tokens)
+                param.tokens.push_back(intern(token));
+            params.push_back(std::move(param));
+        }
+        saved.emplace_back(intern(section_name), std::move(params));
+    }
+
+    os.write(magic, sizeof(magic));
+    putU32(os, version);
+
+    putU32(os, table.size());
+    for (const auto &str : table) {
+        putU32(os, str.size());
+        os.write(str.data(), str.size());
+    }
+
+    putU32(os, saved.size());
+    for (const auto &[name, params] : saved) {
+        putU32(os, name);
+        putU32(os, params.size());
+        for (const auto &param : params) {
+            putU32(os, param.name);
+            putU32(os, param.value);
+            putU32(os, param.tokens.size());
+            for (auto token : param.tokens)
+                putU32(os, token);
+        }
+    }
+
+    return bool(os);
+}
+
+bool
+CxxBinaryFile::convert(const std::string &ini_filename,
+    const std::string &filename)
+{
+    IniFile ini;
+    if (!ini.load(ini_filename))
+        return false;
+
+    std::ofstream os(filename, std::ios::binary);
+    if (!os)
+        return false;
+
+    return save(ini, os);
+}
+
+bool
+CxxBinaryFile::isBinary(const std::string &filename)
+{
+    std::ifstream is(filename, std::ios::binary);
+    char file_magic[sizeof(magic)];
+    return is.read(file_magic, sizeof(file_magic)) &&
+        std::memcmp(file_magic, magic, sizeof(magic)) == 0;
+}
+
+} // namespace gem5
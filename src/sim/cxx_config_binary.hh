@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *
+ *  Compact binary config file reading and writing for use with
+ *  CxxConfigManager.
+ *
+ *  A binary config holds the same information as a config.ini but is
+ *  laid out so that it can be loaded without any text parsing: every
+ *  distinct string is stored once in a string table and each object
+ *  parameter refers to its raw value and its pre-split vector tokens
+ *  by index.
+ */
+
+#ifndef __SIM_CXX_CONFIG_BINARY_HH__
+#define __SIM_CXX_CONFIG_BINARY_HH__
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "base/inifile.hh"
+#include "sim/cxx_config.hh"
+
+namespace gem5
+{
+
+/**
+ * CxxConfigManager interface for using binary config files.
+ *
+ * File layout (all integers are little endian 32 bit values):
+ *
+ *     magic[8] version
+ *     num_strings { length bytes[length] }*
+ *     num_objects {
+ *         name num_params {
+ *             name value num_tokens { token }*
+ *         }*
+ *     }*
+ *
+ * where every name, value and token is an index into the string table.
+ */
+class CxxBinaryFile : public CxxConfigFileBase
+{
+  public:
+    static constexpr char magic[8] = "gem5cfg";
+    static constexpr uint32_t version = 1;
+
+  protected:
+    struct Param
+    {
+        uint32_t value;
+        std::vector<uint32_t> tokens;
+    };
+
+    using Object = std::unordered_map<std::string, Param>;
+
+    /** The string table, indexed by the ids stored in the file */
+    std::vector<std::string> strings;
+
+    /** Objects in the order they appear in the file */
+    std::vector<std::string> objectNames;
+
+    std::unordered_map<std::string, Object> objects;
+
+    const Param *findParam(const std::string &object_name,
+        const std::string &param_name) const;
+
+  public:
+    CxxBinaryFile() { }
+
+    bool getParam(const std::string &object_name,
+        const std::string &param_name,
+        std::string &value) const;
+
+    bool getParamVector(const std::string &object_name,
+        const std::string &param_name,
+        std::vector<std::string> &values) const;
+
+    bool getPortPeers(const std::string &object_name,
+        const std::string &port_name,
+        std::vector<std::string> &peers) const;
+
+    bool objectExists(const std::string &object_name) const;
+
+    void getAllObjectNames(std::vector<std::string> &list) const;
+
+    void getObjectChildren(const std::string &object_name,
+        std::vector<std::string> &children,
+        bool return_paths = false) const;
+
+    bool load(const std::string &filename);
+
+    /** Load from a stream, replacing any previously loaded config */
+    bool load(std::istream &is);
+
+    /** Write the contents of an .ini file in the binary format */
+    static bool save(IniFile &ini, std::ostream &os);
+
+    /** Convert the .ini file ini_filename into the binary file filename */
+    static bool convert(const std::string &ini_filename,
+        const std::string &filename);
+
+    /** Does the file look like a binary config? */
+    static bool isBinary(const std::string &filename);
+};
+
+} // namespace gem5
+
+#endif // __SIM_CXX_CONFIG_BINARY_HH__
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "base/inifile.hh"
+#include "sim/cxx_config_binary.hh"
+#include "sim/cxx_config_ini.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+const char *iniText =
+    "[root]\n"
+    "type=Root\n"
+    "children=system\n"
+    "eventq_index=0\n"
+    "\n"
+    "[system]\n"
+    "type=System\n"
+    "children=cpu membus\n"
+    "mem_ranges=0:536870911\n"
+    "\n"
+    "[system.cpu]\n"
+    "type=TimingSimpleCPU\n"
+    "clock=500\n"
+    "icache_port=system.membus.cpu_side_ports[0]\n"
+    "workload=\n"
+    "\n"
+    "[system.membus]\n"
+    "type=CoherentXBar\n"
+    "cpu_side_ports=system.cpu.icache_port  system.cpu.dcache_port\n";
+
+/** A temporary file name, removed when the test ends. */
+class TempPath
+{
+  private:
+    std::string _path;
+
+  public:
+    TempPath()
+    {
+        char buf[] = "/tmp/cxx_config_binary.XXXXXX";
+        int fd = mkstemp(buf);
+        close(fd);
+        _path = buf;
+    }
+
+    ~TempPath() { unlink(_path.c_str()); }
+
+    const std::string &path() const { return _path; }
+};
+
+std::string
+saveBinary(const char *text)
+{
+    IniFile ini;
+    std::istringstream is(text);
+    EXPECT_TRUE(ini.load(is));
+
+    std::ostringstream os;
+    EXPECT_TRUE(CxxBinaryFile::save(ini, os));
+    return os.str();
+}
+
+} // anonymous namespace
+
+/** Every query returns what the .ini reader returns for the same config */
+TEST(CxxBinaryFileTest, MatchesIni)
+{
+    TempPath ini_path, bin_path;
+    {
+        std::ofstream os(ini_path.path());
+        os << iniText;
+    }
+    ASSERT_TRUE(CxxBinaryFile::convert(ini_path.path(), bin_path.path()));
+    EXPECT_TRUE(CxxBinaryFile::isBinary(bin_path.path()));
+    EXPECT_FALSE(CxxBinaryFile::isBinary(ini_path.path()));
+
+    CxxIniFile ini;
+    CxxBinaryFile bin;
+    ASSERT_TRUE(ini.load(ini_path.path()));
+    ASSERT_TRUE(bin.load(bin_path.path()));
+
+    std::vector<std::string> ini_names, bin_names;
+    ini.getAllObjectNames(ini_names);
+    bin.getAllObjectNames(bin_names);
+    std::sort(ini_names.begin(), ini_names.end());
+    EXPECT_EQ(ini_names, bin_names);
+
+    const std::vector<std::pair<std::string, std::string>> queries = {
+        {"root", "type"}, {"root", "eventq_index"},
+        {"system", "mem_ranges"}, {"system.cpu", "clock"},
+        {"system.cpu", "workload"}, {"system.cpu", "missing"},
+        {"system.membus", "cpu_side_ports"}, {"missing", "type"},
+    };
+    for (const auto &[object, param] : queries) {
+        std::string ini_value, bin_value;
+        EXPECT_EQ(ini.getParam(object, param, ini_value),
+            bin.getParam(object, param, bin_value));
+        EXPECT_EQ(ini_value, bin_value);
+
+        std::vector<std::string> ini_values, bin_values;
+        EXPECT_EQ(ini.getParamVector(object, param, ini_values),
+            bin.getParamVector(object, param, bin_values));
+        EXPECT_EQ(ini_values, bin_values);
+    }
+
+    for (const auto &object : {"root", "system", "system.cpu"}) {
+        EXPECT_TRUE(bin.objectExists(object));
+        for (bool paths : {false, true}) {
+            std::vector<std::string> ini_children, bin_children;
+            ini.getObjectChildren(object, ini_children, paths);
+            bin.getObjectChildren(object, bin_children, paths);
+            EXPECT_EQ(ini_children, bin_children);
+        }
+    }
+    EXPECT_FALSE(bin.objectExists("system.l2"));
+}
+
+TEST(CxxBinaryFileTest, PreSplitVectors)
+{
+    std::istringstream is(saveBinary(iniText));
+    CxxBinaryFile bin;
+    ASSERT_TRUE(bin.load(is));
+
+    std::vector<std::string> peers;
+    ASSERT_TRUE(bin.getPortPeers("system.membus", "cpu_side_ports", peers));
+    EXPECT_EQ(peers, std::vector<std::string>(
+        {"system.cpu.icache_port", "system.cpu.dcache_port"}));
+
+    std::vector<std::string> children;
+    bin.getObjectChildren("system", children, true);
+    EXPECT_EQ(children, std::vector<std::string>(
+        {"system.cpu", "system.membus"}));
+
+    std::string workload = "x";
+    ASSERT_TRUE(bin.getParam("system.cpu", "workload", workload));
+    EXPECT_EQ(workload, "");
+}
+
+/** The same config always produces the same bytes */
+TEST(CxxBinaryFileTest, Deterministic)
+{
+    EXPECT_EQ(saveBinary(iniText), saveBinary(iniText));
+}
+
+TEST(CxxBinaryFileTest, RejectsBadFiles)
+{
+    const std::string image = saveBinary(iniText);
+    CxxBinaryFile bin;
+
+    std::istringstream empty("");
+    EXPECT_FALSE(bin.load(empty));
+
+    std::istringstream text(iniText);
+    EXPECT_FALSE(bin.load(text));
+
+    // Any truncation must be detected rather than read past the end.
+    for (size_t len = 0; len < image.size(); len++) {
+        std::istringstream truncated(image.substr(0, len));
+        EXPECT_FALSE(bin.load(truncated)) << "length " << len;
+    }
+
+    std::string bad_version = image;
+    bad_version[sizeof(CxxBinaryFile::magic)] ^= 0xff;
+    std::istringstream version(bad_version);
+    EXPECT_FALSE(bin.load(version));
+
+    std::istringstream trailing(image + "x");
+    EXPECT_FALSE(bin.load(trailing));
+
+    std::istringstream good(image);
+    EXPECT_TRUE(bin.load(good));
+    EXPECT_FALSE(bin.load("/nonexistent/config.bin"));
+}
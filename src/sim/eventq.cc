@@ -34,6 +34,7 @@
 #include <iostream>
 #include <mutex>
 #include <string>
+#include <typeinfo>
 #include <unordered_map>
 #include <vector>
 
@@ -41,6 +42,7 @@
 #include "base/trace.hh"
 #include "cpu/smt.hh"
 #include "debug/Checkpoint.hh"
+#include "sim/host_profile.hh"
 
 namespace gem5
 {
@@ -57,6 +59,8 @@ uint32_t numMainEventQueues = 0;
 std::vector<EventQueue *> mainEventQueue;
 __thread EventQueue *_curEventQueue = NULL;
 bool inParallelMode = false;
+bool indexedEventQueues = false;
+unsigned hostProfileSamplePeriod = 0;
 
 EventQueue *
 getEventQueue(uint32_t index)
@@ -65,6 +69,8 @@ getEventQueue(uint32_t index)
         numMainEventQueues++;
         mainEventQueue.push_back(
             new EventQueue(csprintf("MainEventQueue-%d", index)));
+        mainEventQueue.back()->setBinIndexing(indexedEventQueues);
+        mainEventQueue.back()->setHostProfiling(hostProfileSamplePeriod);
     }
 
     return mainEventQueue[index];
@@ -108,9 +114,29 @@ Event::insertBefore(Event *event, Event *curr)
     return event;
 }
 
+ObjectPool &
+EventFunctionWrapper::pool()
+{
+    static ObjectPool thePool(typeid(EventFunctionWrapper).name(),
+                              sizeof(EventFunctionWrapper));
+    return thePool;
+}
+
+ObjectPool::Cache &
+EventFunctionWrapper::poolCache()
+{
+    static thread_local ObjectPool::Cache theCache(pool());
+    return theCache;
+}
+
 void
 EventQueue::insert(Event *event)
 {
+    if (useBinIndex) {
+        insertIndexed(event);
+        return;
+    }
+
     // Deal with the head case
     if (!head || *event <= *head) {
         head = Event::insertBefore(event, head);
@@ -170,6 +196,11 @@ EventQueue::remove(Event *event)
 
     assert(event->queue == this);
 
+    if (useBinIndex) {
+        removeIndexed(event);
+        return;
+    }
+
     // deal with an event on the head's 'in bin' list (event has the same
     // time as the head)
     if (*head == *event) {
@@ -194,6 +225,78 @@ EventQueue::remove(Event *event)
     prev->nextBin = Event::removeItem(event, curr);
 }
 
+void
+EventQueue::insertIndexed(Event *event)
+{
+    const BinKey key = binKey(event);
+    auto bin = binIndex.lower_bound(key);
+
+    if (bin != binIndex.end() && bin->first == key) {
+        // The bin already exists, push the event on top of its stack
+        // just like insertBefore() would.
+        bin->second = Event::insertBefore(event, bin->second);
+    } else {
+        Event *next = bin == binIndex.end() ? nullptr : bin->second;
+        bin = binIndex.emplace_hint(bin, key,
+                                    Event::insertBefore(event, next));
+    }
+
+    // Link the new top of the bin into the bin list. Only the top
+    // item of the previous bin has a valid nextBin pointer.
+    if (bin == binIndex.begin())
+        head = event;
+    else
+        std::prev(bin)->second->nextBin = event;
+}
+
+void
+EventQueue::removeIndexed(Event *event)
+{
+    auto bin = binIndex.find(binKey(event));
+    if (bin == binIndex.end())
+        panic("event not found!");
+
+    const bool emptied = event == bin->second && !event->nextInBin;
+    Event *top = Event::removeItem(event, bin->second);
+
+    if (bin == binIndex.begin())
+        head = top;
+    else
+        std::prev(bin)->second->nextBin = top;
+
+    if (emptied)
+        binIndex.erase(bin);
+    else
+        bin->second = top;
+}
+
+void
+EventQueue::rebuildBinIndex()
+{
+    binIndex.clear();
+    for (Event *bin = head; bin; bin = bin->nextBin)
+        binIndex.emplace_hint(binIndex.end(), binKey(bin), bin);
+}
+
+void
+EventQueue::setBinIndexing(bool enable)
+{
+    useBinIndex = enable;
+    if (useBinIndex)
+        rebuildBinIndex();
+    else
+        binIndex.clear();
+}
+
+void
+EventQueue::setHostProfiling(unsigned sample_period)
+{
+    if (!sample_period)
+        hostProfiler.reset();
+    else if (!hostProfiler || hostProfiler->samplePeriod() != sample_period)
+        hostProfiler.reset(new HostProfiler(sample_period));
+}
+
 Event *
 EventQueue::serviceOne()
 {
@@ -208,10 +311,14 @@ EventQueue::serviceOne()
 
         // pop the stack
         head = next;
+        if (useBinIndex)
+            binIndex.begin()->second = next;
     } else {
         // this was the only element on the 'in bin' list, so get rid of
         // the 'in bin' list and point to the next bin list
         head = head->nextBin;
+        if (useBinIndex)
+            binIndex.erase(binIndex.begin());
     }
 
     // handle action
@@ -220,7 +327,10 @@ EventQueue::serviceOne()
         setCurTick(event->when());
         if (debug::Event)
             event->trace("executed");
-        event->process();
+        if (hostProfiler)
+            hostProfiler->process(event);
+        else
+            event->process();
         if (event->isExitEvent()) {
             assert(!event->flags.isSet(Event::Managed) ||
                    !event->flags.isSet(Event::IsMainQueue)); // would be silly
@@ -316,7 +426,7 @@ EventQueue::debugVerify() const
     std::unordered_map<long, bool> map;
 
     Tick time = 0;
-    short priority = 0;
+    short priority = Event::Minimum_Pri;
 
     Event *nextBin = head;
     while (nextBin) {
@@ -349,6 +459,21 @@ EventQueue::debugVerify() const
         nextBin = nextBin->nextBin;
     }
 
+    if (useBinIndex) {
+        auto bin = binIndex.begin();
+        for (Event *top = head; top; top = top->nextBin, ++bin) {
+            if (bin == binIndex.end() || bin->second != top) {
+                cprintf("bin index out of sync!");
+                top->dump();
+                return false;
+            }
+        }
+        if (bin != binIndex.end()) {
+            cprintf("stale bins in index!");
+            return false;
+        }
+    }
+
     return true;
 }
 
@@ -357,6 +482,8 @@ EventQueue::replaceHead(Event* s)
 {
     Event* t = head;
     head = s;
+    if (useBinIndex)
+        rebuildBinIndex();
     return t;
 }
 
@@ -416,30 +543,71 @@ Event::dump() const
 }
 
 EventQueue::EventQueue(const std::string &n)
-    : objName(n), head(NULL), _curTick(0)
+    : objName(n), head(NULL), _curTick(0), useBinIndex(false),
+      async_ring(asyncRingSize), async_overflowed(false), asyncInjected(0),
+      asyncOverflows(0), asyncMerged(0), asyncMergedLastQuantum(0),
+      asyncMergedMaxQuantum(0)
 {
 }
 
+EventQueue::~EventQueue()
+{
+    while (!empty())
+        deschedule(getHead());
+}
+
 void
 EventQueue::asyncInsert(Event *event)
 {
-    async_queue_mutex.lock();
-    async_queue.push_back(event);
-    async_queue_mutex.unlock();
+    asyncInjected.fetch_add(1, std::memory_order_relaxed);
+
+    if (!async_overflowed.load(std::memory_order_acquire) &&
+        async_ring.push(event)) {
+        return;
+    }
+
+    std::lock_guard<UncontendedMutex> lock(async_queue_mutex);
+    async_overflowed.store(true, std::memory_order_release);
+    async_overflow.push_back(event);
+    asyncOverflows++;
 }
 
 void
 EventQueue::handleAsyncInsertions()
 {
     assert(this == curEventQueue());
-    async_queue_mutex.lock();
+    std::lock_guard<UncontendedMutex> lock(async_queue_mutex);
+
+    uint64_t merged = 0;
+    Event *event;
+    while (true) {
+        while (async_ring.pop(event)) {
+            insert(event);
+            merged++;
+        }
+
+        // If events overflowed, all events that made it into the ring
+        // were scheduled before them. A producer may still be in the
+        // middle of filling a slot though, so wait for it to finish to
+        // keep the events of that thread in order.
+        if (async_overflow.empty() || async_ring.empty())
+            break;
+    }
+
+    for (auto overflowed : async_overflow) {
+        insert(overflowed);
+        merged++;
+    }
+    async_overflow.clear();
+    async_overflowed.store(false, std::memory_order_release);
 
-    while (!async_queue.empty()) {
-        insert(async_queue.front());
-        async_queue.pop_front();
+    if (merged) {
+        DPRINTF(Event, "Merged %d asynchronous events\n", merged);
     }
 
-    async_queue_mutex.unlock();
+    asyncMerged += merged;
+    asyncMergedLastQuantum = merged;
+    asyncMergedMaxQuantum = std::max(asyncMergedMaxQuantum, merged);
 }
 
 } // namespace gem5
@@ -36,16 +36,22 @@
 #define __SIM_EVENTQ_HH__
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <climits>
+#include <cstddef>
 #include <functional>
 #include <iosfwd>
 #include <list>
+#include <map>
 #include <memory>
 #include <string>
+#include <utility>
 
 #include "base/debug.hh"
 #include "base/flags.hh"
+#include "base/mpsc_ring.hh"
+#include "base/object_pool.hh"
 #include "base/types.hh"
 #include "base/uncontended_mutex.hh"
 #include "debug/Event.hh"
@@ -57,6 +63,7 @@ namespace gem5
 
 class EventQueue;       // forward declaration
 class BaseGlobalEvent;
+class HostProfiler;
 
 //! Simulation Quantum for multiple eventq simulation.
 //! The quantum value is the period length after which the queues
@@ -79,6 +86,14 @@ extern __thread EventQueue *_curEventQueue;
 //! Current mode of execution: parallel / serial
 extern bool inParallelMode;
 
+//! Whether main event queues keep an ordered index of their bins. See
+//! EventQueue::setBinIndexing().
+extern bool indexedEventQueues;
+
+//! Host profile sample period of the main event queues, zero when not
+//! profiling. See EventQueue::setHostProfiling().
+extern unsigned hostProfileSamplePeriod;
+
 //! Function for returning eventq queue for the provided
 //! index. The function allocates a new queue in case one
 //! does not exist for the index, provided that the index
@@ -612,7 +627,7 @@ operator!=(const Event &l, const Event &r)
  * schedule() method with the 'global' parameter set to true. Unlike
  * the previous queue migration strategy, this strategy is fully
  * deterministic. This causes the event to be inserted in a separate
- * queue of asynchronous events (async_queue), which is merged main
+ * queue of asynchronous events (async_ring), which is merged main
  * event queue at the end of each simulation quantum (by calling the
  * handleAsyncInsertions() method). Note that this implies that such
  * events must happen at least one simulation quantum into the future,
@@ -628,11 +643,60 @@ class EventQueue
     Event *head;
     Tick _curTick;
 
-    //! Mutex to protect async queue.
+    /**
+     * Optional ordered index of the bins in this queue.
+     *
+     * Each entry maps the (when, priority) pair of a bin to the event
+     * currently on top of that bin's 'in bin' stack. The linked list
+     * rooted at 'head' remains the authoritative representation of
+     * the queue; the index only lets insert() and remove() find the
+     * right bin in logarithmic rather than linear time. Since the bins
+     * themselves are unchanged, events are serviced in exactly the
+     * same order with and without the index.
+     */
+    typedef std::pair<Tick, EventBase::Priority> BinKey;
+    std::map<BinKey, Event *> binIndex;
+    bool useBinIndex;
+
+    static BinKey binKey(const Event *event)
+    {
+        return BinKey(event->when(), event->priority());
+    }
+
+    //! Number of events the lock-free async ring can hold.
+    static const size_t asyncRingSize = 4096;
+
+    //! Events added by other threads to this event queue.
+    MPSCRing<Event *> async_ring;
+
+    //! Mutex to protect the overflow list. Also held while merging
+    //! asynchronous events into the queue.
     UncontendedMutex async_queue_mutex;
 
-    //! List of events added by other threads to this event queue.
-    std::list<Event*> async_queue;
+    //! Events added by other threads while the async ring was full.
+    std::list<Event*> async_overflow;
+
+    //! Set while async_overflow is in use. Other threads keep adding
+    //! events to the overflow list until it has been merged, which
+    //! keeps the events from each thread in order.
+    std::atomic<bool> async_overflowed;
+
+    //! Total number of events added by other threads.
+    std::atomic<uint64_t> asyncInjected;
+
+    //! Number of asynchronous events which did not fit in the ring.
+    uint64_t asyncOverflows;
+
+    //! Total number of asynchronous events merged into this queue.
+    uint64_t asyncMerged;
+
+    //! Number of events merged at the end of the last quantum, and the
+    //! maximum number merged at the end of any quantum.
+    uint64_t asyncMergedLastQuantum;
+    uint64_t asyncMergedMaxQuantum;
+
+    //! Host time profile of the serviced events, if enabled.
+    std::unique_ptr<HostProfiler> hostProfiler;
 
     /**
      * Lock protecting event handling.
@@ -661,9 +725,18 @@ class EventQueue
     void insert(Event *event);
     void remove(Event *event);
 
+    //! Indexed variants of insert() / remove(), used when the bin
+    //! index is enabled.
+    void insertIndexed(Event *event);
+    void removeIndexed(Event *event);
+
+    //! Rebuild the bin index from the linked list rooted at 'head'.
+    void rebuildBinIndex();
+
     //! Function for adding events to the async queue. The added events
     //! are added to main event queue later. Threads, other than the
     //! owning thread, should call this function instead of insert().
+    //! This does not allocate memory unless the async ring is full.
     void asyncInsert(Event *event);
 
     EventQueue(const EventQueue &);
@@ -908,10 +981,53 @@ class EventQueue
     bool debugVerify() const;
 
     /**
-     * Function for moving events from the async_queue to the main queue.
+     * Enable or disable the ordered bin index for this queue.
+     *
+     * Queues with many distinct (when, priority) bins spend most of
+     * their scheduling time walking the bin list. Enabling the index
+     * makes insertion and removal logarithmic in the number of bins
+     * at the cost of a map update per new or retired bin. The index
+     * can be switched at any time; it is rebuilt from the current
+     * contents of the queue when enabled.
+     */
+    void setBinIndexing(bool enable);
+    bool binIndexing() const { return useBinIndex; }
+
+    /**
+     * Profile the host time spent servicing each event, timing one in
+     * sample_period events on average. A period of zero disables the
+     * profile, discarding what was collected so far.
+     */
+    void setHostProfiling(unsigned sample_period);
+    const HostProfiler *hostProfile() const { return hostProfiler.get(); }
+
+    /**
+     * Function for moving events from the async ring to the main queue.
      */
     void handleAsyncInsertions();
 
+    /**
+     * @{
+     * Counters for events scheduled on this queue by other threads.
+     * Only the owning thread should read the merge counters.
+     */
+    uint64_t
+    asyncEventsInjected() const
+    {
+        return asyncInjected.load(std::memory_order_relaxed);
+    }
+    uint64_t asyncEventsMerged() const { return asyncMerged; }
+    uint64_t asyncEventsOverflowed() const { return asyncOverflows; }
+    uint64_t asyncEventsMergedLastQuantum() const
+    {
+        return asyncMergedLastQuantum;
+    }
+    uint64_t asyncEventsMergedMaxQuantum() const
+    {
+        return asyncMergedMaxQuantum;
+    }
+    /** @} */
+
     /**
      *  Function to signal that the event loop should be woken up because
      *  an event has been scheduled by an agent outside the gem5 event
@@ -968,11 +1084,7 @@ class EventQueue
      */
     void checkpointReschedule(Event *event);
 
-    virtual ~EventQueue()
-    {
-        while (!empty())
-            deschedule(getHead());
-    }
+    virtual ~EventQueue();
 };
 
 inline void
@@ -1153,6 +1265,35 @@ class EventFunctionWrapper : public Event
      * @ingroup api_eventq
      */
     const char *description() const { return "EventFunctionWrapped"; }
+
+    /**
+     * Wrappers created with AutoDelete are typically allocated for
+     * every transaction, so dynamically allocated wrappers come from
+     * a per-thread pool rather than the system heap.
+     */
+    static void *
+    operator new(size_t size)
+    {
+        if (size != sizeof(EventFunctionWrapper)) {
+            pool().countFallback();
+            return ::operator new(size);
+        }
+        return pool().allocate(poolCache());
+    }
+
+    static void
+    operator delete(void *ptr, size_t size)
+    {
+        if (size != sizeof(EventFunctionWrapper))
+            ::operator delete(ptr);
+        else
+            pool().deallocate(poolCache(), ptr);
+    }
+
+    static ObjectPool &pool();
+
+  private:
+    static ObjectPool::Cache &poolCache();
 };
 
 /**
@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "sim/eventq.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/** Event which records its id in a shared log when processed. */
+class LogEvent : public Event
+{
+  private:
+    std::vector<int> &log;
+    int id;
+
+  public:
+    LogEvent(std::vector<int> &_log, int _id, Priority p)
+        : Event(p), log(_log), id(_id)
+    {}
+
+    void process() override { log.push_back(id); }
+};
+
+/**
+ * Schedule, reschedule and deschedule a pseudo-random set of events
+ * with many colliding (when, priority) bins and return the order in
+ * which they are serviced.
+ */
+std::vector<int>
+runRandomSchedule(bool indexed, bool switch_midway)
+{
+    EventQueue eq("test_eq");
+    curEventQueue(&eq);
+    eq.setBinIndexing(indexed);
+
+    std::vector<int> log;
+    std::vector<std::unique_ptr<LogEvent>> events;
+    std::mt19937 rng(565);
+    std::uniform_int_distribution<Tick> when(0, 200);
+    std::uniform_int_distribution<int> pri(-2, 2);
+    std::uniform_int_distribution<int> op(0, 9);
+
+    for (int i = 0; i < 2000; i++) {
+        events.emplace_back(new LogEvent(log, i, pri(rng)));
+        eq.schedule(events.back().get(), when(rng));
+
+        LogEvent *victim = events[rng() % events.size()].get();
+        const int action = op(rng);
+        if (action == 0 && victim->scheduled()) {
+            eq.deschedule(victim);
+        } else if (action == 1) {
+            eq.reschedule(victim, when(rng), true);
+        }
+
+        if (switch_midway && i == 1000)
+            eq.setBinIndexing(!indexed);
+    }
+
+    EXPECT_TRUE(eq.debugVerify());
+
+    while (!eq.empty())
+        eq.serviceOne();
+
+    curEventQueue(nullptr);
+    return log;
+}
+
+} // anonymous namespace
+
+/** Events in the same bin are serviced in LIFO order. */
+TEST(EventQueueTest, SameBinLifo)
+{
+    for (bool indexed : {false, true}) {
+        EventQueue eq("test_eq");
+        curEventQueue(&eq);
+        eq.setBinIndexing(indexed);
+
+        std::vector<int> log;
+        LogEvent e0(log, 0, Event::Default_Pri);
+        LogEvent e1(log, 1, Event::Default_Pri);
+        LogEvent e2(log, 2, Event::CPU_Tick_Pri);
+        LogEvent e3(log, 3, Event::Default_Pri);
+        eq.schedule(&e0, 10);
+        eq.schedule(&e2, 10);
+        eq.schedule(&e1, 10);
+        eq.schedule(&e3, 5);
+        ASSERT_TRUE(eq.debugVerify());
+
+        while (!eq.empty())
+            eq.serviceOne();
+
+        EXPECT_EQ(log, std::vector<int>({3, 1, 0, 2}));
+        curEventQueue(nullptr);
+    }
+}
+
+/** The bin index does not change the order in which events are serviced. */
+TEST(EventQueueTest, IndexedOrderMatchesList)
+{
+    const std::vector<int> reference = runRandomSchedule(false, false);
+    EXPECT_EQ(reference, runRandomSchedule(true, false));
+}
+
+/** The index can be enabled and disabled while events are pending. */
+TEST(EventQueueTest, SwitchIndexing)
+{
+    const std::vector<int> reference = runRandomSchedule(false, false);
+    EXPECT_EQ(reference, runRandomSchedule(false, true));
+    EXPECT_EQ(reference, runRandomSchedule(true, true));
+}
+
+/** replaceHead() keeps the index consistent with the swapped-in list. */
+TEST(EventQueueTest, ReplaceHead)
+{
+    EventQueue eq("test_eq");
+    curEventQueue(&eq);
+    eq.setBinIndexing(true);
+
+    std::vector<int> log;
+    LogEvent e0(log, 0, Event::Default_Pri);
+    LogEvent e1(log, 1, Event::Default_Pri);
+    eq.schedule(&e0, 20);
+
+    Event *saved = eq.replaceHead(nullptr);
+    EXPECT_TRUE(eq.empty());
+    eq.schedule(&e1, 5);
+    ASSERT_TRUE(eq.debugVerify());
+    eq.serviceOne();
+
+    eq.replaceHead(saved);
+    ASSERT_TRUE(eq.debugVerify());
+    eq.serviceOne();
+
+    EXPECT_EQ(log, std::vector<int>({1, 0}));
+    curEventQueue(nullptr);
+}
+
+/**
+ * Events scheduled from other threads are merged in the order each
+ * thread scheduled them, including when they overflow the async ring.
+ */
+TEST(EventQueueTest, AsyncInsertions)
+{
+    EventQueue eq("test_eq");
+    curEventQueue(&eq);
+
+    const int num_events = 6000;
+    std::vector<int> log;
+    std::vector<std::unique_ptr<LogEvent>> events;
+    for (int i = 0; i < num_events; i++)
+        events.emplace_back(new LogEvent(log, i, Event::Default_Pri));
+
+    inParallelMode = true;
+    std::thread producer([&]() {
+        EventQueue other("other_eq");
+        curEventQueue(&other);
+        // All events share a bin, so they are serviced in the reverse
+        // order of their insertion.
+        for (auto &event : events)
+            eq.schedule(event.get(), 100);
+        curEventQueue(nullptr);
+    });
+    producer.join();
+    inParallelMode = false;
+
+    EXPECT_TRUE(eq.empty());
+    EXPECT_EQ(eq.asyncEventsInjected(), num_events);
+
+    eq.handleAsyncInsertions();
+    EXPECT_EQ(eq.asyncEventsMerged(), num_events);
+    EXPECT_EQ(eq.asyncEventsMergedLastQuantum(), num_events);
+    EXPECT_GT(eq.asyncEventsOverflowed(), 0);
+
+    while (!eq.empty())
+        eq.serviceOne();
+
+    ASSERT_EQ(log.size(), num_events);
+    for (int i = 0; i < num_events; i++)
+        EXPECT_EQ(log[i], num_events - 1 - i);
+
+    curEventQueue(nullptr);
+}
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/host_profile.hh"
+
+#include <algorithm>
+#include <map>
+#include <ostream>
+#include <utility>
+
+#include "base/cprintf.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+HostProfiler::HostProfiler(unsigned sample_period)
+    : _samplePeriod(sample_period), countdown(sample_period),
+      rng(0x9e3779b9)
+{
+    fatal_if(sample_period == 0, "The host profile sample period must be "
+             "at least one event.");
+}
+
+HostProfiler::Entry &
+HostProfiler::lookupAutoDelete(const Event *event,
+                               const std::type_info *type)
+{
+    auto named = namedTypes.find(type);
+    if (named == namedTypes.end()) {
+        const bool has_name = event->name() != event->Event::name();
+        named = namedTypes.emplace(type, has_name).first;
+    }
+
+    // The names made up by Event::name() are unique to each event, so
+    // the events of types without names are only told apart by type.
+    AutoDeleteKey key(type, named->second ? event->name() : "");
+    auto it = autoDeleteIndex.find(key);
+    if (it != autoDeleteIndex.end())
+        return *it->second;
+
+    Entry &entry = add(event, type, key.second);
+    autoDeleteIndex.emplace(std::move(key), &entry);
+    return entry;
+}
+
+HostProfiler::Entry &
+HostProfiler::add(const Event *event, const std::type_info *type,
+                  const std::string &name)
+{
+    _entries.emplace_back();
+    Entry &entry = _entries.back();
+    entry.type = type;
+    entry.name = name;
+    entry.description = event->description();
+    return entry;
+}
+
+namespace
+{
+
+struct Totals
+{
+    uint64_t events = 0;
+    double ns = 0;
+};
+
+std::string
+frame(std::string name)
+{
+    std::replace(name.begin(), name.end(), ';', '_');
+    std::replace(name.begin(), name.end(), ' ', '_');
+    return name;
+}
+
+void
+printRow(std::ostream &os, const Totals &totals, double total_ns,
+         const std::string &label)
+{
+    ccprintf(os, "%12.3f %6.2f%% %12d %10.1f  %s\n",
+             totals.ns / 1e6, total_ns ? 100 * totals.ns / total_ns : 0.0,
+             totals.events, totals.events ? totals.ns / totals.events : 0.0,
+             label);
+}
+
+void
+printTable(std::ostream &os, const std::string &title, const char *column,
+           const std::map<std::string, Totals> &rows, double total_ns)
+{
+    std::vector<std::pair<std::string, Totals>> sorted(rows.begin(),
+                                                       rows.end());
+    std::stable_sort(sorted.begin(), sorted.end(),
+        [](const auto &a, const auto &b) {
+            return a.second.ns > b.second.ns;
+        });
+
+    ccprintf(os, "\n%s:\n", title);
+    ccprintf(os, "%12s %7s %12s %10s  %s\n",
+             "host ms", "share", "events", "ns/event", column);
+    for (const auto &row: sorted)
+        printRow(os, row.second, total_ns, row.first);
+}
+
+} // anonymous namespace
+
+void
+HostProfiler::dump(const std::vector<const HostProfiler *> &profilers,
+                   const std::function<bool(const std::string &)> &is_object,
+                   std::ostream &table, std::ostream &folded)
+{
+    // Merge the events of all queues by name.
+    std::map<std::pair<std::string, std::string>, Totals> events;
+    for (const HostProfiler *profiler: profilers) {
+        for (const Entry &entry: profiler->entries()) {
+            Totals &totals = events[{entry.name, entry.description}];
+            totals.events += entry.events;
+            totals.ns += double(entry.sampledNs) * profiler->samplePeriod();
+        }
+    }
+
+    std::map<std::string, Totals> by_object;
+    std::map<std::string, Totals> by_event;
+    std::map<std::string, Totals> stacks;
+    Totals total;
+    for (const auto &ev: events) {
+        // Function wrappers append the same suffix to the name they are
+        // given, which says nothing about the event.
+        std::string name = ev.first.first;
+        const std::string suffix = ".wrapped_function_event";
+        if (name.size() > suffix.size() &&
+                name.compare(name.size() - suffix.size(), suffix.size(),
+                             suffix) == 0) {
+            name.resize(name.size() - suffix.size());
+        }
+        const std::string &desc = ev.first.second;
+        const Totals &totals = ev.second;
+
+        // The owner is the longest prefix of the event's name, at a
+        // component boundary, which names a SimObject.
+        std::string owner;
+        for (size_t len = name.size(); len != std::string::npos && len;
+                len = name.rfind('.', len - 1)) {
+            if (is_object(name.substr(0, len))) {
+                owner = name.substr(0, len);
+                break;
+            }
+        }
+
+        std::string leaf = desc;
+        if (!owner.empty() && owner.size() + 1 < name.size())
+            leaf = name.substr(owner.size() + 1);
+
+        const std::string object = owner.empty() ? "(unowned)" : owner;
+        Totals &obj = by_object[object];
+        obj.events += totals.events;
+        obj.ns += totals.ns;
+
+        Totals &event = by_event[owner.empty() ? desc : name];
+        event.events += totals.events;
+        event.ns += totals.ns;
+
+        std::string stack;
+        size_t start = 0;
+        for (size_t dot = object.find('.'); dot != std::string::npos;
+                start = dot + 1, dot = object.find('.', start)) {
+            stack += frame(object.substr(start, dot - start)) + ";";
+        }
+        stack += frame(object.substr(start)) + ";" + frame(leaf);
+        Totals &st = stacks[stack];
+        st.events += totals.events;
+        st.ns += totals.ns;
+
+        total.events += totals.events;
+        total.ns += totals.ns;
+    }
+
+    ccprintf(table, "Host time profile, sampling 1 in %d events\n",
+             profilers.empty() ? 0 : profilers.front()->samplePeriod());
+    ccprintf(table, "Total: %d events, %.3f s of estimated host time\n",
+             total.events, total.ns / 1e9);
+    printTable(table, "Host time by SimObject", "object", by_object,
+               total.ns);
+    printTable(table, "Host time by event", "event", by_event, total.ns);
+
+    for (const auto &st: stacks) {
+        const uint64_t ns = st.second.ns + 0.5;
+        if (ns)
+            ccprintf(folded, "%s %d\n", st.first, ns);
+    }
+}
+
+} // namespace gem5
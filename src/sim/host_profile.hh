@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Attribution of simulator host time to the events, and the SimObjects
+ * owning them, that consume it.
+ */
+
+#ifndef __SIM_HOST_PROFILE_HH__
+#define __SIM_HOST_PROFILE_HH__
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "sim/eventq.hh"
+
+namespace gem5
+{
+
+/**
+ * Host time profile of the events serviced by an event queue.
+ *
+ * Every event is counted, but only one in samplePeriod events (on
+ * average, the distance between samples is randomized so that it does
+ * not alias with periodic event patterns) is timed, which keeps the
+ * overhead of reading the host clock off the common path. The host
+ * time of an event is estimated as its sampled time scaled by the
+ * sample period.
+ *
+ * Events are identified by their address, which is stable for the
+ * events embedded in SimObjects. The name of a sampled event is checked
+ * against its entry, so that an event which reuses the address of
+ * another event of the same type gets an entry of its own. Auto-deleted
+ * events, whose addresses are recycled, are identified by their type
+ * and name, or by their type alone if the type does not name its
+ * events.
+ */
+class HostProfiler
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    /** Accumulated profile of an event. */
+    struct Entry
+    {
+        /** Type of the event, to detect recycled addresses. */
+        const std::type_info *type;
+        /** Name and description of the event when first seen. */
+        std::string name;
+        std::string description;
+
+        uint64_t events = 0;
+        uint64_t samples = 0;
+        /** Host nanoseconds spent in the sampled events. */
+        uint64_t sampledNs = 0;
+    };
+
+    explicit HostProfiler(unsigned sample_period);
+
+    /** Process an event, accounting for it and for its host time. */
+    void
+    process(Event *event)
+    {
+        const bool sample = --countdown == 0;
+        Entry &entry = lookup(event, sample);
+        ++entry.events;
+        if (!sample) {
+            event->process();
+            return;
+        }
+
+        countdown = nextCountdown();
+        const Clock::time_point start = Clock::now();
+        event->process();
+        const Clock::duration elapsed = Clock::now() - start;
+        entry.sampledNs += std::chrono::duration_cast<
+            std::chrono::nanoseconds>(elapsed).count();
+        ++entry.samples;
+    }
+
+    unsigned samplePeriod() const { return _samplePeriod; }
+    const std::deque<Entry> &entries() const { return _entries; }
+
+    /**
+     * Write the merged profile of a set of event queues, as a table of
+     * host time per SimObject and per event, and as folded stacks that
+     * can be turned into a flame graph.
+     *
+     * @param profilers Profiles to merge.
+     * @param is_object Whether a name is the name of a SimObject, used
+     *     to find the owner of each event from the event's name.
+     * @param table Stream for the tables.
+     * @param folded Stream for the folded stacks, weighted by host ns.
+     */
+    static void dump(const std::vector<const HostProfiler *> &profilers,
+                     const std::function<bool(const std::string &)> &is_object,
+                     std::ostream &table, std::ostream &folded);
+
+  private:
+    const unsigned _samplePeriod;
+    unsigned countdown;
+    uint32_t rng;
+
+    std::deque<Entry> _entries;
+
+    /** Entries of the events which are not auto-deleted. */
+    std::unordered_map<const Event *, Entry *> index;
+
+    using AutoDeleteKey = std::pair<const std::type_info *, std::string>;
+
+    struct AutoDeleteKeyHash
+    {
+        std::size_t
+        operator()(const AutoDeleteKey &key) const
+        {
+            return key.first->hash_code() ^
+                std::hash<std::string>()(key.second);
+        }
+    };
+
+    /** Entries of the auto-deleted events. */
+    std::unordered_map<AutoDeleteKey, Entry *, AutoDeleteKeyHash>
+        autoDeleteIndex;
+
+    /**
+     * Whether the events of a type have names of their own, rather than
+     * the unique name Event::name() makes up for each instance.
+     */
+    std::unordered_map<const std::type_info *, bool> namedTypes;
+
+    /**
+     * Find the entry of an event.
+     *
+     * @param event The event.
+     * @param verify Whether to check the name of an event found by
+     *     its address, which costs building the name.
+     */
+    Entry &
+    lookup(const Event *event, bool verify)
+    {
+        const std::type_info *type = &typeid(*event);
+        if (event->isAutoDelete())
+            return lookupAutoDelete(event, type);
+
+        auto it = index.find(event);
+        if (it != index.end() && it->second->type == type &&
+                (!verify || it->second->name == event->name())) {
+            return *it->second;
+        }
+        Entry &entry = add(event, type, event->name());
+        index[event] = &entry;
+        return entry;
+    }
+
+    Entry &lookupAutoDelete(const Event *event, const std::type_info *type);
+
+    Entry &add(const Event *event, const std::type_info *type,
+               const std::string &name);
+
+    /** Distance to the next sample, uniform in [1, 2 * period - 1]. */
+    unsigned
+    nextCountdown()
+    {
+        if (_samplePeriod == 1)
+            return 1;
+        rng ^= rng << 13;
+        rng ^= rng >> 17;
+        rng ^= rng << 5;
+        return 1 + rng % (2 * _samplePeriod - 1);
+    }
+};
+
+} // namespace gem5
+
+#endif // __SIM_HOST_PROFILE_HH__
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <new>
+#include <sstream>
+#include <string>
+
+#include "sim/eventq.hh"
+#include "sim/host_profile.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/** Auto-deleted event, like the ones scheduled for one-shot actions. */
+class OneShot : public Event
+{
+  public:
+    OneShot() : Event(Default_Pri, AutoDelete) {}
+    void process() override {}
+    const char *description() const override { return "one shot"; }
+};
+
+bool
+isObject(const std::string &name)
+{
+    return name == "sys" || name == "sys.cpu" || name == "sys.mem";
+}
+
+/** Total number of events profiled by a queue. */
+uint64_t
+profiledEvents(const EventQueue &eq)
+{
+    uint64_t events = 0;
+    for (const auto &entry: eq.hostProfile()->entries())
+        events += entry.events;
+    return events;
+}
+
+} // anonymous namespace
+
+/** Events are attributed to the SimObject owning them. */
+TEST(HostProfileTest, Attribution)
+{
+    EventQueue eq("test_eq");
+    curEventQueue(&eq);
+    eq.setHostProfiling(1);
+
+    EventFunctionWrapper tick([]() {}, "sys.cpu.tickEvent");
+    EventFunctionWrapper respond([]() {}, "sys.mem.respondEvent");
+    for (Tick t = 0; t < 10; t++) {
+        eq.schedule(&tick, 2 * t);
+        eq.serviceOne();
+        if (t % 2 == 0) {
+            eq.schedule(&respond, 2 * t + 1);
+            eq.serviceOne();
+        }
+    }
+    // Auto-deleted events without names are identified by their type.
+    for (Tick t = 20; t < 23; t++) {
+        eq.schedule(new OneShot, t);
+        eq.serviceOne();
+    }
+
+    const auto &entries = eq.hostProfile()->entries();
+    ASSERT_EQ(entries.size(), 3);
+    EXPECT_EQ(entries[0].name, "sys.cpu.tickEvent.wrapped_function_event");
+    EXPECT_EQ(entries[0].events, 10);
+    EXPECT_EQ(entries[0].samples, 10);
+    EXPECT_EQ(entries[1].name,
+              "sys.mem.respondEvent.wrapped_function_event");
+    EXPECT_EQ(entries[1].events, 5);
+    EXPECT_EQ(entries[2].name, "");
+    EXPECT_EQ(entries[2].description, "one shot");
+    EXPECT_EQ(entries[2].events, 3);
+
+    std::ostringstream table, folded;
+    HostProfiler::dump({eq.hostProfile()}, isObject, table, folded);
+
+    EXPECT_NE(table.str().find("Total: 18 events"), std::string::npos);
+    EXPECT_NE(table.str().find("  sys.cpu\n"), std::string::npos);
+    EXPECT_NE(table.str().find("  sys.mem\n"), std::string::npos);
+    EXPECT_NE(table.str().find("  (unowned)\n"), std::string::npos);
+    EXPECT_NE(table.str().find("  sys.cpu.tickEvent\n"), std::string::npos);
+    EXPECT_NE(table.str().find("  one shot\n"), std::string::npos);
+
+    // Stacks with no measurable time are left out of the folded file,
+    // but those present have the right frames.
+    std::istringstream lines(folded.str());
+    std::string line;
+    while (std::getline(lines, line)) {
+        const std::string stack = line.substr(0, line.rfind(' '));
+        EXPECT_TRUE(stack == "sys;cpu;tickEvent" ||
+                    stack == "sys;mem;respondEvent" ||
+                    stack == "(unowned);one_shot") << line;
+    }
+}
+
+/** Auto-deleted events with names are attributed to their owners. */
+TEST(HostProfileTest, AutoDeleteNames)
+{
+    EventQueue eq("test_eq");
+    curEventQueue(&eq);
+    eq.setHostProfiling(1);
+
+    for (Tick t = 0; t < 5; t++) {
+        const std::string name = t % 2 ? "sys.cpu.fetch" : "sys.mem.respond";
+        eq.schedule(new EventFunctionWrapper([]() {}, name, true), t);
+        eq.serviceOne();
+    }
+
+    const auto &entries = eq.hostProfile()->entries();
+    ASSERT_EQ(entries.size(), 2);
+    EXPECT_EQ(entries[0].name, "sys.mem.respond.wrapped_function_event");
+    EXPECT_EQ(entries[0].events, 3);
+    EXPECT_EQ(entries[1].name, "sys.cpu.fetch.wrapped_function_event");
+    EXPECT_EQ(entries[1].events, 2);
+
+    std::ostringstream table, folded;
+    HostProfiler::dump({eq.hostProfile()}, isObject, table, folded);
+    EXPECT_NE(table.str().find("  sys.cpu\n"), std::string::npos);
+    EXPECT_NE(table.str().find("  sys.mem\n"), std::string::npos);
+    EXPECT_EQ(table.str().find("(unowned)"), std::string::npos);
+}
+
+/** An event reusing the address of another one gets its own entry. */
+TEST(HostProfileTest, ReusedAddress)
+{
+    EventQueue eq("test_eq");
+    curEventQueue(&eq);
+    eq.setHostProfiling(1);
+
+    alignas(EventFunctionWrapper) char storage[sizeof(EventFunctionWrapper)];
+    auto *tick = ::new (storage) EventFunctionWrapper(
+        []() {}, "sys.cpu.tickEvent");
+    eq.schedule(tick, 0);
+    eq.serviceOne();
+    tick->~EventFunctionWrapper();
+
+    auto *respond = ::new (storage) EventFunctionWrapper(
+        []() {}, "sys.mem.respondEvent");
+    for (Tick t = 1; t < 3; t++) {
+        eq.schedule(respond, t);
+        eq.serviceOne();
+    }
+    respond->~EventFunctionWrapper();
+
+    const auto &entries = eq.hostProfile()->entries();
+    ASSERT_EQ(entries.size(), 2);
+    EXPECT_EQ(entries[0].name, "sys.cpu.tickEvent.wrapped_function_event");
+    EXPECT_EQ(entries[0].events, 1);
+    EXPECT_EQ(entries[1].name,
+              "sys.mem.respondEvent.wrapped_function_event");
+    EXPECT_EQ(entries[1].events, 2);
+}
+
+/** All events are counted but only some are timed when sampling. */
+TEST(HostProfileTest, Sampling)
+{
+    EventQueue eq("test_eq");
+    curEventQueue(&eq);
+    eq.setHostProfiling(8);
+
+    EventFunctionWrapper tick([]() {}, "sys.cpu.tickEvent");
+    for (Tick t = 0; t < 8000; t++) {
+        eq.schedule(&tick, t);
+        eq.serviceOne();
+    }
+
+    ASSERT_EQ(eq.hostProfile()->entries().size(), 1);
+    const auto &entry = eq.hostProfile()->entries().front();
+    EXPECT_EQ(entry.events, 8000);
+    EXPECT_GT(entry.samples, 800);
+    EXPECT_LT(entry.samples, 1200);
+
+    // Changing the period restarts the profile, disabling drops it.
+    eq.setHostProfiling(8);
+    EXPECT_EQ(profiledEvents(eq), 8000);
+    eq.setHostProfiling(4);
+    EXPECT_EQ(profiledEvents(eq), 0);
+    eq.setHostProfiling(0);
+    EXPECT_EQ(eq.hostProfile(), nullptr);
+}
@@ -154,6 +154,7 @@ abortHandler(int sigtype)
     }
 
     print_backtrace();
+    Logger::runExitHooks();
     raiseFatalSignal(sigtype);
 }
 
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SIM_POOLED_EVENT_HH__
+#define __SIM_POOLED_EVENT_HH__
+
+#include <cstddef>
+#include <typeinfo>
+
+#include "base/object_pool.hh"
+#include "sim/eventq.hh"
+
+namespace gem5
+{
+
+/**
+ * Base class for events which are created and deleted at a high rate,
+ * typically one per packet or per instruction.
+ *
+ * Deriving from PooledEvent<T> rather than Event makes new and delete
+ * of T go through a per-type ObjectPool instead of the system heap:
+ *
+ * @code
+ * class WritebackEvent : public PooledEvent<WritebackEvent>
+ * @endcode
+ *
+ * Classes further derived from T are larger than the blocks of the
+ * pool and are allocated on the heap as usual.
+ *
+ * @tparam T The derived event class.
+ */
+template <class T>
+class PooledEvent : public Event
+{
+  public:
+    using Event::Event;
+
+    static void *
+    operator new(size_t size)
+    {
+        if (size != sizeof(T)) {
+            pool().countFallback();
+            return ::operator new(size);
+        }
+        return pool().allocate(cache());
+    }
+
+    static void
+    operator delete(void *ptr, size_t size)
+    {
+        if (size != sizeof(T))
+            ::operator delete(ptr);
+        else
+            pool().deallocate(cache(), ptr);
+    }
+
+    static ObjectPool &
+    pool()
+    {
+        static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__,
+                      "Pooled events may not be over-aligned");
+        static ObjectPool thePool(typeid(T).name(), sizeof(T));
+        return thePool;
+    }
+
+  private:
+    static ObjectPool::Cache &
+    cache()
+    {
+        static thread_local ObjectPool::Cache theCache(pool());
+        return theCache;
+    }
+};
+
+} // namespace gem5
+
+#endif // __SIM_POOLED_EVENT_HH__
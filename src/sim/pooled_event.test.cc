@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <set>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "sim/pooled_event.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/** Auto-deleting event counting how many times it was processed. */
+class CountEvent : public PooledEvent<CountEvent>
+{
+  private:
+    int &count;
+
+  public:
+    CountEvent(int &_count)
+        : PooledEvent(Default_Pri, AutoDelete), count(_count)
+    {}
+
+    void process() override { ++count; }
+};
+
+/** A derived event, too large for the blocks of the pool. */
+class BigCountEvent : public CountEvent
+{
+  private:
+    char padding[256];
+
+  public:
+    using CountEvent::CountEvent;
+};
+
+} // anonymous namespace
+
+/** Freed blocks are reused, so a steady stream needs a single slab. */
+TEST(PooledEventTest, ReuseBlocks)
+{
+    ObjectPool &pool = CountEvent::pool();
+    uint64_t slabs = pool.slabs();
+    uint64_t allocs = pool.allocations();
+
+    EventQueue eq("test_eq");
+    curEventQueue(&eq);
+
+    int count = 0;
+    for (int i = 0; i < 10000; i++) {
+        eq.schedule(new CountEvent(count), eq.getCurTick() + 1);
+        eq.serviceOne();
+    }
+
+    EXPECT_EQ(count, 10000);
+    EXPECT_EQ(pool.allocations() - allocs, 10000);
+    EXPECT_LE(pool.slabs() - slabs, 1);
+    EXPECT_EQ(pool.allocations(), pool.deallocations());
+}
+
+/** Live objects never share a block. */
+TEST(PooledEventTest, DistinctBlocks)
+{
+    int count = 0;
+    std::vector<CountEvent *> events;
+    std::set<void *> addrs;
+    for (int i = 0; i < 3 * ObjectPool::blocksPerSlab; i++) {
+        events.push_back(new CountEvent(count));
+        EXPECT_TRUE(addrs.insert(events.back()).second);
+    }
+    for (auto *event : events)
+        delete event;
+}
+
+/** Derived types bypass the pool. */
+TEST(PooledEventTest, Fallback)
+{
+    ObjectPool &pool = CountEvent::pool();
+    uint64_t fallbacks = pool.fallbackAllocations();
+    uint64_t allocs = pool.allocations();
+
+    int count = 0;
+    Event *event = new BigCountEvent(count);
+    delete event;
+
+    EXPECT_EQ(pool.fallbackAllocations() - fallbacks, 1);
+    EXPECT_EQ(pool.allocations(), allocs);
+}
+
+/**
+ * Events allocated by one thread and deleted by another flow back to
+ * the allocating thread through the shared list instead of piling up
+ * in the cache of the deleting thread.
+ */
+TEST(PooledEventTest, CrossThread)
+{
+    ObjectPool &pool = CountEvent::pool();
+    const int batches = 100;
+    const int batch_size = 2 * ObjectPool::highWater;
+
+    std::vector<CountEvent *> batch;
+    int count = 0;
+    for (int i = 0; i < batches; i++) {
+        for (int j = 0; j < batch_size; j++)
+            batch.push_back(new CountEvent(count));
+
+        std::thread deleter([&batch]() {
+            for (auto *event : batch)
+                delete event;
+        });
+        deleter.join();
+        batch.clear();
+    }
+
+    // Without recycling, every batch would require new slabs.
+    EXPECT_LT(pool.slabs() * ObjectPool::blocksPerSlab,
+              3 * batch_size);
+    EXPECT_EQ(pool.allocations(), pool.deallocations());
+
+    std::ostringstream os;
+    ObjectPool::dumpAll(os);
+    EXPECT_NE(os.str().find("CountEvent"), std::string::npos);
+}
+
+/** Dynamically allocated function wrappers are served by their pool. */
+TEST(PooledEventTest, FunctionWrapper)
+{
+    ObjectPool &pool = EventFunctionWrapper::pool();
+    uint64_t slabs = pool.slabs();
+    uint64_t allocs = pool.allocations();
+
+    EventQueue eq("test_eq");
+    curEventQueue(&eq);
+
+    int count = 0;
+    for (int i = 0; i < 10000; i++) {
+        eq.schedule(new EventFunctionWrapper([&count]() { ++count; },
+                                             "test", true),
+                    eq.getCurTick() + 1);
+        eq.serviceOne();
+    }
+
+    EXPECT_EQ(count, 10000);
+    EXPECT_EQ(pool.allocations() - allocs, 10000);
+    EXPECT_LE(pool.slabs() - slabs, 1);
+    EXPECT_EQ(pool.allocations(), pool.deallocations());
+}
@@ -39,15 +39,22 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <algorithm>
+
 #include "base/hostinfo.hh"
 #include "base/logging.hh"
+#include "base/object_pool.hh"
+#include "base/output.hh"
 #include "base/trace.hh"
 #include "debug/TimeSync.hh"
+#include "mem/packet.hh"
 #include "sim/core.hh"
 #include "sim/cur_tick.hh"
 #include "sim/eventq.hh"
 #include "sim/full_system.hh"
+#include "sim/host_profile.hh"
 #include "sim/root.hh"
+#include "sim/sim_exit.hh"
 
 namespace gem5
 {
@@ -75,9 +82,32 @@ Root::RootStats::RootStats()
              "The number of ticks simulated per host second (ticks/s)"),
     ADD_STAT(hostMemory, statistics::units::Byte::get(),
              "Number of bytes of host memory used"),
+    ADD_STAT(asyncEventsInjected, statistics::units::Count::get(),
+             "Number of events scheduled across event queues"),
+    ADD_STAT(asyncEventsMerged, statistics::units::Count::get(),
+             "Number of cross-queue events merged at quantum boundaries"),
+    ADD_STAT(asyncEventsOverflowed, statistics::units::Count::get(),
+             "Number of cross-queue events which did not fit in the "
+             "lock-free ring of their destination queue"),
+    ADD_STAT(maxAsyncEventsPerQuantum, statistics::units::Count::get(),
+             "Maximum number of cross-queue events merged into a single "
+             "queue at the end of a quantum"),
+    ADD_STAT(pooledAllocations, statistics::units::Count::get(),
+             "Number of events, packets and requests allocated from "
+             "object pools"),
+    ADD_STAT(poolSlabs, statistics::units::Count::get(),
+             "Number of slabs taken from the heap by object pools"),
+    ADD_STAT(packetInlineData, statistics::units::Count::get(),
+             "Number of packet data buffers held in the packet itself"),
+    ADD_STAT(mallocsAvoided, statistics::units::Count::get(),
+             "Number of heap allocations avoided by object pools and "
+             "inline packet data"),
 
     statTime(true),
-    startTick(0)
+    startTick(0),
+    startPooledAllocations(0),
+    startPoolSlabs(0),
+    startPacketInlineData(0)
 {
     simFreq.scalar(sim_clock::Frequency);
     simTicks.functor([this]() { return curTick() - startTick; });
@@ -99,8 +129,46 @@ Root::RootStats::RootStats()
 
     hostTickRate.precision(0);
 
+    // The event queues are only inspected when stats are dumped, which
+    // happens while all simulation threads are synchronised.
+    auto sum_queues = [](uint64_t (EventQueue::*counter)() const) {
+        return [counter]() {
+            uint64_t total = 0;
+            for (uint32_t i = 0; i < numMainEventQueues; ++i)
+                total += (mainEventQueue[i]->*counter)();
+            return total;
+        };
+    };
+    asyncEventsInjected.functor(
+            sum_queues(&EventQueue::asyncEventsInjected));
+    asyncEventsMerged.functor(sum_queues(&EventQueue::asyncEventsMerged));
+    asyncEventsOverflowed.functor(
+            sum_queues(&EventQueue::asyncEventsOverflowed));
+    maxAsyncEventsPerQuantum.functor([]() {
+            uint64_t max_merged = 0;
+            for (uint32_t i = 0; i < numMainEventQueues; ++i) {
+                max_merged = std::max(max_merged,
+                    mainEventQueue[i]->asyncEventsMergedMaxQuantum());
+            }
+            return max_merged;
+        });
+
+    // Like the event queue counters, the pools are summed up when
+    // stats are dumped. The totals never go back to zero, so the stats
+    // report what happened since they were last reset, like simTicks.
+    pooledAllocations.functor([this]() {
+            return ObjectPool::totalAllocations() - startPooledAllocations;
+        });
+    poolSlabs.functor([this]() {
+            return ObjectPool::totalSlabs() - startPoolSlabs;
+        });
+    packetInlineData.functor([this]() {
+            return Packet::inlineDataAllocations() - startPacketInlineData;
+        });
+
     simSeconds = simTicks / simFreq;
     hostTickRate = simTicks / hostSeconds;
+    mallocsAvoided = pooledAllocations - poolSlabs + packetInlineData;
 }
 
 void
@@ -108,6 +176,9 @@ Root::RootStats::resetStats()
 {
     statTime.setTimer();
     startTick = curTick();
+    startPooledAllocations = ObjectPool::totalAllocations();
+    startPoolSlabs = ObjectPool::totalSlabs();
+    startPacketInlineData = Packet::inlineDataAllocations();
 
     statistics::Group::resetStats();
 }
@@ -188,6 +259,40 @@ Root::Root(const RootParams &p, int)
 
     simQuantum = p.sim_quantum;
 
+    indexedEventQueues = p.event_queue_impl == enums::indexed;
+    for (uint32_t i = 0; i < numMainEventQueues; ++i)
+        mainEventQueue[i]->setBinIndexing(indexedEventQueues);
+
+    hostProfileSamplePeriod = p.host_profile_sample_period;
+    for (uint32_t i = 0; i < numMainEventQueues; ++i)
+        mainEventQueue[i]->setHostProfiling(hostProfileSamplePeriod);
+    if (hostProfileSamplePeriod) {
+        registerExitCallback([]() {
+            std::vector<const HostProfiler *> profiles;
+            for (uint32_t i = 0; i < numMainEventQueues; ++i) {
+                if (mainEventQueue[i]->hostProfile())
+                    profiles.push_back(mainEventQueue[i]->hostProfile());
+            }
+
+            OutputStream *table = simout.create("hostprofile.txt");
+            OutputStream *folded = simout.create("hostprofile.folded");
+            HostProfiler::dump(profiles,
+                [](const std::string &name) {
+                    return SimObject::find(name.c_str()) != nullptr;
+                },
+                *table->stream(), *folded->stream());
+            simout.close(table);
+            simout.close(folded);
+        });
+    }
+
+    // Summarize the use of the object pools once simulation is over.
+    registerExitCallback([]() {
+        OutputStream *os = simout.create("objectpools.txt");
+        ObjectPool::dumpAll(*os->stream());
+        simout.close(os);
+    });
+
     // Some of the statistics are global and need to be accessed by
     // stat formulas. The most convenient way to implement that is by
     // having a single global stat group for global stats. Merge that
@@ -110,6 +110,16 @@ class Root : public SimObject
         statistics::Formula hostTickRate;
         statistics::Value hostMemory;
 
+        statistics::Value asyncEventsInjected;
+        statistics::Value asyncEventsMerged;
+        statistics::Value asyncEventsOverflowed;
+        statistics::Value maxAsyncEventsPerQuantum;
+
+        statistics::Value pooledAllocations;
+        statistics::Value poolSlabs;
+        statistics::Value packetInlineData;
+        statistics::Formula mallocsAvoided;
+
         static RootStats instance;
 
       private:
@@ -120,6 +130,11 @@ class Root : public SimObject
 
         Time statTime;
         Tick startTick;
+
+        /** Totals of the allocation counters when stats were reset. */
+        uint64_t startPooledAllocations;
+        uint64_t startPoolSlabs;
+        uint64_t startPacketInlineData;
     };
 
   public:
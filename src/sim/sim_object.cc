@@ -146,6 +146,10 @@ SimObject::serializeAll(const std::string &cpt_dir)
         // since we are at the top level.
         obj->serializeSection(cp, obj->name());
    }
+
+    cp.close();
+    for (auto *obj : simObjectList)
+        obj->checkpointWritten();
 }
 
 #ifdef DEBUG
@@ -315,6 +315,16 @@ class SimObject : public EventManager, public Serializable, public Drainable,
     void serialize(CheckpointOut &cp) const override {};
     void unserialize(CheckpointIn &cp) override {};
 
+    /**
+     * Notify the object that a checkpoint it was serialized to is
+     * complete.
+     *
+     * serialize() must not change the object. Objects keeping state
+     * relative to the last checkpoint, for instance to only store
+     * what changed since, update it here instead.
+     */
+    virtual void checkpointWritten() {}
+
     /**
      * Create a checkpoint by serializing all SimObjects in the system.
      *
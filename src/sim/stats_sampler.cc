@@ -0,0 +1,401 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/stats_sampler.hh"
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <sstream>
+
+#include "base/cprintf.hh"
+#include "base/intmath.hh"
+#include "base/logging.hh"
+#include "base/socket.hh"
+#include "sim/cur_tick.hh"
+#include "sim/root.hh"
+#include "sim/sim_exit.hh"
+
+namespace gem5
+{
+
+namespace
+{
+
+std::vector<std::regex>
+compilePatterns(const std::vector<std::string> &strs)
+{
+    std::vector<std::regex> patterns;
+    for (const auto &str: strs) {
+        try {
+            patterns.emplace_back(str);
+        } catch (const std::regex_error &e) {
+            fatal("Invalid stats sampler pattern '%s': %s", str, e.what());
+        }
+    }
+    return patterns;
+}
+
+/** How often the export thread looks for new samples. */
+const auto pollInterval = std::chrono::milliseconds(10);
+
+} // anonymous namespace
+
+StatsSampler::StatsSampler(const Params &p)
+    : SimObject(p), patterns(compilePatterns(p.stats)), period(p.period),
+      buffers(p.ring_size), filledBuffers(p.ring_size),
+      freeBuffers(p.ring_size),
+      sampleEvent([this]{ takeSample(); }, name(), false,
+                  Event::Stat_Event_Pri),
+      stopping(false), drainedExporter(false), stopped(false),
+      fileName(p.file), file(nullptr), socketPath(p.socket), listenFd(-1),
+      samples(0), dropped(0)
+{
+    fatal_if(!isPowerOf2(p.ring_size),
+             "The stats sampler ring size must be a power of two.");
+    fatal_if(!period, "The stats sampler period must be non-zero.");
+
+    for (auto &buffer: buffers)
+        freeBuffers.push(&buffer);
+
+    if (!fileName.empty())
+        file = simout.create(fileName);
+
+    if (!socketPath.empty()) {
+        if (ListenSocket::allDisabled()) {
+            warn("%s: Listeners are disabled, not streaming stats on %s.",
+                 name(), socketPath);
+        } else {
+            listenFd = ListenSocket::socketCloexec(AF_UNIX, SOCK_STREAM, 0);
+            fatal_if(listenFd < 0, "%s: Can't create socket: %s", name(),
+                     strerror(errno));
+
+            struct sockaddr_un addr;
+            std::memset(&addr, 0, sizeof(addr));
+            addr.sun_family = AF_UNIX;
+            fatal_if(socketPath.size() >= sizeof(addr.sun_path),
+                     "%s: Socket path %s is too long.", name(), socketPath);
+            std::strcpy(addr.sun_path, socketPath.c_str());
+
+            unlink(socketPath.c_str());
+            fatal_if(bind(listenFd, (struct sockaddr *)&addr,
+                          sizeof(addr)) != 0 || listen(listenFd, 4) != 0,
+                     "%s: Can't listen on %s: %s", name(), socketPath,
+                     strerror(errno));
+            fcntl(listenFd, F_SETFL, fcntl(listenFd, F_GETFL) | O_NONBLOCK);
+            inform("%s: Streaming stats on %s", name(), socketPath);
+        }
+    }
+}
+
+StatsSampler::~StatsSampler()
+{
+    stop();
+}
+
+void
+StatsSampler::findStats(const statistics::Group &group,
+                        const std::string &prefix)
+{
+    for (const auto *info: group.getStats()) {
+        const std::string name = prefix + info->name;
+        bool match = false;
+        for (const auto &pattern: patterns)
+            match = match || std::regex_match(name, pattern);
+        if (!match)
+            continue;
+
+        Sampled s{name, dynamic_cast<const statistics::ScalarInfo *>(info),
+                  dynamic_cast<const statistics::VectorInfo *>(info)};
+        if (!s.scalar && !s.vector) {
+            warn("%s: Can't sample %s, only scalars, vectors and formulas "
+                 "are supported.", this->name(), name);
+            continue;
+        }
+        sampled.push_back(s);
+    }
+
+    for (const auto &child: group.getStatGroups())
+        findStats(*child.second, prefix + child.first + ".");
+}
+
+void
+StatsSampler::startup()
+{
+    findStats(*Root::root(), "");
+    warn_if(sampled.empty(), "%s: No stats match the patterns.", name());
+
+    // Vectors and formulas are sampled as one column per element, named
+    // like in the text stats.
+    std::ostringstream columns;
+    columns << "# tick";
+    for (const auto &s: sampled) {
+        if (s.scalar) {
+            columns << "\t" << s.name;
+            continue;
+        }
+        const auto *vec = s.vector;
+        for (size_t i = 0; i < vec->size(); ++i) {
+            if (i < vec->subnames.size() && !vec->subnames[i].empty())
+                columns << "\t" << s.name << "::" << vec->subnames[i];
+            else
+                columns << "\t" << s.name << "::" << i;
+        }
+    }
+    columns << "\n";
+    header = columns.str();
+
+    if (file) {
+        *file->stream() << header;
+        file->stream()->flush();
+    }
+
+    startExporter();
+    registerExitCallback([this]() { stop(); });
+
+    schedule(sampleEvent, curTick() + period);
+}
+
+DrainState
+StatsSampler::drain()
+{
+    // The export thread must not be running when the simulator forks,
+    // and the samples taken so far should be out when a checkpoint is.
+    if (exporter.joinable()) {
+        stopExporter();
+        drainedExporter = true;
+    }
+    return DrainState::Drained;
+}
+
+void
+StatsSampler::drainResume()
+{
+    if (stopped)
+        return;
+    if (!fileName.empty() && !file)
+        openFile();
+    if (drainedExporter) {
+        drainedExporter = false;
+        startExporter();
+    }
+}
+
+void
+StatsSampler::notifyFork()
+{
+    // The socket and its clients belong to the parent, which keeps
+    // serving them. The file is opened again in the child's output
+    // directory, which is only set up once the simulator resumes.
+    closeSockets(false);
+    if (file) {
+        simout.close(file);
+        file = nullptr;
+    }
+    samples = 0;
+    dropped = 0;
+}
+
+void
+StatsSampler::openFile()
+{
+    file = simout.create(fileName);
+    *file->stream() << header;
+    file->stream()->flush();
+}
+
+void
+StatsSampler::startExporter()
+{
+    stopping.store(false, std::memory_order_relaxed);
+    exporter = std::thread([this]() { exportLoop(); });
+}
+
+void
+StatsSampler::stopExporter()
+{
+    if (!exporter.joinable())
+        return;
+
+    stopping.store(true, std::memory_order_release);
+    exporter.join();
+}
+
+void
+StatsSampler::takeSample()
+{
+    schedule(sampleEvent, curTick() + period);
+
+    Sample *sample;
+    if (!freeBuffers.pop(sample)) {
+        ++dropped;
+        return;
+    }
+
+    sample->tick = curTick();
+    sample->values.clear();
+    for (const auto &s: sampled) {
+        if (s.scalar) {
+            sample->values.push_back(s.scalar->result());
+        } else {
+            // Formulas are vectors, evaluated by result().
+            const auto &vr = s.vector->result();
+            sample->values.insert(sample->values.end(), vr.begin(),
+                                  vr.end());
+        }
+    }
+
+    ++samples;
+    // The export thread gives back buffers as it goes, so there is
+    // always room for the ones we took.
+    const bool pushed = filledBuffers.push(sample);
+    assert(pushed);
+    (void)pushed;
+}
+
+void
+StatsSampler::exportLoop()
+{
+    while (!stopping.load(std::memory_order_acquire)) {
+        acceptClients();
+        exportSamples();
+        std::this_thread::sleep_for(pollInterval);
+    }
+    exportSamples();
+}
+
+void
+StatsSampler::exportSamples()
+{
+    std::string data;
+    Sample *sample;
+    while (filledBuffers.pop(sample)) {
+        data += std::to_string(sample->tick);
+        for (const double v: sample->values)
+            data += csprintf("\t%g", v);
+        data += "\n";
+
+        const bool pushed = freeBuffers.push(sample);
+        assert(pushed);
+        (void)pushed;
+    }
+
+    if (data.empty())
+        return;
+
+    if (file) {
+        *file->stream() << data;
+        file->stream()->flush();
+    }
+    sendClients(data);
+}
+
+void
+StatsSampler::acceptClients()
+{
+    if (listenFd < 0)
+        return;
+
+    int fd;
+    while ((fd = ListenSocket::acceptCloexec(listenFd, nullptr,
+                                             nullptr)) >= 0) {
+        clients.push_back(fd);
+        // Only the new client needs the header.
+        if (send(fd, header.data(), header.size(), MSG_NOSIGNAL) < 0) {
+            close(fd);
+            clients.pop_back();
+        }
+    }
+}
+
+void
+StatsSampler::sendClients(const std::string &data)
+{
+    for (auto it = clients.begin(); it != clients.end(); ) {
+        size_t sent = 0;
+        while (sent < data.size()) {
+            const ssize_t ret = send(*it, data.data() + sent,
+                                     data.size() - sent, MSG_NOSIGNAL);
+            if (ret < 0 && errno == EINTR)
+                continue;
+            if (ret <= 0)
+                break;
+            sent += ret;
+        }
+        if (sent < data.size()) {
+            close(*it);
+            it = clients.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void
+StatsSampler::closeSockets(bool unlink_socket)
+{
+    for (const int fd: clients)
+        close(fd);
+    clients.clear();
+    if (listenFd >= 0) {
+        close(listenFd);
+        if (unlink_socket)
+            unlink(socketPath.c_str());
+        listenFd = -1;
+    }
+}
+
+void
+StatsSampler::stop()
+{
+    if (stopped)
+        return;
+    stopped = true;
+
+    stopExporter();
+    // Samples taken after the last drain were not exported yet.
+    exportSamples();
+
+    closeSockets(true);
+    if (file) {
+        simout.close(file);
+        file = nullptr;
+    }
+
+    if (dropped) {
+        warn("%s: Dropped %d of %d samples as the export thread fell "
+             "behind.", name(), dropped, samples + dropped);
+    }
+}
+
+} // namespace gem5
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SIM_STATS_SAMPLER_HH__
+#define __SIM_STATS_SAMPLER_HH__
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <regex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "base/mpsc_ring.hh"
+#include "base/output.hh"
+#include "base/stats/group.hh"
+#include "base/stats/info.hh"
+#include "params/StatsSampler.hh"
+#include "sim/eventq.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+/**
+ * Periodic sampler of a few stats, streamed out by a background thread.
+ *
+ * The simulation thread only copies the current values of the selected
+ * stats into a free buffer, which it passes to the export thread through
+ * a lock-free ring; buffers are recycled through a second ring. If the
+ * export thread falls behind and no buffer is free, the sample is
+ * dropped rather than stalling the simulation. Stats are read on the
+ * simulation thread since they are not safe to read concurrently.
+ *
+ * The export thread is stopped when the simulator drains, which writes
+ * out the pending samples, and restarted when it resumes. This lets the
+ * simulator fork: the child closes the parent's socket and file, and
+ * opens the file again in its own output directory.
+ */
+class StatsSampler : public SimObject
+{
+  public:
+    PARAMS(StatsSampler);
+    StatsSampler(const Params &p);
+    ~StatsSampler();
+
+    void startup() override;
+
+    DrainState drain() override;
+    void drainResume() override;
+    void notifyFork() override;
+
+  protected:
+    /** A stat being sampled and the columns it occupies. */
+    struct Sampled
+    {
+        std::string name;
+        /** One of these is set, formulas are vectors. */
+        const statistics::ScalarInfo *scalar;
+        const statistics::VectorInfo *vector;
+    };
+
+    /** Values of all the sampled stats at a tick. */
+    struct Sample
+    {
+        Tick tick;
+        std::vector<double> values;
+    };
+
+    /** Find the stats matching the patterns in a group and below. */
+    void findStats(const statistics::Group &group,
+                   const std::string &prefix);
+
+    /** Copy the values of the sampled stats to a free buffer. */
+    void takeSample();
+
+    /** Main loop of the export thread. */
+    void exportLoop();
+
+    /** Write out the samples waiting in the ring, if any. */
+    void exportSamples();
+
+    /** Accept new socket clients and send them the header. */
+    void acceptClients();
+
+    /** Send data to all socket clients, dropping failed ones. */
+    void sendClients(const std::string &data);
+
+    /** Start the export thread. */
+    void startExporter();
+
+    /** Stop and join the export thread, flushing pending samples. */
+    void stopExporter();
+
+    /**
+     * Close the socket and its clients.
+     * @param unlink_socket Whether to remove the socket's path.
+     */
+    void closeSockets(bool unlink_socket);
+
+    /** Open the output file and write the header to it. */
+    void openFile();
+
+    /** Stop exporting for good, at exit. */
+    void stop();
+
+    const std::vector<std::regex> patterns;
+    const Tick period;
+
+    std::vector<Sampled> sampled;
+    std::string header;
+
+    std::vector<Sample> buffers;
+    MPSCRing<Sample *> filledBuffers;
+    MPSCRing<Sample *> freeBuffers;
+
+    EventFunctionWrapper sampleEvent;
+
+    std::thread exporter;
+    std::atomic<bool> stopping;
+    /** Whether the export thread was stopped by drain(). */
+    bool drainedExporter;
+    bool stopped;
+
+    const std::string fileName;
+    OutputStream *file;
+    std::string socketPath;
+    int listenFd;
+    std::vector<int> clients;
+
+    uint64_t samples;
+    uint64_t dropped;
+};
+
+} // namespace gem5
+
+#endif // __SIM_STATS_SAMPLER_HH__
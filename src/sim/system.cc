@@ -182,7 +182,11 @@ System::System(const Params &p)
       physProxy(_systemPort, p.cache_line_size),
       workload(p.workload),
       physmem(name() + ".physmem", p.memories, p.mmap_using_noreserve,
-              p.shared_backstore, p.auto_unlink_shared_backstore),
+              p.shared_backstore, p.auto_unlink_shared_backstore,
+              p.checkpoint_mem_format == enums::chunked,
+              p.checkpoint_mem_compression, p.checkpoint_mem_threads,
+              p.checkpoint_mem_lazy_restore, p.checkpoint_mem_incremental,
+              p.checkpoint_mem_max_deltas),
       ShadowRomRanges(p.shadow_rom_ranges.begin(),
                       p.shadow_rom_ranges.end()),
       memoryMode(p.mem_mode),
@@ -350,6 +354,12 @@ System::serialize(CheckpointOut &cp) const
     physmem.serializeSection(cp, "physmem");
 }
 
+void
+System::checkpointWritten()
+{
+    physmem.checkpointWritten();
+}
+
 
 void
 System::unserialize(CheckpointIn &cp)
@@ -340,7 +340,12 @@ class System : public SimObject, public PCEventScope
      * Set the pointer to the Kernel Virtual Machine (KVM) SimObject. For use
      * by that object to declare itself to the system.
      */
-    void setKvmVM(KvmVM *const vm) { kvmVM = vm; }
+    void
+    setKvmVM(KvmVM *const vm)
+    {
+        kvmVM = vm;
+        physmem.setKvmWrites();
+    }
 
     /** Get a pointer to access the physical memory of the system */
     memory::PhysicalMemory& getPhysMem() { return physmem; }
@@ -583,6 +588,7 @@ class System : public SimObject, public PCEventScope
 
     void serialize(CheckpointOut &cp) const override;
     void unserialize(CheckpointIn &cp) override;
+    void checkpointWritten() override;
 
   public:
     std::map<std::pair<uint32_t, uint32_t>, Tick>  lastWorkItemStarted;
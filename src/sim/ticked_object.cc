@@ -62,9 +62,18 @@ Ticked::processClockEvent() {
     ++tickCycles;
     ++numCycles;
     countCycles(Cycles(1));
+    const bool skip_idle = object.skipIdleWakeups();
+    if (skip_idle && quiescent())
+        object.countWastedWakeup();
     evaluate();
-    if (running)
+    if (!running)
+        return;
+    if (skip_idle && quiescent()) {
+        object.countIdleSleep();
+        stop();
+    } else {
         object.schedule(event, object.clockEdge(Cycles(1)));
+    }
 }
 
 void
@@ -147,6 +147,16 @@ class Ticked : public Serializable
     /** Action to call on the clock tick */
     virtual void evaluate() = 0;
 
+    /**
+     * Quiescence condition of the ticked object: true if evaluate() has
+     * nothing to do until new work arrives. If the object's
+     * skip_idle_wakeups parameter is set, objects which declare it have
+     * their no-op ticks counted as wasted wakeups and stop ticking when
+     * quiescent after evaluate(). They must then start() again whenever
+     * new work arrives.
+     */
+    virtual bool quiescent() const { return false; }
+
     /**
      * Callback to handle cycle statistics and probes.
      *
@@ -100,3 +100,36 @@ for test_name, basename_noext, args in null_tests:
         valid_isas=(constants.null_tag,),
         valid_hosts=constants.supported_hosts,
     )
+
+# Routers and controllers which went to sleep while quiescent must be
+# woken up again by new messages for the test to complete.
+gem5_verify_config(
+    name='ruby_mem_test-garnet-skip-idle',
+    fixtures=(),
+    verifiers=(verifier.MatchFileRegex(r'.*\.wakeups\.sleeps\s+[1-9]',
+                                       ['stats.txt']),),
+    config=joinpath(config.base_dir, 'configs', 'example',
+        'ruby_mem_test.py'),
+    config_args=['--abs-max-tick', '20000000', '--functional', '10',
+                 '--network=garnet', '--skip-idle-wakeups'],
+    valid_isas=(constants.null_tag,),
+    valid_hosts=constants.supported_hosts,
+)
+
+# Warm the caches of two cores functionally while fast-forwarding, then
+# finish the run on timing CPUs with the warmed caches.
+gem5_verify_config(
+    name='cache_warmup',
+    fixtures=(),
+    verifiers=(
+        verifier.MatchRegex(r'Exiting @ tick \d+ because exiting with '
+                            r'last active thread context'),
+        verifier.MatchFileRegex(r'.*dcache\.warmupHits\s+[1-9]',
+                                ['stats.txt']),
+    ),
+    config=joinpath(config.base_dir, 'configs', 'example',
+        'cache_warmup.py'),
+    config_args=['--num-cpus', '2'],
+    valid_isas=(constants.vega_x86_tag,),
+    valid_hosts=constants.supported_hosts,
+)
@@ -0,0 +1,208 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 The ECE565-Project Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# Reader for the chunked memory images written to checkpoints when a
+# System has checkpoint_mem_format set to 'chunked' (see
+# src/base/chunked_image.hh for the layout of the files).
+#
+# Tools which expect the memory of a checkpoint as a gzip stream can be
+# used on such a checkpoint after converting it back:
+#
+#   chunked_image.py to-gzip m5out/cpt.1000
+#
+# This rewrites every chunked image of the checkpoint as a gzip stream,
+# applying the deltas of incremental checkpoints to their base image,
+# and updates m5.cpt to refer to the new files. A full image can also
+# be decoded to a raw file with:
+#
+#   chunked_image.py to-raw system.physmem.store0.cimg mem.bin
+
+import configparser
+import gzip
+import os
+import struct
+import sys
+import zlib
+
+MAGIC = b"gem5CIMG"
+VERSION = 1
+
+HEADER = struct.Struct("=8sIIIIQQ")
+CHUNK_ENTRY = struct.Struct("=QIB3x")
+
+ENC_ZERO = 0
+ENC_RAW = 1
+ENC_DEFLATE = 2
+ENC_UNCHANGED = 3
+
+
+class ChunkedImage:
+    def __init__(self, path):
+        self.path = path
+        self._file = open(path, "rb")
+        (
+            magic,
+            version,
+            self.chunk_size,
+            self.alignment,
+            _,
+            self.size,
+            num_chunks,
+        ) = HEADER.unpack(self._file.read(HEADER.size))
+        if magic != MAGIC:
+            raise ValueError(f"{path} is not a chunked image")
+        if version != VERSION:
+            raise ValueError(
+                f"{path} has version {version}, expected {VERSION}"
+            )
+        index = self._file.read(num_chunks * CHUNK_ENTRY.size)
+        self.chunks = [
+            CHUNK_ENTRY.unpack_from(index, i * CHUNK_ENTRY.size)
+            for i in range(num_chunks)
+        ]
+
+    def close(self):
+        self._file.close()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *args):
+        self.close()
+
+    def chunk_length(self, chunk):
+        return min(self.chunk_size, self.size - chunk * self.chunk_size)
+
+    def read_chunk(self, chunk):
+        """Return the decoded contents of a chunk."""
+        offset, stored_size, encoding = self.chunks[chunk]
+        length = self.chunk_length(chunk)
+        if encoding == ENC_UNCHANGED:
+            raise ValueError(f"{self.path}: chunk {chunk} is in a base image")
+        if encoding == ENC_ZERO:
+            return bytes(length)
+        self._file.seek(offset)
+        data = self._file.read(stored_size)
+        if encoding == ENC_DEFLATE:
+            data = zlib.decompress(data)
+        elif encoding != ENC_RAW:
+            raise ValueError(f"{self.path}: unknown encoding {encoding}")
+        if len(data) != length:
+            raise ValueError(f"{self.path}: chunk {chunk} is corrupted")
+        return data
+
+    def __iter__(self):
+        """Iterate over the decoded chunks of the image."""
+        for chunk in range(len(self.chunks)):
+            yield self.read_chunk(chunk)
+
+
+def compose(images):
+    """Iterate over the contents of a full image with deltas applied,
+    the images being ordered from the base to the latest delta."""
+    size = images[0].size
+    if any(image.size != size for image in images):
+        raise ValueError("The images of the chain differ in size")
+    step = min(image.chunk_size for image in images)
+    cache = [(None, None)] * len(images)
+
+    for offset in range(0, size, step):
+        for i in reversed(range(len(images))):
+            image = images[i]
+            chunk = offset // image.chunk_size
+            if image.chunks[chunk][2] == ENC_UNCHANGED:
+                continue
+            if cache[i][0] != chunk:
+                cache[i] = (chunk, image.read_chunk(chunk))
+            start = offset - chunk * image.chunk_size
+            yield cache[i][1][start : start + step]
+            break
+        else:
+            raise ValueError(f"No image of the chain holds offset {offset}")
+
+
+def to_raw(image_path, out_path):
+    with ChunkedImage(image_path) as image, open(out_path, "wb") as out:
+        for data in image:
+            out.write(data)
+
+
+def to_gzip(cpt_dir):
+    cpt_path = os.path.join(cpt_dir, "m5.cpt")
+    cpt = configparser.ConfigParser()
+    cpt.optionxform = str
+    cpt.read(cpt_path)
+
+    converted = 0
+    for sec in cpt.sections():
+        if cpt.get(sec, "format", fallback="gzip") != "chunked":
+            continue
+
+        filename = cpt.get(sec, "filename")
+        names = cpt.get(sec, "chain", fallback="").split() + [filename]
+        paths = [os.path.join(cpt_dir, name) for name in names]
+        new_filename = os.path.splitext(filename)[0] + ".pmem"
+
+        images = [ChunkedImage(path) for path in paths]
+        with gzip.open(os.path.join(cpt_dir, new_filename), "wb") as gz:
+            for data in compose(images):
+                gz.write(data)
+        for image in images:
+            image.close()
+        for path in paths:
+            os.remove(path)
+
+        cpt.set(sec, "format", "gzip")
+        cpt.set(sec, "filename", new_filename)
+        cpt.remove_option(sec, "chain")
+        converted += 1
+
+    with open(cpt_path, "w") as f:
+        cpt.write(f)
+    print(f"Converted {converted} memory image(s) in {cpt_dir}")
+
+
+if __name__ == "__main__":
+    from argparse import ArgumentParser
+
+    parser = ArgumentParser(description="Convert chunked memory images")
+    sub = parser.add_subparsers(dest="command", required=True)
+    p = sub.add_parser("to-gzip", help="Convert the images of a checkpoint")
+    p.add_argument("checkpoint", help="Checkpoint directory")
+    p = sub.add_parser("to-raw", help="Decode an image to a raw file")
+    p.add_argument("image", help="Chunked image")
+    p.add_argument("output", help="Raw output file")
+    args = parser.parse_args()
+
+    try:
+        if args.command == "to-gzip":
+            to_gzip(args.checkpoint)
+        else:
+            to_raw(args.image, args.output)
+    except ValueError as e:
+        sys.exit(str(e))
@@ -39,10 +39,11 @@
  * @file
  *
  *  C++-only configuration and instantiation support.  This allows a
- *  config to be read back from a .ini and instantiated without
- *  Python.  Useful if you want to embed gem5 within a larger system
- *  without carrying the integration cost of the fully-featured
- *  configuration system.
+ *  config to be read back from a .ini (or the binary config written by
+ *  gem5 --dump-config-binary) and instantiated without Python.
+ *  Useful if you want to embed gem5 within a larger system without
+ *  carrying the integration cost of the fully-featured configuration
+ *  system.
  *
  *  This file contains a demonstration main using CxxConfigManager.
  *  Build with something like:
@@ -53,6 +54,7 @@
  *          -o gem5cxx.opt -Lbuild/ARM -lgem5_opt
  */
 
+#include <chrono>
 #include <cstdlib>
 #include <iostream>
 #include <sstream>
@@ -62,6 +64,7 @@
 #include "base/str.hh"
 #include "base/trace.hh"
 #include "cpu/base.hh"
+#include "sim/cxx_config_binary.hh"
 #include "sim/cxx_config_ini.hh"
 #include "sim/cxx_manager.hh"
 #include "sim/init_signals.hh"
@@ -78,7 +81,7 @@ void
 usage(const std::string &prog_name)
 {
     std::cerr << "Usage: " << prog_name << (
-        " <config-file.ini> [ <option> ]\n\n"
+        " <config-file.ini|config-file.bin> [ <option> ]\n\n"
         "OPTIONS:\n"
         "    -p <object> <param> <value>  -- set a parameter\n"
         "    -v <object> <param> <values> -- set a vector parameter from"
@@ -93,6 +96,12 @@ usage(const std::string &prog_name)
         "    -c <from> <to> <ticks>       -- switch from cpu 'from' to cpu"
         " 'to' after\n"
         "                                    the given number of ticks\n"
+        "    -b <file>                    -- write the config as a binary"
+        " config file\n"
+        "                                    and exit\n"
+        "    -T                           -- report the time taken to load"
+        " and\n"
+        "                                    instantiate the config\n"
         "\n"
         );
 
@@ -123,7 +132,14 @@ main(int argc, char **argv)
 
     const std::string config_file(argv[arg_ptr]);
 
-    CxxConfigFileBase *conf = new CxxIniFile();
+    using Clock = std::chrono::steady_clock;
+    const auto load_start = Clock::now();
+
+    CxxConfigFileBase *conf;
+    if (CxxBinaryFile::isBinary(config_file))
+        conf = new CxxBinaryFile();
+    else
+        conf = new CxxIniFile();
 
     if (!conf->load(config_file.c_str())) {
         std::cerr << "Can't open config file: " << config_file << '\n';
@@ -132,6 +148,7 @@ main(int argc, char **argv)
     arg_ptr++;
 
     CxxConfigManager *config_manager = new CxxConfigManager(*conf);
+    const auto load_end = Clock::now();
 
     bool checkpoint_restore = false;
     bool checkpoint_save = false;
@@ -141,6 +158,7 @@ main(int argc, char **argv)
     std::string to_cpu = "";
     Tick pre_run_time = 1000000;
     Tick pre_switch_time = 1000000;
+    bool report_times = false;
 
     try {
         while (arg_ptr < argc) {
@@ -192,6 +210,17 @@ main(int argc, char **argv)
                 to_cpu = argv[arg_ptr + 1];
                 std::istringstream(argv[arg_ptr + 2]) >> pre_switch_time;
                 arg_ptr += 3;
+            } else if (option == "-b") {
+                if (num_args < 1)
+                    usage(prog_name);
+                if (!CxxBinaryFile::convert(config_file, argv[arg_ptr])) {
+                    std::cerr << "Can't write binary config file: "
+                        << argv[arg_ptr] << '\n';
+                    return EXIT_FAILURE;
+                }
+                return EXIT_SUCCESS;
+            } else if (option == "-T") {
+                report_times = true;
             } else {
                 usage(prog_name);
             }
@@ -210,6 +239,7 @@ main(int argc, char **argv)
     CxxConfig::statsEnable();
     getEventQueue(0)->dump();
 
+    const auto instantiate_start = Clock::now();
     try {
         config_manager->instantiate();
         if (!checkpoint_restore) {
@@ -223,6 +253,14 @@ main(int argc, char **argv)
         return EXIT_FAILURE;
     }
 
+    if (report_times) {
+        using Ms = std::chrono::duration<double, std::milli>;
+        const auto instantiate_end = Clock::now();
+        std::cerr << "Config load: " << Ms(load_end - load_start).count()
+            << " ms, instantiate: "
+            << Ms(instantiate_end - instantiate_start).count() << " ms\n";
+    }
+
     GlobalSimLoopExitEvent *exit_event = NULL;
 
     if (checkpoint_save) {
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026 The ECE565-Project Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Convert a debug trace written with --debug-binary back into the text
+ * gem5 would have written without it.
+ *
+ * Usage: decode_debug_trace [<trace> [<output>]]
+ *
+ * The trace is read from standard input if it is omitted or "-", and the
+ * text is written to standard output if no output file is given.
+ */
+
+#include <fstream>
+#include <iostream>
+
+#include "base/trace_binary.hh"
+
+int
+main(int argc, char *argv[])
+{
+    if (argc > 3) {
+        std::cerr << "Usage: " << argv[0] << " [<trace> [<output>]]"
+                  << std::endl;
+        return 2;
+    }
+
+    std::ifstream in_file;
+    std::istream *in = &std::cin;
+    if (argc > 1 && std::string(argv[1]) != "-") {
+        in_file.open(argv[1], std::ios::in | std::ios::binary);
+        if (!in_file) {
+            std::cerr << "Unable to open " << argv[1] << std::endl;
+            return 1;
+        }
+        in = &in_file;
+    }
+
+    std::ofstream out_file;
+    std::ostream *out = &std::cout;
+    if (argc > 2) {
+        out_file.open(argv[2]);
+        if (!out_file) {
+            std::cerr << "Unable to open " << argv[2] << std::endl;
+            return 1;
+        }
+        out = &out_file;
+    }
+
+    gem5::Trace::BinaryReader reader(*in);
+    while (reader.next(*out))
+        ;
+
+    if (!reader.error().empty()) {
+        std::cerr << reader.error() << std::endl;
+        return 1;
+    }
+    return 0;
+}